@@ -19,14 +19,18 @@ public class BlueprintAttributesTests : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry",
 				"BlueprintAttributes",
 				"CoreUObject",
 				"Engine",
 				"GameplayAbilities",
 				"GameplayTags",
+				"Json",
 				"Slate",
 				"SlateCore",
 			}
 		);
+
+		SetupGameplayDebuggerSupport(Target);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "Debug/GBATestsGameplayDebuggerCategory_Attributes.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+
+FGBATestsGameplayDebuggerCategory_Attributes::FGBATestsGameplayDebuggerCategory_Attributes()
+{
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+void FGBATestsGameplayDebuggerCategory_Attributes::FRepData::Serialize(FArchive& Ar)
+{
+	Data.Serialize(Ar);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGBATestsGameplayDebuggerCategory_Attributes::MakeInstance()
+{
+	return MakeShared<FGBATestsGameplayDebuggerCategory_Attributes>();
+}
+
+void FGBATestsGameplayDebuggerCategory_Attributes::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(DebugActor);
+	DataPack.Data.Collect(ASC);
+}
+
+void FGBATestsGameplayDebuggerCategory_Attributes::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	const FGBATestsAttributeDebugData& Data = DataPack.Data;
+	if (Data.Sets.IsEmpty())
+	{
+		CanvasContext.Print(TEXT("{grey}No Blueprint Attribute Sets on debug actor"));
+		return;
+	}
+
+	for (const FGBATestsAttributeDebugSet& Set : Data.Sets)
+	{
+		const FGBATestsAttributeDebugLayout* Layout = FGBATestsAttributeDebugLayout::FindOrAdd(Set.Class.Get());
+
+		LineBuilder.Reset();
+		LineBuilder.Append(TEXT("{yellow}"));
+		LineBuilder.Append(Layout ? *Layout->SetName : TEXT("<unknown set>"));
+		PrintLine(CanvasContext);
+
+		for (int32 Index = 0; Index < Set.NumEntries; ++Index)
+		{
+			LineBuilder.Reset();
+			LineBuilder.Append(TEXT("  {white}"));
+			Data.FormatEntry(Set, Index, LineBuilder);
+			PrintLine(CanvasContext);
+		}
+	}
+}
+
+void FGBATestsGameplayDebuggerCategory_Attributes::PrintLine(FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	LineBuffer.Reset();
+	LineBuffer.Append(LineBuilder.GetData(), LineBuilder.Len());
+	CanvasContext.Print(LineBuffer);
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
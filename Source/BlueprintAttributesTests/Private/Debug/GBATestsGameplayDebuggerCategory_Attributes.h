@@ -0,0 +1,50 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+#include "GBATestsAttributeDebugData.h"
+#include "Misc/StringBuilder.h"
+
+class APlayerController;
+
+/**
+ * Gameplay Debugger category listing every attribute of the debug actor's Blueprint Attribute Sets,
+ * with Base / Current values, clamp range (from DataTable metadata) and active modifier count.
+ *
+ * Collected on the server and replicated through a compact data pack. Rendering reuses the same
+ * builder / line buffer every frame, and names come from the per class layout cache.
+ */
+class FGBATestsGameplayDebuggerCategory_Attributes : public FGameplayDebuggerCategory
+{
+public:
+	FGBATestsGameplayDebuggerCategory_Attributes();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+	struct FRepData
+	{
+		FGBATestsAttributeDebugData Data;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	FRepData DataPack;
+
+private:
+	TStringBuilder<256> LineBuilder;
+
+	/** Canvas printing only takes FString, this one keeps its allocation between lines and frames */
+	FString LineBuffer;
+
+	void PrintLine(FGameplayDebuggerCanvasContext& CanvasContext);
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
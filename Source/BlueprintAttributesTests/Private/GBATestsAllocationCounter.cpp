@@ -0,0 +1,237 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAllocationCounter.h"
+
+#include "GBATestsLog.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/ScopeLock.h"
+
+namespace GBATestsAllocationCounter
+{
+	thread_local uint64 NumAllocations = 0;
+	thread_local uint64 NumBytes = 0;
+	thread_local int64 NumRetainedBytes = 0;
+
+	/** Forwards everything to the wrapped allocator, counting allocations of the calling thread */
+	class FMallocCountingProxy final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+
+		static void Count(const SIZE_T InSize)
+		{
+			++NumAllocations;
+			NumBytes += InSize;
+		}
+
+		/** Actual (allocator quantized) size of InPtr, 0 if unknown (see IsRetainedSizeSupported()) */
+		SIZE_T GetRetainedSize(void* InPtr) const
+		{
+			SIZE_T Size = 0;
+			return InPtr && Inner->GetAllocationSize(InPtr, Size) ? Size : 0;
+		}
+
+		virtual void* Malloc(const SIZE_T Count, const uint32 Alignment) override
+		{
+			FMallocCountingProxy::Count(Count);
+			void* Result = Inner->Malloc(Count, Alignment);
+			NumRetainedBytes += GetRetainedSize(Result);
+			return Result;
+		}
+
+		virtual void* TryMalloc(const SIZE_T Count, const uint32 Alignment) override
+		{
+			FMallocCountingProxy::Count(Count);
+			void* Result = Inner->TryMalloc(Count, Alignment);
+			NumRetainedBytes += GetRetainedSize(Result);
+			return Result;
+		}
+
+		virtual void* Realloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				FMallocCountingProxy::Count(Count);
+			}
+			NumRetainedBytes -= GetRetainedSize(Original);
+			void* Result = Inner->Realloc(Original, Count, Alignment);
+			NumRetainedBytes += GetRetainedSize(Result);
+			return Result;
+		}
+
+		virtual void* TryRealloc(void* Original, const SIZE_T Count, const uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				FMallocCountingProxy::Count(Count);
+			}
+			const SIZE_T OriginalSize = GetRetainedSize(Original);
+			void* Result = Inner->TryRealloc(Original, Count, Alignment);
+			if (Result || Count == 0)
+			{
+				NumRetainedBytes += static_cast<int64>(GetRetainedSize(Result)) - static_cast<int64>(OriginalSize);
+			}
+			return Result;
+		}
+
+		virtual void Free(void* Original) override
+		{
+			NumRetainedBytes -= GetRetainedSize(Original);
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(const SIZE_T Count, const uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(const bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual void UpdateStats() override
+		{
+			Inner->UpdateStats();
+		}
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			Inner->GetAllocatorStats(OutStats);
+		}
+
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+		{
+			Inner->DumpAllocatorStats(Ar);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return Inner->GetDescriptiveName();
+		}
+	};
+
+	/** Never destroyed, threads that read GMalloc before it was restored may still call into it */
+	FMallocCountingProxy Proxy;
+	FCriticalSection InstallCriticalSection;
+	int32 NumInstalls = 0;
+
+	void Install()
+	{
+		FScopeLock Lock(&InstallCriticalSection);
+		if (NumInstalls++ == 0)
+		{
+			Proxy.Inner = GMalloc;
+			FPlatformMisc::MemoryBarrier();
+			GMalloc = &Proxy;
+		}
+	}
+
+	void Uninstall()
+	{
+		FScopeLock Lock(&InstallCriticalSection);
+		if (--NumInstalls == 0)
+		{
+			GMalloc = Proxy.Inner;
+		}
+	}
+}
+
+FGBATestsScopedAllocationCounter::FGBATestsScopedAllocationCounter()
+{
+	GBATestsAllocationCounter::Install();
+	Reset();
+}
+
+FGBATestsScopedAllocationCounter::~FGBATestsScopedAllocationCounter()
+{
+	GBATestsAllocationCounter::Uninstall();
+}
+
+uint64 FGBATestsScopedAllocationCounter::GetNum() const
+{
+	return GBATestsAllocationCounter::NumAllocations - StartNum;
+}
+
+uint64 FGBATestsScopedAllocationCounter::GetNumBytes() const
+{
+	return GBATestsAllocationCounter::NumBytes - StartNumBytes;
+}
+
+int64 FGBATestsScopedAllocationCounter::GetNumRetainedBytes() const
+{
+	return GBATestsAllocationCounter::NumRetainedBytes - StartNumRetainedBytes;
+}
+
+void FGBATestsScopedAllocationCounter::Reset()
+{
+	StartNum = GBATestsAllocationCounter::NumAllocations;
+	StartNumBytes = GBATestsAllocationCounter::NumBytes;
+	StartNumRetainedBytes = GBATestsAllocationCounter::NumRetainedBytes;
+}
+
+bool FGBATestsScopedAllocationCounter::IsSupported()
+{
+	static const bool bSupported = []()
+	{
+		const FGBATestsScopedAllocationCounter Counter;
+		void* Probe = FMemory::Malloc(16);
+		const bool bCounted = Counter.GetNum() > 0;
+		FMemory::Free(Probe);
+
+		if (!bCounted)
+		{
+			GBA_TESTS_LOG(Warning, TEXT("FGBATestsScopedAllocationCounter - FMemory doesn't go through GMalloc on this platform, allocations can't be counted"))
+		}
+		return bCounted;
+	}();
+	return bSupported;
+}
+
+bool FGBATestsScopedAllocationCounter::IsRetainedSizeSupported()
+{
+	static const bool bSupported = []()
+	{
+		if (!IsSupported())
+		{
+			return false;
+		}
+
+		const FGBATestsScopedAllocationCounter Counter;
+		void* Probe = FMemory::Malloc(16);
+		const bool bRetained = Counter.GetNumRetainedBytes() > 0;
+		FMemory::Free(Probe);
+
+		if (!bRetained)
+		{
+			GBA_TESTS_LOG(Warning, TEXT("FGBATestsScopedAllocationCounter - %s can't tell allocation sizes, retained bytes can't be counted"), GMalloc->GetDescriptiveName())
+		}
+		return bRetained;
+	}();
+	return bSupported;
+}
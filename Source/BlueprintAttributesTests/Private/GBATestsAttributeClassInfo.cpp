@@ -0,0 +1,158 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeClassInfo.h"
+
+#include "GBATestsBakedAttributeInit.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utils/GBAUtils.h"
+
+namespace GBATestsAttributeClassInfo
+{
+	/** Keyed by TObjectKey so that a reinstanced / GC'd class never aliases a new one */
+	static TMap<TObjectKey<UClass>, TUniquePtr<FGBATestsAttributeClassInfo>> Infos;
+
+	static FDelegateHandle PostGarbageCollectHandle;
+#if WITH_EDITOR
+	static FDelegateHandle ObjectsReinstancedHandle;
+#endif
+
+	/** Drops infos of collected classes */
+	static void HandlePostGarbageCollect()
+	{
+		for (auto It = Infos.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+#if WITH_EDITOR
+	/** Blueprint compilation relinks classes in place with new properties, and reinstances their CDO and instances */
+	static void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& InOldToNewObjects)
+	{
+		for (const TPair<UObject*, UObject*>& Pair : InOldToNewObjects)
+		{
+			for (const UObject* Object : { Pair.Key, Pair.Value })
+			{
+				if (Object)
+				{
+					const UClass* Class = Cast<UClass>(Object);
+					FGBATestsAttributeClassInfo::Remove(Class ? Class : Object->GetClass());
+				}
+			}
+		}
+	}
+#endif
+}
+
+int32 FGBATestsAttributeClassInfo::FindIndex(const FName& InAttributeName) const
+{
+	const int32* Index = IndexByName.Find(InAttributeName);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FGBATestsAttributeClassInfo* FGBATestsAttributeClassInfo::FindOrAdd(const UClass* InClass)
+{
+	check(IsInGameThread());
+	if (!InClass)
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<UClass> Key(InClass);
+	if (const TUniquePtr<FGBATestsAttributeClassInfo>* Existing = GBATestsAttributeClassInfo::Infos.Find(Key))
+	{
+		return Existing->Get();
+	}
+
+	TUniquePtr<FGBATestsAttributeClassInfo> Info = MakeUnique<FGBATestsAttributeClassInfo>();
+	Info->bIsBlueprintAttributeSet = InClass->IsChildOf(UGBAAttributeSetBlueprintBase::StaticClass());
+	Info->LayoutHash = UGBATestsBakedAttributeInit::GetAttributeProperties(InClass, Info->Properties);
+
+	// Blueprint attribute sets look up rows without the _C suffix of their class name
+	const int32 NumProperties = Info->Properties.Num();
+	Info->RowNames.Reserve(NumProperties);
+	Info->IndexByName.Reserve(NumProperties);
+
+	for (int32 Index = 0; Index < NumProperties; ++Index)
+	{
+		const FProperty* Property = Info->Properties[Index];
+		const UClass* OwnerClass = Property->GetOwnerClass();
+		const FString SetName = Info->bIsBlueprintAttributeSet ? FGBAUtils::GetAttributeClassName(OwnerClass) : OwnerClass->GetName();
+
+		Info->RowNames.Add(FName(*FString::Printf(TEXT("%s.%s"), *SetName, *Property->GetName())));
+		Info->IndexByName.Add(Property->GetFName(), Index);
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (Info->bIsBlueprintAttributeSet && StructProperty && StructProperty->Struct->IsChildOf(FGBAGameplayClampedAttributeData::StaticStruct()))
+		{
+			Info->ClampedIndices.Add(Index);
+		}
+	}
+
+	Info->SetName = Info->bIsBlueprintAttributeSet ? FGBAUtils::GetAttributeClassName(InClass) : InClass->GetName();
+	return GBATestsAttributeClassInfo::Infos.Add(Key, MoveTemp(Info)).Get();
+}
+
+const FGBATestsAttributeClassInfo* FGBATestsAttributeClassInfo::Find(const UClass* InClass)
+{
+	check(IsInGameThread());
+	const TUniquePtr<FGBATestsAttributeClassInfo>* Existing = InClass ? GBATestsAttributeClassInfo::Infos.Find(TObjectKey<UClass>(InClass)) : nullptr;
+	return Existing ? Existing->Get() : nullptr;
+}
+
+int32 FGBATestsAttributeClassInfo::GetNum()
+{
+	return GBATestsAttributeClassInfo::Infos.Num();
+}
+
+void FGBATestsAttributeClassInfo::Remove(const UClass* InClass)
+{
+	check(IsInGameThread());
+	if (InClass)
+	{
+		GBATestsAttributeClassInfo::Infos.Remove(TObjectKey<UClass>(InClass));
+	}
+}
+
+void FGBATestsAttributeClassInfo::Reset()
+{
+	check(IsInGameThread());
+	GBATestsAttributeClassInfo::Infos.Reset();
+}
+
+void FGBATestsAttributeClassInfo::Initialize()
+{
+	using namespace GBATestsAttributeClassInfo;
+
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&HandlePostGarbageCollect);
+	}
+
+#if WITH_EDITOR
+	if (!ObjectsReinstancedHandle.IsValid())
+	{
+		ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddStatic(&HandleObjectsReinstanced);
+	}
+#endif
+}
+
+void FGBATestsAttributeClassInfo::Shutdown()
+{
+	using namespace GBATestsAttributeClassInfo;
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#endif
+
+	Infos.Reset();
+}
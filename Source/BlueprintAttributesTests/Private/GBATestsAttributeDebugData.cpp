@@ -0,0 +1,379 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeDebugData.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utils/GBAUtils.h"
+
+namespace GBATestsAttributeDebugData
+{
+	/**
+	 * Layouts are keyed by TObjectKey (weak) so that a reinstanced / GC'd class never aliases a new one, and dropped
+	 * once their class is collected
+	 */
+	static TMap<TObjectKey<UClass>, TUniquePtr<FGBATestsAttributeDebugLayout>> Layouts;
+
+	static FDelegateHandle PostGarbageCollectHandle;
+#if WITH_EDITOR
+	static FDelegateHandle ObjectsReinstancedHandle;
+#endif
+
+	static constexpr uint8 Flag_HasClampRange = 1 << 0;
+
+	/** Smallest serialized size of a set (class path, packed entry count) */
+	static constexpr int64 MinSerializedSetSize = 2;
+
+	/** Smallest serialized size of an entry (flags, base and current values, modifier count) */
+	static constexpr int64 MinSerializedEntrySize = sizeof(uint8) + 2 * sizeof(float) + sizeof(uint16);
+
+	/** Whether InCount elements of at least InMinSize bytes each fit in what is left to read (unknown sizes always fit) */
+	static bool CanRead(FArchive& Ar, const uint32 InCount, const int64 InMinSize)
+	{
+		const int64 TotalSize = Ar.TotalSize();
+		return TotalSize < 0 || static_cast<int64>(InCount) * InMinSize <= TotalSize - Ar.Tell();
+	}
+
+	/** Drops layouts of collected classes */
+	static void HandlePostGarbageCollect()
+	{
+		for (auto It = Layouts.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+#if WITH_EDITOR
+	/** Blueprint compilation relinks classes in place, leaving cached FGameplayAttribute properties dangling */
+	static void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& InOldToNewObjects)
+	{
+		for (const TPair<UObject*, UObject*>& Pair : InOldToNewObjects)
+		{
+			for (const UObject* Object : { Pair.Key, Pair.Value })
+			{
+				if (const UClass* Class = Cast<UClass>(Object))
+				{
+					Layouts.Remove(TObjectKey<UClass>(Class));
+				}
+			}
+		}
+	}
+#endif
+}
+
+const FGBATestsAttributeDebugLayout* FGBATestsAttributeDebugLayout::FindOrAdd(const UClass* InClass)
+{
+	check(IsInGameThread());
+	if (!InClass)
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<UClass> Key(InClass);
+	if (const TUniquePtr<FGBATestsAttributeDebugLayout>* Existing = GBATestsAttributeDebugData::Layouts.Find(Key))
+	{
+		return Existing->Get();
+	}
+
+	TUniquePtr<FGBATestsAttributeDebugLayout> Layout = MakeUnique<FGBATestsAttributeDebugLayout>();
+	Layout->SetName = FGBAUtils::GetAttributeClassName(InClass);
+
+	for (TFieldIterator<FProperty> It(InClass); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (!FGBAUtils::IsValidProperty(Property))
+		{
+			continue;
+		}
+
+		Layout->Attributes.Add(FGameplayAttribute(Property));
+		Layout->AttributeNames.Add(Property->GetName());
+	}
+
+	return GBATestsAttributeDebugData::Layouts.Add(Key, MoveTemp(Layout)).Get();
+}
+
+int32 FGBATestsAttributeDebugLayout::GetNum()
+{
+	return GBATestsAttributeDebugData::Layouts.Num();
+}
+
+void FGBATestsAttributeDebugLayout::Initialize()
+{
+	using namespace GBATestsAttributeDebugData;
+
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&HandlePostGarbageCollect);
+	}
+
+#if WITH_EDITOR
+	if (!ObjectsReinstancedHandle.IsValid())
+	{
+		ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddStatic(&HandleObjectsReinstanced);
+	}
+#endif
+}
+
+void FGBATestsAttributeDebugLayout::Shutdown()
+{
+	using namespace GBATestsAttributeDebugData;
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#endif
+
+	Layouts.Reset();
+}
+
+void FGBATestsAttributeDebugData::Collect(const UAbilitySystemComponent* InASC)
+{
+	Reset();
+
+	if (!InASC)
+	{
+		return;
+	}
+
+	// Count modifiers of active effects once, rather than once per attribute
+	ModifierCounts.Reset();
+	for (FActiveGameplayEffectsContainer::ConstIterator It = InASC->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+	{
+		const FActiveGameplayEffect& ActiveEffect = *It;
+		if (ActiveEffect.bIsInhibited || !ActiveEffect.Spec.Def)
+		{
+			continue;
+		}
+
+		for (const FGameplayModifierInfo& Modifier : ActiveEffect.Spec.Def->Modifiers)
+		{
+			ModifierCounts.FindOrAdd(Modifier.Attribute)++;
+		}
+	}
+
+	for (UAttributeSet* AttributeSet : InASC->GetSpawnedAttributes())
+	{
+		UGBAAttributeSetBlueprintBase* BlueprintSet = Cast<UGBAAttributeSetBlueprintBase>(AttributeSet);
+		if (!BlueprintSet)
+		{
+			continue;
+		}
+
+		const FGBATestsAttributeDebugLayout* Layout = FGBATestsAttributeDebugLayout::FindOrAdd(BlueprintSet->GetClass());
+		if (!Layout)
+		{
+			continue;
+		}
+
+		FGBATestsAttributeDebugSet& Set = Sets.AddDefaulted_GetRef();
+		Set.Class = BlueprintSet->GetClass();
+		Set.FirstEntry = Entries.Num();
+		Set.NumEntries = Layout->Attributes.Num();
+
+		const auto& MetaDataMap = BlueprintSet->GetAttributesMetaData();
+
+		for (int32 Index = 0; Index < Layout->Attributes.Num(); ++Index)
+		{
+			const FGameplayAttribute& Attribute = Layout->Attributes[Index];
+
+			FGBATestsAttributeDebugEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.BaseValue = InASC->GetNumericAttributeBase(Attribute);
+			Entry.CurrentValue = InASC->GetNumericAttribute(Attribute);
+
+			if (const uint16* Count = ModifierCounts.Find(Attribute))
+			{
+				Entry.ModifierCount = *Count;
+			}
+
+			if (const TSharedPtr<FAttributeMetaData>* MetaData = MetaDataMap.Find(Layout->AttributeNames[Index]))
+			{
+				if (MetaData->IsValid())
+				{
+					Entry.bHasClampRange = true;
+					Entry.MinValue = (*MetaData)->MinValue;
+					Entry.MaxValue = (*MetaData)->MaxValue;
+				}
+			}
+		}
+	}
+}
+
+void FGBATestsAttributeDebugData::Reset()
+{
+	Sets.Reset();
+	Entries.Reset();
+}
+
+void FGBATestsAttributeDebugData::Serialize(FArchive& Ar)
+{
+	uint32 NumSets = Sets.Num();
+	Ar.SerializeIntPacked(NumSets);
+
+	if (Ar.IsLoading())
+	{
+		Reset();
+
+		// Counts come off the wire, never allocate for more than the archive can hold
+		if (Ar.IsError() || !GBATestsAttributeDebugData::CanRead(Ar, NumSets, GBATestsAttributeDebugData::MinSerializedSetSize))
+		{
+			Ar.SetError();
+			return;
+		}
+
+		Sets.SetNum(NumSets);
+	}
+
+	for (FGBATestsAttributeDebugSet& Set : Sets)
+	{
+		// Class path is the only string on the wire, attribute names are resolved from the layout on the receiving end
+		FSoftClassPath ClassPath;
+		if (Ar.IsSaving())
+		{
+			ClassPath = FSoftClassPath(Set.Class.Get());
+		}
+
+		Ar << ClassPath;
+
+		uint32 NumEntries = Set.NumEntries;
+		Ar.SerializeIntPacked(NumEntries);
+
+		if (Ar.IsLoading())
+		{
+			if (Ar.IsError() || !GBATestsAttributeDebugData::CanRead(Ar, NumEntries, GBATestsAttributeDebugData::MinSerializedEntrySize))
+			{
+				Ar.SetError();
+				Reset();
+				return;
+			}
+
+			Set.Class = ClassPath.ResolveClass();
+			Set.FirstEntry = Entries.Num();
+			Set.NumEntries = NumEntries;
+			Entries.AddDefaulted(NumEntries);
+		}
+
+		for (int32 Index = Set.FirstEntry; Index < Set.FirstEntry + Set.NumEntries; ++Index)
+		{
+			FGBATestsAttributeDebugEntry& Entry = Entries[Index];
+
+			uint8 Flags = Entry.bHasClampRange ? GBATestsAttributeDebugData::Flag_HasClampRange : 0;
+			Ar << Flags;
+			Ar << Entry.BaseValue;
+			Ar << Entry.CurrentValue;
+			Ar << Entry.ModifierCount;
+
+			Entry.bHasClampRange = (Flags & GBATestsAttributeDebugData::Flag_HasClampRange) != 0;
+			if (Entry.bHasClampRange)
+			{
+				Ar << Entry.MinValue;
+				Ar << Entry.MaxValue;
+			}
+		}
+
+		if (Ar.IsLoading() && Ar.IsError())
+		{
+			Reset();
+			return;
+		}
+	}
+}
+
+const FString* FGBATestsAttributeDebugData::GetAttributeName(const FGBATestsAttributeDebugSet& InSet, const int32 InEntryIndex) const
+{
+	const FGBATestsAttributeDebugLayout* Layout = FGBATestsAttributeDebugLayout::FindOrAdd(InSet.Class.Get());
+	if (!Layout || !Layout->AttributeNames.IsValidIndex(InEntryIndex))
+	{
+		return nullptr;
+	}
+
+	return &Layout->AttributeNames[InEntryIndex];
+}
+
+void FGBATestsAttributeDebugData::FormatEntry(const FGBATestsAttributeDebugSet& InSet, const int32 InEntryIndex, FStringBuilderBase& OutBuilder) const
+{
+	const int32 EntryIndex = InSet.FirstEntry + InEntryIndex;
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	const FGBATestsAttributeDebugEntry& Entry = Entries[EntryIndex];
+
+	const FString* AttributeName = GetAttributeName(InSet, InEntryIndex);
+	OutBuilder.Append(AttributeName ? **AttributeName : TEXT("<unknown>"));
+
+	OutBuilder.Append(TEXT(" Base: "));
+	AppendFixed(OutBuilder, Entry.BaseValue);
+	OutBuilder.Append(TEXT(" Current: "));
+	AppendFixed(OutBuilder, Entry.CurrentValue);
+
+	if (Entry.bHasClampRange)
+	{
+		OutBuilder.Append(TEXT(" ["));
+		AppendFixed(OutBuilder, Entry.MinValue);
+		OutBuilder.Append(TEXT(", "));
+		AppendFixed(OutBuilder, Entry.MaxValue);
+		OutBuilder.Append(TEXT("]"));
+	}
+
+	OutBuilder.Append(TEXT(" Mods: "));
+	AppendInteger(OutBuilder, Entry.ModifierCount);
+}
+
+void FGBATestsAttributeDebugData::AppendFixed(FStringBuilderBase& OutBuilder, const float InValue)
+{
+	if (FMath::IsNaN(InValue))
+	{
+		OutBuilder.Append(TEXT("nan"));
+		return;
+	}
+
+	double Value = InValue;
+	if (Value < 0.0)
+	{
+		OutBuilder.AppendChar(TEXT('-'));
+		Value = -Value;
+	}
+
+	// Anything above that is not meaningful for an attribute debug display
+	constexpr double MaxDisplayValue = 1e15;
+	if (Value >= MaxDisplayValue)
+	{
+		OutBuilder.Append(TEXT("inf"));
+		return;
+	}
+
+	const uint64 Scaled = static_cast<uint64>(FMath::RoundHalfFromZero(Value * 100.0));
+	const uint32 Fraction = static_cast<uint32>(Scaled % 100);
+
+	AppendInteger(OutBuilder, Scaled / 100);
+	OutBuilder.AppendChar(TEXT('.'));
+	OutBuilder.AppendChar(static_cast<TCHAR>(TEXT('0') + Fraction / 10));
+	OutBuilder.AppendChar(static_cast<TCHAR>(TEXT('0') + Fraction % 10));
+}
+
+void FGBATestsAttributeDebugData::AppendInteger(FStringBuilderBase& OutBuilder, uint64 InValue)
+{
+	// Digits are written backward into a small stack buffer
+	TCHAR Digits[24];
+	int32 Cursor = UE_ARRAY_COUNT(Digits);
+	do
+	{
+		Digits[--Cursor] = static_cast<TCHAR>(TEXT('0') + InValue % 10);
+		InValue /= 10;
+	}
+	while (InValue > 0);
+
+	OutBuilder.Append(Digits + Cursor, UE_ARRAY_COUNT(Digits) - Cursor);
+}
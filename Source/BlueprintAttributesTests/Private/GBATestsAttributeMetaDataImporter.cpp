@@ -0,0 +1,715 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeMetaDataImporter.h"
+
+#include "AttributeSet.h"
+#include "Engine/DataTable.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/UObjectIterator.h"
+#include "Utils/GBAUtils.h"
+
+namespace GBATestsAttributeMetaDataImporter
+{
+	/** Exact powers of ten representable as doubles */
+	static constexpr double PowersOfTen[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	template <typename CharType>
+	static bool IsBlank(const CharType InChar)
+	{
+		return InChar == ' ' || InChar == '\t' || InChar == '\r';
+	}
+
+	template <typename CharType>
+	static void Trim(const CharType*& InOutBegin, const CharType*& InOutEnd)
+	{
+		while (InOutBegin < InOutEnd && IsBlank(*InOutBegin))
+		{
+			++InOutBegin;
+		}
+
+		while (InOutEnd > InOutBegin && IsBlank(*(InOutEnd - 1)))
+		{
+			--InOutEnd;
+		}
+	}
+
+	/** A cell pointing into the line being parsed. Escaped cells still hold their doubled quotes. */
+	template <typename CharType>
+	struct TCell
+	{
+		TStringView<CharType> View;
+		bool bEscaped = false;
+	};
+
+	/** Reads the cell starting at InOutIt, and leaves InOutIt on the following comma (or InEnd). Returns false for malformed quoted cells. */
+	template <typename CharType>
+	static bool ReadCell(const CharType*& InOutIt, const CharType* InEnd, TCell<CharType>& OutCell)
+	{
+		while (InOutIt < InEnd && IsBlank(*InOutIt))
+		{
+			++InOutIt;
+		}
+
+		OutCell.bEscaped = false;
+
+		if (InOutIt < InEnd && *InOutIt == '"')
+		{
+			const CharType* Start = ++InOutIt;
+			for (;;)
+			{
+				if (InOutIt == InEnd)
+				{
+					return false;
+				}
+
+				if (*InOutIt == '"')
+				{
+					if (InOutIt + 1 < InEnd && *(InOutIt + 1) == '"')
+					{
+						OutCell.bEscaped = true;
+						InOutIt += 2;
+						continue;
+					}
+					break;
+				}
+
+				++InOutIt;
+			}
+
+			OutCell.View = TStringView<CharType>(Start, UE_PTRDIFF_TO_INT32(InOutIt - Start));
+			++InOutIt;
+
+			while (InOutIt < InEnd && IsBlank(*InOutIt))
+			{
+				++InOutIt;
+			}
+
+			return InOutIt == InEnd || *InOutIt == ',';
+		}
+
+		const CharType* Start = InOutIt;
+		while (InOutIt < InEnd && *InOutIt != ',')
+		{
+			++InOutIt;
+		}
+
+		const CharType* End = InOutIt;
+		Trim(Start, End);
+		OutCell.View = TStringView<CharType>(Start, UE_PTRDIFF_TO_INT32(End - Start));
+		return true;
+	}
+
+	static FString ToString(const TStringView<TCHAR> InView)
+	{
+		return FString(InView.Len(), InView.GetData());
+	}
+
+	static FString ToString(const TStringView<ANSICHAR> InView)
+	{
+		// Files are read as UTF-8
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(InView.GetData()), InView.Len());
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+	template <typename CharType>
+	static FString ToString(const TCell<CharType>& InCell)
+	{
+		FString String = ToString(InCell.View);
+		if (InCell.bEscaped)
+		{
+			String.ReplaceInline(TEXT("\"\""), TEXT("\""), ESearchCase::CaseSensitive);
+		}
+		return String;
+	}
+
+	static FName ToName(const TStringView<TCHAR> InView)
+	{
+		return FName(InView.Len(), InView.GetData());
+	}
+
+	static FName ToName(const TStringView<ANSICHAR> InView)
+	{
+		for (const ANSICHAR Char : InView)
+		{
+			if (static_cast<uint8>(Char) > 0x7f)
+			{
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(InView.GetData()), InView.Len());
+				return FName(Converted.Length(), Converted.Get());
+			}
+		}
+
+		return FName(InView.Len(), InView.GetData());
+	}
+
+	template <typename CharType>
+	static bool EqualsIgnoreCase(const TStringView<CharType> InView, const ANSICHAR* InLiteral)
+	{
+		int32 Index = 0;
+		for (; InLiteral[Index] != '\0'; ++Index)
+		{
+			if (Index >= InView.Len() || TChar<CharType>::ToLower(InView[Index]) != static_cast<CharType>(InLiteral[Index]))
+			{
+				return false;
+			}
+		}
+		return Index == InView.Len();
+	}
+
+	/**
+	 * Parses a decimal number. Values with at most 15 significant digits and a small exponent are computed exactly
+	 * in double precision (same result as Atof), anything else goes through FCString::Atod().
+	 */
+	template <typename CharType>
+	static bool ParseFloat(const TStringView<CharType> InView, float& OutValue)
+	{
+		const CharType* It = InView.GetData();
+		const CharType* End = It + InView.Len();
+		if (It == End)
+		{
+			return false;
+		}
+
+		const bool bNegative = *It == '-';
+		if (*It == '-' || *It == '+')
+		{
+			++It;
+		}
+
+		uint64 Mantissa = 0;
+		int32 NumSignificantDigits = 0;
+		int32 NumDigits = 0;
+		int32 Exponent = 0;
+
+		const auto AddDigit = [&Mantissa, &NumSignificantDigits, &NumDigits](const int32 InDigit)
+		{
+			++NumDigits;
+			if (Mantissa == 0 && InDigit == 0)
+			{
+				return;
+			}
+
+			// Past 19 digits the mantissa would overflow, fall back to Atod() anyway
+			if (++NumSignificantDigits <= 19)
+			{
+				Mantissa = Mantissa * 10 + InDigit;
+			}
+		};
+
+		for (; It < End && TChar<CharType>::IsDigit(*It); ++It)
+		{
+			AddDigit(*It - '0');
+		}
+
+		if (It < End && *It == '.')
+		{
+			for (++It; It < End && TChar<CharType>::IsDigit(*It); ++It)
+			{
+				AddDigit(*It - '0');
+				--Exponent;
+			}
+		}
+
+		if (NumDigits == 0)
+		{
+			return false;
+		}
+
+		if (It < End && (*It == 'e' || *It == 'E'))
+		{
+			++It;
+			const bool bNegativeExponent = It < End && *It == '-';
+			if (It < End && (*It == '-' || *It == '+'))
+			{
+				++It;
+			}
+
+			if (It == End || !TChar<CharType>::IsDigit(*It))
+			{
+				return false;
+			}
+
+			int32 ExplicitExponent = 0;
+			for (; It < End && TChar<CharType>::IsDigit(*It); ++It)
+			{
+				ExplicitExponent = FMath::Min(ExplicitExponent * 10 + (*It - '0'), 100000);
+			}
+			Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+		}
+
+		if (It != End)
+		{
+			return false;
+		}
+
+		double Value;
+		if (NumSignificantDigits <= 15 && FMath::Abs(Exponent) <= 22)
+		{
+			Value = static_cast<double>(Mantissa);
+			Value = Exponent < 0 ? Value / PowersOfTen[-Exponent] : Value * PowersOfTen[Exponent];
+			Value = bNegative ? -Value : Value;
+		}
+		else
+		{
+			TCHAR Buffer[128];
+			if (InView.Len() >= static_cast<int32>(UE_ARRAY_COUNT(Buffer)))
+			{
+				return false;
+			}
+
+			for (int32 Index = 0; Index < InView.Len(); ++Index)
+			{
+				Buffer[Index] = static_cast<TCHAR>(InView[Index]);
+			}
+			Buffer[InView.Len()] = TEXT('\0');
+			Value = FCString::Atod(Buffer);
+		}
+
+		OutValue = static_cast<float>(Value);
+		return true;
+	}
+
+	template <typename CharType>
+	static bool ParseBool(const TStringView<CharType> InView, bool& OutValue)
+	{
+		if (EqualsIgnoreCase(InView, "true") || EqualsIgnoreCase(InView, "yes") || EqualsIgnoreCase(InView, "1"))
+		{
+			OutValue = true;
+			return true;
+		}
+
+		if (EqualsIgnoreCase(InView, "false") || EqualsIgnoreCase(InView, "no") || EqualsIgnoreCase(InView, "0"))
+		{
+			OutValue = false;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+FGBATestsAttributeMetaDataImporter::FGBATestsAttributeMetaDataImporter(const bool bInValidateRowNames)
+	: bValidateRowNames(bInValidateRowNames)
+{
+}
+
+void FGBATestsAttributeMetaDataImporter::AddKnownAttribute(const FString& InSetName, const FString& InAttributeName)
+{
+	KnownRowNames.Add(FName(*FString::Printf(TEXT("%s.%s"), *InSetName, *InAttributeName)));
+	KnownSetNames.Add(FName(*InSetName));
+}
+
+void FGBATestsAttributeMetaDataImporter::AddLoadedAttributeSets()
+{
+	check(IsInGameThread());
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		const UClass* Class = *It;
+		if (!FGBAUtils::IsValidAttributeClass(Class))
+		{
+			continue;
+		}
+
+		const FString SetName = FGBAUtils::GetAttributeClassName(Class);
+		for (TFieldIterator<FProperty> PropertyIt(Class, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+		{
+			if (FGBAUtils::IsValidProperty(*PropertyIt))
+			{
+				AddKnownAttribute(SetName, PropertyIt->GetName());
+			}
+		}
+	}
+}
+
+bool FGBATestsAttributeMetaDataImporter::ImportString(const FStringView InCsv, const FOnRow InOnRow)
+{
+	Reset();
+
+	const TCHAR* Begin = InCsv.GetData();
+	const TCHAR* End = Begin + InCsv.Len();
+	if (Begin < End && *Begin == TEXT('\xFEFF'))
+	{
+		++Begin;
+	}
+
+	ParseLines(Begin, End, true, InOnRow);
+	if (!bHasHeader)
+	{
+		AddError(LineNumber, TEXT("Missing header"));
+	}
+
+	return !Result.HasErrors();
+}
+
+bool FGBATestsAttributeMetaDataImporter::ImportFile(const FString& InFilename, const FOnRow InOnRow)
+{
+	Reset();
+
+	const TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*InFilename));
+	if (!Handle)
+	{
+		AddError(0, FString::Printf(TEXT("Unable to open %s"), *InFilename));
+		return false;
+	}
+
+	TArray<ANSICHAR> Buffer;
+	Buffer.SetNumUninitialized(ChunkSize);
+
+	int64 NumRemainingBytes = Handle->Size();
+	int32 NumPendingBytes = 0;
+	bool bFirstChunk = true;
+
+	while (NumRemainingBytes > 0)
+	{
+		// A single line doesn't fit, make room for it
+		if (NumPendingBytes == Buffer.Num())
+		{
+			Buffer.SetNumUninitialized(Buffer.Num() * 2);
+		}
+
+		const int32 NumBytesToRead = static_cast<int32>(FMath::Min<int64>(NumRemainingBytes, Buffer.Num() - NumPendingBytes));
+		if (!Handle->Read(reinterpret_cast<uint8*>(Buffer.GetData() + NumPendingBytes), NumBytesToRead))
+		{
+			AddError(LineNumber, FString::Printf(TEXT("Failed to read %s"), *InFilename));
+			return false;
+		}
+
+		NumPendingBytes += NumBytesToRead;
+		NumRemainingBytes -= NumBytesToRead;
+
+		const ANSICHAR* Begin = Buffer.GetData();
+		const ANSICHAR* End = Begin + NumPendingBytes;
+
+		if (bFirstChunk)
+		{
+			bFirstChunk = false;
+			if (NumPendingBytes >= 3 && static_cast<uint8>(Begin[0]) == 0xEF && static_cast<uint8>(Begin[1]) == 0xBB && static_cast<uint8>(Begin[2]) == 0xBF)
+			{
+				Begin += 3;
+			}
+		}
+
+		const ANSICHAR* Pending = ParseLines(Begin, End, NumRemainingBytes == 0, InOnRow);
+
+		NumPendingBytes = UE_PTRDIFF_TO_INT32(End - Pending);
+		if (NumPendingBytes > 0 && Pending != Buffer.GetData())
+		{
+			FMemory::Memmove(Buffer.GetData(), Pending, NumPendingBytes);
+		}
+	}
+
+	if (!bHasHeader)
+	{
+		AddError(LineNumber, TEXT("Missing header"));
+	}
+
+	return !Result.HasErrors();
+}
+
+bool FGBATestsAttributeMetaDataImporter::ImportString(const FStringView InCsv, UDataTable* InDataTable)
+{
+	if (!CheckDataTable(InDataTable))
+	{
+		Reset();
+		AddError(0, TEXT("DataTable is invalid or does not use a FAttributeMetaData row struct"));
+		return false;
+	}
+
+	InDataTable->EmptyTable();
+	return ImportString(InCsv, [InDataTable](const FName& InRowName, const FAttributeMetaData& InRow)
+	{
+		InDataTable->AddRow(InRowName, InRow);
+	});
+}
+
+bool FGBATestsAttributeMetaDataImporter::ImportFile(const FString& InFilename, UDataTable* InDataTable)
+{
+	if (!CheckDataTable(InDataTable))
+	{
+		Reset();
+		AddError(0, TEXT("DataTable is invalid or does not use a FAttributeMetaData row struct"));
+		return false;
+	}
+
+	InDataTable->EmptyTable();
+	return ImportFile(InFilename, [InDataTable](const FName& InRowName, const FAttributeMetaData& InRow)
+	{
+		InDataTable->AddRow(InRowName, InRow);
+	});
+}
+
+void FGBATestsAttributeMetaDataImporter::Reset()
+{
+	Columns.Reset();
+	bHasHeader = false;
+	LineNumber = 0;
+	SeenRowNames.Reset();
+	Result = FGBATestsAttributeMetaDataImportResult();
+}
+
+void FGBATestsAttributeMetaDataImporter::AddError(const int32 InLine, FString&& InMessage)
+{
+	FGBATestsAttributeMetaDataImportError& Error = Result.Errors.AddDefaulted_GetRef();
+	Error.Line = InLine;
+	Error.Message = MoveTemp(InMessage);
+}
+
+void FGBATestsAttributeMetaDataImporter::AddWarning(const int32 InLine, FString&& InMessage)
+{
+	FGBATestsAttributeMetaDataImportError& Warning = Result.Warnings.AddDefaulted_GetRef();
+	Warning.Line = InLine;
+	Warning.Message = MoveTemp(InMessage);
+}
+
+bool FGBATestsAttributeMetaDataImporter::CheckDataTable(const UDataTable* InDataTable)
+{
+	return IsValid(InDataTable) && InDataTable->GetRowStruct() == FAttributeMetaData::StaticStruct();
+}
+
+template <typename CharType>
+const CharType* FGBATestsAttributeMetaDataImporter::ParseLines(const CharType* InBegin, const CharType* InEnd, const bool bInFinal, const FOnRow InOnRow)
+{
+	const CharType* LineBegin = InBegin;
+	while (LineBegin < InEnd)
+	{
+		// Quoted cells may span several lines
+		const CharType* It = LineBegin;
+		int32 NumNewLines = 0;
+		bool bInQuotes = false;
+		for (; It < InEnd; ++It)
+		{
+			if (*It == '"')
+			{
+				bInQuotes = !bInQuotes;
+			}
+			else if (*It == '\n')
+			{
+				if (!bInQuotes)
+				{
+					break;
+				}
+				++NumNewLines;
+			}
+		}
+
+		if (It == InEnd && !bInFinal)
+		{
+			return LineBegin;
+		}
+
+		++LineNumber;
+		Result.NumLines = LineNumber;
+		ParseLine(LineBegin, It, InOnRow);
+		LineNumber += NumNewLines;
+
+		LineBegin = It < InEnd ? It + 1 : InEnd;
+	}
+
+	return InEnd;
+}
+
+template <typename CharType>
+void FGBATestsAttributeMetaDataImporter::ParseLine(const CharType* InBegin, const CharType* InEnd, const FOnRow InOnRow)
+{
+	GBATestsAttributeMetaDataImporter::Trim(InBegin, InEnd);
+	if (InBegin == InEnd)
+	{
+		return;
+	}
+
+	if (!bHasHeader)
+	{
+		bHasHeader = true;
+		ParseHeader(InBegin, InEnd);
+		return;
+	}
+
+	ParseRow(InBegin, InEnd, InOnRow);
+}
+
+template <typename CharType>
+void FGBATestsAttributeMetaDataImporter::ParseHeader(const CharType* InBegin, const CharType* InEnd)
+{
+	using namespace GBATestsAttributeMetaDataImporter;
+
+	static const TPair<const ANSICHAR*, EColumn> ColumnNames[] = {
+		{ "basevalue", EColumn::BaseValue },
+		{ "minvalue", EColumn::MinValue },
+		{ "maxvalue", EColumn::MaxValue },
+		{ "derivedattributeinfo", EColumn::DerivedAttributeInfo },
+		{ "bcanstack", EColumn::bCanStack },
+	};
+
+	const CharType* It = InBegin;
+	TCell<CharType> Cell;
+
+	for (int32 CellIndex = 0; ; ++CellIndex)
+	{
+		if (!ReadCell(It, InEnd, Cell))
+		{
+			AddError(LineNumber, TEXT("Malformed quoted header cell"));
+			return;
+		}
+
+		// First column holds row names, whatever its title
+		if (CellIndex > 0)
+		{
+			EColumn Column = EColumn::Ignored;
+			for (const TPair<const ANSICHAR*, EColumn>& ColumnName : ColumnNames)
+			{
+				if (EqualsIgnoreCase(Cell.View, ColumnName.Key))
+				{
+					Column = ColumnName.Value;
+					break;
+				}
+			}
+
+			if (Column == EColumn::Ignored)
+			{
+				AddWarning(LineNumber, FString::Printf(TEXT("Unknown column '%s', it will be ignored"), *ToString(Cell)));
+			}
+			else if (Columns.Contains(Column))
+			{
+				AddWarning(LineNumber, FString::Printf(TEXT("Duplicate column '%s', it will be ignored"), *ToString(Cell)));
+				Column = EColumn::Ignored;
+			}
+
+			Columns.Add(Column);
+		}
+
+		if (It == InEnd)
+		{
+			break;
+		}
+		++It;
+	}
+}
+
+template <typename CharType>
+void FGBATestsAttributeMetaDataImporter::ParseRow(const CharType* InBegin, const CharType* InEnd, const FOnRow InOnRow)
+{
+	using namespace GBATestsAttributeMetaDataImporter;
+
+	const CharType* It = InBegin;
+	TCell<CharType> Cell;
+
+	if (!ReadCell(It, InEnd, Cell) || Cell.View.IsEmpty())
+	{
+		AddError(LineNumber, TEXT("Missing row name"));
+		return;
+	}
+
+	const FName RowName = Cell.bEscaped ? FName(*ToString(Cell)) : ToName(Cell.View);
+	if (!ValidateRowName(Cell.View, RowName))
+	{
+		return;
+	}
+
+	FAttributeMetaData Row;
+	int32 NumCells = 1;
+
+	while (It < InEnd)
+	{
+		// Skip the comma
+		++It;
+
+		if (!ReadCell(It, InEnd, Cell))
+		{
+			AddError(LineNumber, FString::Printf(TEXT("Malformed quoted cell in column %d (row '%s')"), NumCells + 1, *RowName.ToString()));
+			return;
+		}
+
+		const int32 ColumnIndex = NumCells++ - 1;
+		if (!Columns.IsValidIndex(ColumnIndex))
+		{
+			AddError(LineNumber, FString::Printf(TEXT("Too many cells, expected %d (row '%s')"), Columns.Num() + 1, *RowName.ToString()));
+			return;
+		}
+
+		const EColumn Column = Columns[ColumnIndex];
+		bool bValid = true;
+
+		// Empty cells keep the struct default, as they do with the DataTable CSV importer
+		if (Column == EColumn::Ignored || (Cell.View.IsEmpty() && Column != EColumn::DerivedAttributeInfo))
+		{
+			continue;
+		}
+
+		switch (Column)
+		{
+		case EColumn::BaseValue:
+			bValid = ParseFloat(Cell.View, Row.BaseValue);
+			break;
+		case EColumn::MinValue:
+			bValid = ParseFloat(Cell.View, Row.MinValue);
+			break;
+		case EColumn::MaxValue:
+			bValid = ParseFloat(Cell.View, Row.MaxValue);
+			break;
+		case EColumn::DerivedAttributeInfo:
+			if (!Cell.View.IsEmpty())
+			{
+				Row.DerivedAttributeInfo = ToString(Cell);
+			}
+			break;
+		case EColumn::bCanStack:
+			bValid = ParseBool(Cell.View, Row.bCanStack);
+			break;
+		default:
+			break;
+		}
+
+		if (!bValid)
+		{
+			AddError(LineNumber, FString::Printf(TEXT("Invalid value '%s' in column %d (row '%s')"), *ToString(Cell), NumCells, *RowName.ToString()));
+			return;
+		}
+	}
+
+	bool bAlreadySeen = false;
+	SeenRowNames.Add(RowName, &bAlreadySeen);
+	if (bAlreadySeen)
+	{
+		AddWarning(LineNumber, FString::Printf(TEXT("Duplicate row '%s', it overrides the previous one"), *RowName.ToString()));
+	}
+
+	++Result.NumRows;
+	InOnRow(RowName, Row);
+}
+
+template <typename CharType>
+bool FGBATestsAttributeMetaDataImporter::ValidateRowName(const TStringView<CharType> InRowName, const FName& InName)
+{
+	using namespace GBATestsAttributeMetaDataImporter;
+
+	int32 SeparatorIndex = INDEX_NONE;
+	InRowName.FindChar(static_cast<CharType>('.'), SeparatorIndex);
+	if (SeparatorIndex <= 0 || SeparatorIndex == InRowName.Len() - 1)
+	{
+		AddError(LineNumber, FString::Printf(TEXT("Row name '%s' is not of the form SetName.AttributeName"), *InName.ToString()));
+		return false;
+	}
+
+	if (!bValidateRowNames || KnownRowNames.Contains(InName))
+	{
+		return true;
+	}
+
+	const FString SetName = ToString(InRowName.Left(SeparatorIndex));
+	if (!KnownSetNames.Contains(FName(*SetName)))
+	{
+		AddError(LineNumber, FString::Printf(TEXT("Unknown attribute set '%s' (row '%s')"), *SetName, *InName.ToString()));
+	}
+	else
+	{
+		AddError(LineNumber, FString::Printf(TEXT("'%s' is not an attribute of '%s'"), *ToString(InRowName.Mid(SeparatorIndex + 1)), *SetName));
+	}
+
+	return false;
+}
@@ -0,0 +1,206 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeSetGenerator.h"
+
+#include "AttributeSet.h"
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsAttributeMetaDataImporter.h"
+#include "GBATestsLog.h"
+#include "GameplayEffect.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/DataTable.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "Utils/GBAUtils.h"
+
+namespace GBATestsAttributeSetGenerator
+{
+	/** Spreads InNumClamped attributes evenly over InNumAttributes */
+	static bool IsClamped(const int32 InIndex, const int32 InNumClamped, const int32 InNumAttributes)
+	{
+		return (InIndex + 1) * InNumClamped / InNumAttributes > InIndex * InNumClamped / InNumAttributes;
+	}
+
+	static int32 GetNumClamped(const float InRatio, const int32 InNumAttributes)
+	{
+		return FMath::RoundToInt32(FMath::Clamp(InRatio, 0.f, 1.f) * InNumAttributes);
+	}
+
+	/** Attribute properties declared by InClass, in declaration order */
+	static TArray<FStructProperty*> GetAttributeProperties(const UClass* InClass)
+	{
+		TArray<FStructProperty*> Properties;
+		for (TFieldIterator<FStructProperty> It(InClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			if (It->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				Properties.Add(*It);
+			}
+		}
+		return Properties;
+	}
+}
+
+FGBATestsGeneratedAttributeSet FGBATestsAttributeSetGenerator::Generate(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams)
+{
+	FGBATestsGeneratedAttributeSet Generated;
+	Generated.Class = CreateAttributeSetClass(InName, InParams);
+	Generated.DataTable = CreateMetaDataTable(Generated.Class, InParams);
+	if (InParams.NumModifiers > 0)
+	{
+		Generated.Effect = CreateGameplayEffect(Generated.Class, InParams);
+	}
+	return Generated;
+}
+
+UClass* FGBATestsAttributeSetGenerator::CreateAttributeSetClass(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams)
+{
+	UClass* Class = DeclareAttributeSetClass(InName, InParams);
+	LinkAttributeSetClass(Class);
+	Class->GetDefaultObject();
+
+	GBA_TESTS_LOG(Verbose, TEXT("FGBATestsAttributeSetGenerator::CreateAttributeSetClass - %s: %d attributes, %d bytes"), *Class->GetName(), InParams.NumAttributes, Class->GetStructureSize())
+	return Class;
+}
+
+UClass* FGBATestsAttributeSetGenerator::DeclareAttributeSetClass(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams)
+{
+	// Packages of previously generated classes may be pending GC
+	FString Name = InName;
+	for (int32 Suffix = 1; FindPackage(nullptr, *FString::Printf(TEXT("/Temp/GBATests/%s"), *Name)); ++Suffix)
+	{
+		Name = FString::Printf(TEXT("%s_%d"), *InName, Suffix);
+	}
+
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/GBATests/%s"), *Name));
+	Package->SetFlags(RF_Transient);
+
+	UClass* SuperClass = UGBAAttributeSetBlueprintBase::StaticClass();
+	UBlueprintGeneratedClass* Class = NewObject<UBlueprintGeneratedClass>(Package, FName(Name + TEXT("_C")), RF_Public | RF_Standalone | RF_Transient);
+	Class->SetSuperStruct(SuperClass);
+	Class->ClassFlags |= SuperClass->ClassFlags & CLASS_ScriptInherit;
+	Class->ClassCastFlags |= SuperClass->ClassCastFlags;
+	Class->ClassWithin = SuperClass->ClassWithin;
+	Class->ClassConfigName = SuperClass->ClassConfigName;
+
+	const int32 NumAttributes = FMath::Max(InParams.NumAttributes, 0);
+	const int32 NumClamped = GBATestsAttributeSetGenerator::GetNumClamped(InParams.ClampedRatio, NumAttributes);
+
+	// AddCppProperty() prepends, properties are added in reverse to link in declaration order
+	for (int32 Index = NumAttributes - 1; Index >= 0; --Index)
+	{
+		FStructProperty* Property = new FStructProperty(Class, GetAttributeName(Index), RF_Public);
+		Property->Struct = GBATestsAttributeSetGenerator::IsClamped(Index, NumClamped, NumAttributes)
+			? FGBAGameplayClampedAttributeData::StaticStruct()
+			: FGameplayAttributeData::StaticStruct();
+		Property->SetPropertyFlags(CPF_Edit | CPF_BlueprintVisible);
+		Class->AddCppProperty(Property);
+	}
+
+	return Class;
+}
+
+void FGBATestsAttributeSetGenerator::LinkAttributeSetClass(UClass* InClass)
+{
+	InClass->Bind();
+	InClass->StaticLink(true);
+	InClass->AssembleReferenceTokenStream(true);
+}
+
+UDataTable* FGBATestsAttributeSetGenerator::CreateMetaDataTable(const UClass* InClass, const FGBATestsAttributeSetGeneratorParams& InParams)
+{
+	if (!InClass)
+	{
+		return nullptr;
+	}
+
+	const FString SetName = FGBAUtils::GetAttributeClassName(InClass);
+	const TArray<FStructProperty*> Properties = GBATestsAttributeSetGenerator::GetAttributeProperties(InClass);
+	const int32 NumClamped = GBATestsAttributeSetGenerator::GetNumClamped(InParams.DataTableClampedRatio, Properties.Num());
+
+	// Same CSV as UDataTable::CreateTableFromCSVString() takes, which is editor only
+	TStringBuilder<4096> Csv;
+	Csv << TEXT("---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack\n");
+	for (int32 Index = 0; Index < Properties.Num(); ++Index)
+	{
+		const float MaxValue = GBATestsAttributeSetGenerator::IsClamped(Index, NumClamped, Properties.Num()) ? InParams.MaxValue : 0.f;
+		Csv.Appendf(TEXT("%s.%s,\"%f\",\"0.000000\",\"%f\",\"\",\"False\"\n"), *SetName, *Properties[Index]->GetName(), InParams.BaseValue, MaxValue);
+	}
+
+	UDataTable* DataTable = NewObject<UDataTable>(
+		InClass->GetOutermost(),
+		MakeUniqueObjectName(InClass->GetOutermost(), UDataTable::StaticClass(), FName(*(TEXT("DT_") + SetName))),
+		RF_Public | RF_Standalone | RF_Transient
+	);
+	DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+
+	FGBATestsAttributeMetaDataImporter Importer(false);
+	if (!Importer.ImportString(Csv.ToView(), DataTable))
+	{
+		GBA_TESTS_LOG(Error, TEXT("FGBATestsAttributeSetGenerator::CreateMetaDataTable - Unable to import %s rows"), *SetName)
+	}
+
+	return DataTable;
+}
+
+UGameplayEffect* FGBATestsAttributeSetGenerator::CreateGameplayEffect(const UClass* InClass, const FGBATestsAttributeSetGeneratorParams& InParams)
+{
+	const TArray<FStructProperty*> Properties = InClass ? GBATestsAttributeSetGenerator::GetAttributeProperties(InClass) : TArray<FStructProperty*>();
+	if (Properties.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString SetName = FGBAUtils::GetAttributeClassName(InClass);
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(
+		InClass->GetOutermost(),
+		MakeUniqueObjectName(InClass->GetOutermost(), UGameplayEffect::StaticClass(), FName(*FString::Printf(TEXT("GE_%s_%d"), *SetName, InParams.NumModifiers))),
+		RF_Public | RF_Standalone | RF_Transient
+	);
+	Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	Effect->Modifiers.Reserve(InParams.NumModifiers);
+	for (int32 Index = 0; Index < InParams.NumModifiers; ++Index)
+	{
+		FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute.SetUProperty(Properties[Index % Properties.Num()]);
+		Modifier.ModifierOp = InParams.ModifierOp;
+		Modifier.ModifierMagnitude = FScalableFloat(InParams.ModifierMagnitude);
+	}
+
+	return Effect;
+}
+
+FName FGBATestsAttributeSetGenerator::GetAttributeName(const int32 InIndex)
+{
+	return FName(*FString::Printf(TEXT("Attribute_%04d"), InIndex));
+}
+
+void FGBATestsAttributeSetGenerator::Destroy(UObject* InObject)
+{
+	if (!InObject)
+	{
+		return;
+	}
+
+	// Class meta data would otherwise outlive the class until next GC
+	if (const UClass* Class = Cast<UClass>(InObject))
+	{
+		FGBATestsAttributeClassInfo::Remove(Class);
+	}
+
+	InObject->ClearFlags(RF_Public | RF_Standalone);
+	InObject->MarkAsGarbage();
+
+	UPackage* Package = InObject->GetOutermost();
+	if (Package != GetTransientPackage())
+	{
+		ForEachObjectWithOuter(Package, [](UObject* InInner)
+		{
+			InInner->ClearFlags(RF_Public | RF_Standalone);
+		});
+		Package->MarkAsGarbage();
+	}
+}
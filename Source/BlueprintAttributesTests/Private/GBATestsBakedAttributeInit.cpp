@@ -0,0 +1,255 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsBakedAttributeInit.h"
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsLog.h"
+#include "GBATestsStats.h"
+#include "GBATestsTrace.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/DataTable.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Utils/GBAUtils.h"
+
+bool UGBATestsBakedAttributeInit::Bake()
+{
+	static const FString Context = FString(TEXT("UGBATestsBakedAttributeInit::Bake"));
+
+	BakedValues.Reset();
+	LayoutHash = 0;
+	bRequiresDataTable = false;
+#if WITH_EDITORONLY_DATA
+	BakedRowNames.Reset();
+#endif
+
+	const UDataTable* SourceDataTable = DataTable.LoadSynchronous();
+	if (!AttributeSetClass || !SourceDataTable || SourceDataTable->GetRowStruct() != FAttributeMetaData::StaticStruct())
+	{
+		GBA_TESTS_LOG(Warning, TEXT("UGBATestsBakedAttributeInit::Bake - %s needs an attribute set class and a FAttributeMetaData DataTable"), *GetPathName())
+		return false;
+	}
+
+	const FGBATestsAttributeClassInfo* ClassInfo = FGBATestsAttributeClassInfo::FindOrAdd(AttributeSetClass);
+	LayoutHash = ClassInfo->LayoutHash;
+	bRequiresDataTable = !ClassInfo->ClampedIndices.IsEmpty();
+
+	for (int32 Index = 0; Index < ClassInfo->Properties.Num(); ++Index)
+	{
+		const FProperty* Property = ClassInfo->Properties[Index];
+		const FName& RowName = ClassInfo->RowNames[Index];
+
+		const FAttributeMetaData* MetaData = nullptr;
+		{
+			GBA_TESTS_TRACE_SCOPE(MetaDataLookup, Property->GetOwnerClass(), Property->GetFName());
+			MetaData = SourceDataTable->FindRow<FAttributeMetaData>(RowName, Context, false);
+		}
+
+		if (!MetaData)
+		{
+			continue;
+		}
+
+		bRequiresDataTable |= ClassInfo->bIsBlueprintAttributeSet && (MetaData->MinValue != 0.f || MetaData->MaxValue != 0.f);
+
+		FGBATestsBakedAttributeValue& Value = BakedValues.AddDefaulted_GetRef();
+		Value.AttributeIndex = Index;
+		Value.BaseValue = MetaData->BaseValue;
+		Value.MinValue = MetaData->MinValue;
+		Value.MaxValue = MetaData->MaxValue;
+
+#if WITH_EDITORONLY_DATA
+		BakedRowNames.Add(RowName);
+#endif
+	}
+
+	GBA_TESTS_LOG(
+		Verbose,
+		TEXT("UGBATestsBakedAttributeInit::Bake - %s: %d values out of %d attributes (layout hash: %08x, requires DataTable: %s)"),
+		*GetPathName(),
+		BakedValues.Num(),
+		ClassInfo->Properties.Num(),
+		LayoutHash,
+		bRequiresDataTable ? TEXT("true") : TEXT("false")
+	)
+
+	return true;
+}
+
+bool UGBATestsBakedAttributeInit::IsLayoutUpToDate(const UClass* InAttributeSetClass) const
+{
+	if (LayoutHash == 0 || !InAttributeSetClass)
+	{
+		return false;
+	}
+
+	return FGBATestsAttributeClassInfo::FindOrAdd(InAttributeSetClass)->LayoutHash == LayoutHash;
+}
+
+EGBATestsBakedAttributeInitPath UGBATestsBakedAttributeInit::InitAttributeSet(UAttributeSet* InAttributeSet) const
+{
+	if (!IsValid(InAttributeSet))
+	{
+		return EGBATestsBakedAttributeInitPath::Failed;
+	}
+
+	if (LayoutHash == 0)
+	{
+		return InitFromDataTable(InAttributeSet, TEXT("not baked"));
+	}
+
+	if (bRequiresDataTable)
+	{
+		return InitFromDataTable(InAttributeSet, TEXT("clamping needs DataTable meta data"));
+	}
+
+	// Class level layout is built on first init of a class, and reused by every later instance
+	const FGBATestsAttributeClassInfo* ClassInfo = FGBATestsAttributeClassInfo::FindOrAdd(InAttributeSet->GetClass());
+	if (ClassInfo->LayoutHash != LayoutHash)
+	{
+		return InitFromDataTable(InAttributeSet, TEXT("layout hash mismatch"));
+	}
+
+	// Serialized indices only hold for the layout they were baked against, the hash check above can't catch a
+	// corrupted or hand edited asset
+	for (const FGBATestsBakedAttributeValue& Value : BakedValues)
+	{
+		if (!ClassInfo->Properties.IsValidIndex(Value.AttributeIndex))
+		{
+			return InitFromDataTable(InAttributeSet, TEXT("attribute index out of range"));
+		}
+	}
+
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_InitBaked, InAttributeSet->GetClass());
+
+	for (const FGBATestsBakedAttributeValue& Value : BakedValues)
+	{
+		const FProperty* Property = ClassInfo->Properties[Value.AttributeIndex];
+
+		if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			NumericProperty->SetFloatingPointPropertyValue(NumericProperty->ContainerPtrToValuePtr<void>(InAttributeSet), Value.BaseValue);
+		}
+		else
+		{
+			FGameplayAttributeData* Data = CastFieldChecked<FStructProperty>(Property)->ContainerPtrToValuePtr<FGameplayAttributeData>(InAttributeSet);
+			Data->SetBaseValue(Value.BaseValue);
+			Data->SetCurrentValue(Value.BaseValue);
+		}
+
+		GBA_TESTS_STAT_INC(STAT_GBA_AttributeWrites, AttributeWrites);
+	}
+
+	return EGBATestsBakedAttributeInitPath::Baked;
+}
+
+EGBATestsBakedAttributeInitPath UGBATestsBakedAttributeInit::InitStats(UAbilitySystemComponent* InASC) const
+{
+	if (!IsValid(InASC) || !AttributeSetClass)
+	{
+		return EGBATestsBakedAttributeInitPath::Failed;
+	}
+
+	// Only creates the attribute set subobject (if needed) without a DataTable
+	InASC->InitStats(AttributeSetClass, nullptr);
+	return InitAttributeSet(const_cast<UAttributeSet*>(InASC->GetAttributeSet(AttributeSetClass)));
+}
+
+uint32 UGBATestsBakedAttributeInit::GetAttributeProperties(const UClass* InAttributeSetClass, TArray<FProperty*>& OutProperties)
+{
+	OutProperties.Reset();
+	if (!InAttributeSetClass)
+	{
+		return 0;
+	}
+
+	uint32 Hash = GetTypeHash(InAttributeSetClass->GetFName());
+	for (TFieldIterator<FProperty> It(InAttributeSetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+
+		FName TypeName;
+		if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			TypeName = NumericProperty->GetClass()->GetFName();
+		}
+		else if (FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+		{
+			TypeName = CastFieldChecked<FStructProperty>(Property)->Struct->GetFName();
+		}
+		else
+		{
+			continue;
+		}
+
+		OutProperties.Add(Property);
+
+		Hash = HashCombine(Hash, GetTypeHash(Property->GetFName()));
+		Hash = HashCombine(Hash, GetTypeHash(TypeName));
+		Hash = HashCombine(Hash, GetTypeHash(Property->GetOffset_ForInternal()));
+	}
+
+	// 0 stands for "not baked"
+	return Hash != 0 ? Hash : 1;
+}
+
+void UGBATestsBakedAttributeInit::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	int32 Version = BakedDataVersion;
+	Ar << Version;
+	Ar << LayoutHash;
+	Ar << bRequiresDataTable;
+	Ar << BakedValues;
+
+	if (Ar.IsLoading() && Version != BakedDataVersion)
+	{
+		// Unknown binary layout, use the DataTable until baked again
+		BakedValues.Reset();
+		LayoutHash = 0;
+	}
+}
+
+#if WITH_EDITOR
+void UGBATestsBakedAttributeInit::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	// Picks up DataTable edits. Cooking bakes in BeginCacheForCookedPlatformData(), where loading is fine.
+	if (!ObjectSaveContext.IsCooking() && DataTable.Get())
+	{
+		Bake();
+	}
+}
+
+void UGBATestsBakedAttributeInit::BeginCacheForCookedPlatformData(const ITargetPlatform* TargetPlatform)
+{
+	Super::BeginCacheForCookedPlatformData(TargetPlatform);
+	Bake();
+}
+
+void UGBATestsBakedAttributeInit::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Bake();
+}
+#endif
+
+EGBATestsBakedAttributeInitPath UGBATestsBakedAttributeInit::InitFromDataTable(UAttributeSet* InAttributeSet, const TCHAR* InReason) const
+{
+	const UDataTable* SourceDataTable = DataTable.LoadSynchronous();
+	if (!SourceDataTable)
+	{
+		GBA_TESTS_LOG(Warning, TEXT("UGBATestsBakedAttributeInit::InitAttributeSet - %s can't use baked data (%s) and has no DataTable"), *GetPathName(), InReason)
+		return EGBATestsBakedAttributeInitPath::Failed;
+	}
+
+	GBA_TESTS_LOG(Verbose, TEXT("UGBATestsBakedAttributeInit::InitAttributeSet - %s falls back to %s (%s)"), *GetPathName(), *SourceDataTable->GetPathName(), InReason)
+
+	GBA_TESTS_TRACE_SCOPE(DataTableInit, InAttributeSet->GetClass());
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_InitDataTable, InAttributeSet->GetClass());
+	InAttributeSet->InitFromMetaDataTable(SourceDataTable);
+	return EGBATestsBakedAttributeInitPath::DataTable;
+}
@@ -0,0 +1,232 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsBaselineStore.h"
+
+#include "GBATestsBenchmark.h"
+#include "GBATestsLog.h"
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace GBATestsBaselineStore
+{
+	static bool IsRegressed(const double InCurrent, const double InBaseline, const double InTolerance)
+	{
+		return InBaseline > 0.0 && InCurrent > InBaseline * (1.0 + InTolerance);
+	}
+
+	static double GetRatio(const double InCurrent, const double InBaseline)
+	{
+		return InBaseline > 0.0 ? InCurrent / InBaseline : 0.0;
+	}
+}
+
+FGBATestsBaselineStore& FGBATestsBaselineStore::Get()
+{
+	static FGBATestsBaselineStore* Store = []()
+	{
+		FString Profile;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("GBABaselineProfile="), Profile) || Profile.IsEmpty())
+		{
+			Profile = GetDefaultMachineProfile();
+		}
+
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("BlueprintAttributesTests") / TEXT("Baselines") / Profile + TEXT(".json");
+
+		// Leaked on purpose, as the rest of the automation framework state
+		FGBATestsBaselineStore* NewStore = new FGBATestsBaselineStore(Filename, Profile);
+		NewStore->bUpdate = FParse::Param(FCommandLine::Get(), TEXT("GBAUpdateBaselines"));
+		FParse::Value(FCommandLine::Get(), TEXT("GBABaselineTolerance="), NewStore->Tolerance.Median);
+		FParse::Value(FCommandLine::Get(), TEXT("GBABaselineP99Tolerance="), NewStore->Tolerance.P99);
+		NewStore->Load();
+		return NewStore;
+	}();
+
+	return *Store;
+}
+
+FString FGBATestsBaselineStore::GetDefaultMachineProfile()
+{
+	const FString Profile = FString::Printf(
+		TEXT("%s_%s_%s_%dc"),
+		FPlatformProperties::IniPlatformName(),
+		LexToString(FApp::GetBuildConfiguration()),
+		*FPlatformMisc::GetCPUBrand().TrimStartAndEnd(),
+		FPlatformMisc::NumberOfCoresIncludingHyperthreads()
+	);
+
+	return FPaths::MakeValidFileName(Profile.Replace(TEXT(" "), TEXT("_")), TEXT('_'));
+}
+
+FGBATestsBaselineStore::FGBATestsBaselineStore(const FString& InFilename, const FString& InMachineProfile)
+	: Filename(InFilename)
+	, MachineProfile(InMachineProfile)
+{
+}
+
+bool FGBATestsBaselineStore::Load()
+{
+	Specs.Reset();
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		GBA_TESTS_LOG(Warning, TEXT("FGBATestsBaselineStore::Load - Unable to parse %s"), *Filename)
+		return false;
+	}
+
+	const int32 FileVersion = static_cast<int32>(Root->GetNumberField(TEXT("Version")));
+	if (FileVersion != Version)
+	{
+		GBA_TESTS_LOG(Warning, TEXT("FGBATestsBaselineStore::Load - %s has version %d (expected %d), ignoring it"), *Filename, FileVersion, Version)
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* SpecsObject = nullptr;
+	if (!Root->TryGetObjectField(TEXT("Specs"), SpecsObject))
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Spec : (*SpecsObject)->Values)
+	{
+		const TSharedPtr<FJsonObject>* MetricsObject = nullptr;
+		if (!Spec.Value.IsValid() || !Spec.Value->TryGetObject(MetricsObject))
+		{
+			continue;
+		}
+
+		TMap<FString, FGBATestsBaselineMetric>& Metrics = Specs.FindOrAdd(Spec.Key);
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Metric : (*MetricsObject)->Values)
+		{
+			const TSharedPtr<FJsonObject>* MetricObject = nullptr;
+			if (!Metric.Value.IsValid() || !Metric.Value->TryGetObject(MetricObject))
+			{
+				continue;
+			}
+
+			FGBATestsBaselineMetric& Baseline = Metrics.FindOrAdd(Metric.Key);
+			(*MetricObject)->TryGetNumberField(TEXT("Median"), Baseline.Median);
+			(*MetricObject)->TryGetNumberField(TEXT("P99"), Baseline.P99);
+		}
+	}
+
+	return true;
+}
+
+bool FGBATestsBaselineStore::Save() const
+{
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), Version);
+	Root->SetStringField(TEXT("MachineProfile"), MachineProfile);
+
+	const TSharedRef<FJsonObject> SpecsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, TMap<FString, FGBATestsBaselineMetric>>& Spec : Specs)
+	{
+		const TSharedRef<FJsonObject> MetricsObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, FGBATestsBaselineMetric>& Metric : Spec.Value)
+		{
+			const TSharedRef<FJsonObject> MetricObject = MakeShared<FJsonObject>();
+			MetricObject->SetNumberField(TEXT("Median"), Metric.Value.Median);
+			MetricObject->SetNumberField(TEXT("P99"), Metric.Value.P99);
+			MetricsObject->SetObjectField(Metric.Key, MetricObject);
+		}
+		SpecsObject->SetObjectField(Spec.Key, MetricsObject);
+	}
+	Root->SetObjectField(TEXT("Specs"), SpecsObject);
+
+	FString Json;
+	if (!FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json)))
+	{
+		return false;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Json, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		GBA_TESTS_LOG(Warning, TEXT("FGBATestsBaselineStore::Save - Unable to write %s"), *Filename)
+		return false;
+	}
+
+	return true;
+}
+
+const FGBATestsBaselineMetric* FGBATestsBaselineStore::Find(const FString& InSpecName, const FString& InMetricName) const
+{
+	const TMap<FString, FGBATestsBaselineMetric>* Metrics = Specs.Find(InSpecName);
+	return Metrics ? Metrics->Find(InMetricName) : nullptr;
+}
+
+void FGBATestsBaselineStore::Set(const FString& InSpecName, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats)
+{
+	FGBATestsBaselineMetric& Baseline = Specs.FindOrAdd(InSpecName).FindOrAdd(InMetricName);
+	Baseline.Median = InStats.Median;
+	Baseline.P99 = InStats.P99;
+}
+
+EGBATestsBaselineResult FGBATestsBaselineStore::Compare(const FString& InSpecName, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats, FString& OutMessage) const
+{
+	using namespace GBATestsBaselineStore;
+
+	const FGBATestsBaselineMetric* Baseline = Find(InSpecName, InMetricName);
+	if (!Baseline)
+	{
+		OutMessage = FString::Printf(TEXT("%s: no baseline for %s, run with -GBAUpdateBaselines to record it"), *InMetricName, *MachineProfile);
+		return EGBATestsBaselineResult::Missing;
+	}
+
+	const bool bMedianRegressed = IsRegressed(InStats.Median, Baseline->Median, Tolerance.Median);
+	const bool bP99Regressed = IsRegressed(InStats.P99, Baseline->P99, Tolerance.P99);
+
+	OutMessage = FString::Printf(
+		TEXT("%s: median %.1f ns (baseline %.1f ns, %.2fx, tolerance %.0f%%) | p99 %.1f ns (baseline %.1f ns, %.2fx, tolerance %.0f%%)"),
+		*InMetricName,
+		InStats.Median,
+		Baseline->Median,
+		GetRatio(InStats.Median, Baseline->Median),
+		Tolerance.Median * 100.0,
+		InStats.P99,
+		Baseline->P99,
+		GetRatio(InStats.P99, Baseline->P99),
+		Tolerance.P99 * 100.0
+	);
+
+	return bMedianRegressed || bP99Regressed ? EGBATestsBaselineResult::Regressed : EGBATestsBaselineResult::Passed;
+}
+
+EGBATestsBaselineResult FGBATestsBaselineStore::Check(FAutomationTestBase& InTest, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats)
+{
+	const FString SpecName = InTest.GetTestFullName();
+
+	if (bUpdate)
+	{
+		Set(SpecName, InMetricName, InStats);
+		Save();
+
+		InTest.AddInfo(FString::Printf(TEXT("%s: baseline updated to median %.1f ns | p99 %.1f ns (%s)"), *InMetricName, InStats.Median, InStats.P99, *Filename));
+		return EGBATestsBaselineResult::Updated;
+	}
+
+	FString Message;
+	const EGBATestsBaselineResult Result = Compare(SpecName, InMetricName, InStats, Message);
+	if (Result == EGBATestsBaselineResult::Regressed)
+	{
+		InTest.AddError(FString::Printf(TEXT("Performance regression - %s"), *Message));
+	}
+	else
+	{
+		InTest.AddInfo(Message);
+	}
+
+	return Result;
+}
@@ -0,0 +1,152 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsBenchmark.h"
+
+#include "GBATestsAllocationCounter.h"
+#include "Templates/Function.h"
+
+namespace GBATestsBenchmark
+{
+	static const void* volatile EscapedPointer = nullptr;
+}
+
+FGBATestsBenchmarkStats FGBATestsBenchmarkStats::Compute(TArray<double> InSamples)
+{
+	FGBATestsBenchmarkStats Stats;
+	Stats.NumSamples = InSamples.Num();
+	if (InSamples.IsEmpty())
+	{
+		return Stats;
+	}
+
+	InSamples.Sort();
+
+	double Sum = 0.0;
+	for (const double Sample : InSamples)
+	{
+		Sum += Sample;
+	}
+
+	Stats.Min = InSamples[0];
+	Stats.Median = Percentile(InSamples, 50.0);
+	Stats.P99 = Percentile(InSamples, 99.0);
+	Stats.Mean = Sum / InSamples.Num();
+
+	double SquaredDeviations = 0.0;
+	for (const double Sample : InSamples)
+	{
+		SquaredDeviations += FMath::Square(Sample - Stats.Mean);
+	}
+
+	Stats.StdDev = FMath::Sqrt(SquaredDeviations / InSamples.Num());
+	return Stats;
+}
+
+double FGBATestsBenchmarkStats::Percentile(const TArray<double>& InSortedSamples, const double InPercentile)
+{
+	if (InSortedSamples.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	const int32 Rank = FMath::CeilToInt32(FMath::Clamp(InPercentile, 0.0, 100.0) / 100.0 * InSortedSamples.Num());
+	return InSortedSamples[FMath::Clamp(Rank - 1, 0, InSortedSamples.Num() - 1)];
+}
+
+FString FGBATestsBenchmarkStats::ToString() const
+{
+	return FString::Printf(
+		TEXT("min %.1f ns | median %.1f ns | p99 %.1f ns | stddev %.1f ns (%d samples)"),
+		Min,
+		Median,
+		P99,
+		StdDev,
+		NumSamples
+	);
+}
+
+FString FGBATestsBenchmarkResult::ToCsvRow() const
+{
+	return FString::Printf(
+		TEXT("%d,%d,%.1f,%.1f,%.1f,%.1f,%.2f,%.1f"),
+		Stats.NumSamples,
+		OpsPerSample,
+		Stats.Min,
+		Stats.Median,
+		Stats.P99,
+		Stats.StdDev,
+		AllocsPerOp,
+		BytesPerOp
+	);
+}
+
+FGBATestsBenchmarkStats FGBATestsBenchmark::Run(const int32 InNumWarmupPasses, const int32 InNumPasses, const int64 InOpsPerPass, const TFunctionRef<void()> InBody)
+{
+	for (int32 Pass = 0; Pass < InNumWarmupPasses; ++Pass)
+	{
+		InBody();
+	}
+
+	TArray<double> Samples;
+	Samples.Reserve(InNumPasses);
+
+	for (int32 Pass = 0; Pass < InNumPasses; ++Pass)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		InBody();
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+
+		Samples.Add(CyclesToNanoseconds(EndCycles - StartCycles) / FMath::Max<int64>(InOpsPerPass, 1));
+	}
+
+	return FGBATestsBenchmarkStats::Compute(MoveTemp(Samples));
+}
+
+FGBATestsBenchmarkResult FGBATestsBenchmark::RunAdaptive(const FGBATestsBenchmarkParams& InParams, const TFunctionRef<void()> InOp)
+{
+	auto RunOps = [InOp](const int32 InNumOps)
+	{
+		for (int32 Index = 0; Index < InNumOps; ++Index)
+		{
+			InOp();
+		}
+	};
+
+	// First calls also warm caches up, so that calibration isn't thrown off by a cold first sample
+	FGBATestsBenchmarkResult Result;
+	Result.OpsPerSample = 1;
+	for (;;)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		RunOps(Result.OpsPerSample);
+		const double Nanoseconds = CyclesToNanoseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		if (Nanoseconds >= InParams.MinSampleNanoseconds || Result.OpsPerSample >= InParams.MaxOpsPerSample)
+		{
+			break;
+		}
+
+		Result.OpsPerSample = FMath::Min(Result.OpsPerSample * 2, InParams.MaxOpsPerSample);
+	}
+
+	const int32 OpsPerSample = Result.OpsPerSample;
+	Result.Stats = Run(InParams.NumWarmupSamples, FMath::Max(InParams.NumSamples, 1), OpsPerSample, [&RunOps, OpsPerSample]()
+	{
+		RunOps(OpsPerSample);
+	});
+
+	if (InParams.bCountAllocations && FGBATestsScopedAllocationCounter::IsSupported())
+	{
+		const FGBATestsScopedAllocationCounter Counter;
+		RunOps(OpsPerSample);
+		Result.AllocsPerOp = static_cast<double>(Counter.GetNum()) / OpsPerSample;
+		Result.BytesPerOp = static_cast<double>(Counter.GetNumBytes()) / OpsPerSample;
+	}
+
+	return Result;
+}
+
+void FGBATestsBenchmark::Escape(const void* InPointer)
+{
+	GBATestsBenchmark::EscapedPointer = InPointer;
+}
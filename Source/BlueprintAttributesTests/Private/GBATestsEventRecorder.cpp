@@ -0,0 +1,185 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsEventRecorder.h"
+
+#include "Templates/Function.h"
+
+struct FGBATestsEventRecorder::FCursor
+{
+	EGBATestsEventKind Kind = EGBATestsEventKind::Num;
+
+	/** Ring slots, and offsets of record members within a slot */
+	const uint8* Records = nullptr;
+	SIZE_T Stride = 0;
+	SIZE_T HeaderOffset = 0;
+	SIZE_T PayloadOffset = 0;
+	SIZE_T AttributeOffset = 0;
+	uint64 Mask = 0;
+
+	uint64 Index = 0;
+	uint64 End = 0;
+
+	bool IsValid() const { return Index < End; }
+
+	const uint8* GetRecord() const { return Records + (Index & Mask) * Stride; }
+
+	const FGBATestsEventHeader& GetHeader() const
+	{
+		return *reinterpret_cast<const FGBATestsEventHeader*>(GetRecord() + HeaderOffset);
+	}
+
+	const FTestStorageBlueprintData& GetPayload() const
+	{
+		return *reinterpret_cast<const FTestStorageBlueprintData*>(GetRecord() + PayloadOffset);
+	}
+
+	const FGameplayAttribute& GetAttribute() const
+	{
+		return *reinterpret_cast<const FGameplayAttribute*>(GetRecord() + AttributeOffset);
+	}
+};
+
+template <typename PayloadType>
+FGBATestsEventRecorder::FCursor FGBATestsEventRecorder::MakeCursor(const EGBATestsEventKind InKind, const TGBATestsEventRing<PayloadType>& InRing)
+{
+	FCursor Cursor;
+	Cursor.Kind = InKind;
+	if (InRing.Records.IsEmpty())
+	{
+		return Cursor;
+	}
+
+	const TGBATestsEventRecord<PayloadType>& First = InRing.Records[0];
+	Cursor.Records = reinterpret_cast<const uint8*>(&First);
+	Cursor.Stride = sizeof(TGBATestsEventRecord<PayloadType>);
+	Cursor.HeaderOffset = reinterpret_cast<const uint8*>(&First.Header) - Cursor.Records;
+	Cursor.PayloadOffset = reinterpret_cast<const uint8*>(static_cast<const FTestStorageBlueprintData*>(&First.Payload)) - Cursor.Records;
+	Cursor.AttributeOffset = reinterpret_cast<const uint8*>(&First.Payload.Attribute) - Cursor.Records;
+	Cursor.Mask = InRing.Records.Num() - 1;
+	Cursor.Index = InRing.GetFirstIndex();
+	Cursor.End = InRing.NumWritten;
+	return Cursor;
+}
+
+template <typename FuncType>
+void FGBATestsEventRecorder::ForEachRing(FuncType&& InFunc) const
+{
+	InFunc(EGBATestsEventKind::PreGameplayEffectExecute, PreGameplayEffectExecute);
+	InFunc(EGBATestsEventKind::PostGameplayEffectExecute, PostGameplayEffectExecute);
+	InFunc(EGBATestsEventKind::PreAttributeChange, PreAttributeChange);
+	InFunc(EGBATestsEventKind::PostAttributeChange, PostAttributeChange);
+	InFunc(EGBATestsEventKind::PreAttributeBaseChange, PreAttributeBaseChange);
+	InFunc(EGBATestsEventKind::PostAttributeBaseChange, PostAttributeBaseChange);
+}
+
+void FGBATestsEventRecorder::Initialize(const int32 InCapacity)
+{
+	PreGameplayEffectExecute.Initialize(InCapacity);
+	PostGameplayEffectExecute.Initialize(InCapacity);
+	PreAttributeChange.Initialize(InCapacity);
+	PostAttributeChange.Initialize(InCapacity);
+	PreAttributeBaseChange.Initialize(InCapacity);
+	PostAttributeBaseChange.Initialize(InCapacity);
+	NextSequence = 0;
+}
+
+void FGBATestsEventRecorder::Reset()
+{
+	PreGameplayEffectExecute.Reset();
+	PostGameplayEffectExecute.Reset();
+	PreAttributeChange.Reset();
+	PostAttributeChange.Reset();
+	PreAttributeBaseChange.Reset();
+	PostAttributeBaseChange.Reset();
+}
+
+void FGBATestsEventRecorder::ForEachEvent(const FGBATestsEventFilter& InFilter, const TFunctionRef<bool(EGBATestsEventKind InKind, const FGBATestsEventHeader& InHeader, const FTestStorageBlueprintData& InPayload)> InVisitor) const
+{
+	FCursor Cursors[static_cast<int32>(EGBATestsEventKind::Num)];
+	int32 NumCursors = 0;
+
+	// Rings are locked in a fixed order, and writers only ever hold a single ring lock
+	ForEachRing([&InFilter, &Cursors, &NumCursors](const EGBATestsEventKind InKind, const auto& InRing)
+	{
+		InRing.Lock.ReadLock();
+		if (InFilter.MatchesKind(InKind))
+		{
+			Cursors[NumCursors++] = MakeCursor(InKind, InRing);
+		}
+	});
+
+	// Each ring is sorted by sequence, merge them
+	while (true)
+	{
+		FCursor* Next = nullptr;
+		for (int32 Index = 0; Index < NumCursors; ++Index)
+		{
+			FCursor& Cursor = Cursors[Index];
+			if (Cursor.IsValid() && (!Next || Cursor.GetHeader().Sequence < Next->GetHeader().Sequence))
+			{
+				Next = &Cursor;
+			}
+		}
+
+		if (!Next)
+		{
+			break;
+		}
+
+		if (InFilter.MatchesAttribute(Next->GetAttribute()) && !InVisitor(Next->Kind, Next->GetHeader(), Next->GetPayload()))
+		{
+			break;
+		}
+
+		++Next->Index;
+	}
+
+	ForEachRing([](EGBATestsEventKind, const auto& InRing)
+	{
+		InRing.Lock.ReadUnlock();
+	});
+}
+
+int32 FGBATestsEventRecorder::Num(const FGBATestsEventFilter& InFilter) const
+{
+	int32 Result = 0;
+	if (InFilter.Attribute.IsValid())
+	{
+		ForEachEvent(InFilter, [&Result](EGBATestsEventKind, const FGBATestsEventHeader&, const FTestStorageBlueprintData&)
+		{
+			++Result;
+			return true;
+		});
+		return Result;
+	}
+
+	ForEachRing([&InFilter, &Result](const EGBATestsEventKind InKind, const auto& InRing)
+	{
+		Result += InFilter.MatchesKind(InKind) ? InRing.Num() : 0;
+	});
+	return Result;
+}
+
+uint64 FGBATestsEventRecorder::GetNumDropped() const
+{
+	uint64 Result = 0;
+	ForEachRing([&Result](EGBATestsEventKind, const auto& InRing)
+	{
+		Result += InRing.GetNumDropped();
+	});
+	return Result;
+}
+
+const TCHAR* FGBATestsEventRecorder::LexToString(const EGBATestsEventKind InKind)
+{
+	switch (InKind)
+	{
+	case EGBATestsEventKind::PreGameplayEffectExecute: return TEXT("PreGameplayEffectExecute");
+	case EGBATestsEventKind::PostGameplayEffectExecute: return TEXT("PostGameplayEffectExecute");
+	case EGBATestsEventKind::PreAttributeChange: return TEXT("PreAttributeChange");
+	case EGBATestsEventKind::PostAttributeChange: return TEXT("PostAttributeChange");
+	case EGBATestsEventKind::PreAttributeBaseChange: return TEXT("PreAttributeBaseChange");
+	case EGBATestsEventKind::PostAttributeBaseChange: return TEXT("PostAttributeBaseChange");
+	default: return TEXT("Unknown");
+	}
+}
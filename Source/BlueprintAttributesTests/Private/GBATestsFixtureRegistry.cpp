@@ -0,0 +1,195 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsFixtureRegistry.h"
+
+#include "GBATestsLog.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
+
+namespace GBATestsFixtureRegistry
+{
+	static TUniquePtr<FGBATestsFixtureRegistry> Instance;
+}
+
+FString FGBATestsFixtureRegistry::FStats::ToString() const
+{
+	return FString::Printf(
+		TEXT("%d assets preloaded in %.2f ms, %d lookups (%d cached, %d resolved, %d loaded in %.2f ms) in %.2f ms"),
+		NumPreloaded,
+		PreloadSeconds * 1000.0,
+		NumHits + NumResolved + NumLoaded,
+		NumHits,
+		NumResolved,
+		NumLoaded,
+		LoadSeconds * 1000.0,
+		LookupSeconds * 1000.0
+	);
+}
+
+FGBATestsFixtureRegistry& FGBATestsFixtureRegistry::Get()
+{
+	if (!GBATestsFixtureRegistry::Instance.IsValid())
+	{
+		GBATestsFixtureRegistry::Instance = MakeUnique<FGBATestsFixtureRegistry>();
+	}
+
+	return *GBATestsFixtureRegistry::Instance;
+}
+
+void FGBATestsFixtureRegistry::Shutdown()
+{
+	GBATestsFixtureRegistry::Instance.Reset();
+}
+
+FGBATestsFixtureRegistry::FGBATestsFixtureRegistry()
+	: StreamableManager(MakeUnique<FStreamableManager>())
+{
+	FAutomationTestFramework& Framework = FAutomationTestFramework::Get();
+
+	BeforeAllTestsHandle = Framework.OnBeforeAllTestsEvent.AddRaw(this, &FGBATestsFixtureRegistry::Preload);
+	AfterAllTestsHandle = Framework.OnAfterAllTestsEvent.AddLambda([this]()
+	{
+		GBA_TESTS_LOG(Display, TEXT("FGBATestsFixtureRegistry - %s"), *Stats.ToString())
+	});
+}
+
+FGBATestsFixtureRegistry::~FGBATestsFixtureRegistry()
+{
+	FAutomationTestFramework& Framework = FAutomationTestFramework::Get();
+	Framework.OnBeforeAllTestsEvent.Remove(BeforeAllTestsHandle);
+	Framework.OnAfterAllTestsEvent.Remove(AfterAllTestsHandle);
+}
+
+void FGBATestsFixtureRegistry::Preload()
+{
+	if (bPreloaded)
+	{
+		return;
+	}
+
+	bPreloaded = true;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		AssetRegistry.ScanPathsSynchronous({ FixturesRoot }, false);
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPath(FixturesRoot, Assets, true);
+
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(Assets.Num());
+	for (const FAssetData& Asset : Assets)
+	{
+		Paths.Add(Asset.GetSoftObjectPath());
+	}
+
+	if (!Paths.IsEmpty())
+	{
+		const TSharedPtr<FStreamableHandle> Handle = StreamableManager->RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
+	}
+
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		UObject* Object = Path.ResolveObject();
+		if (!Object)
+		{
+			GBA_TESTS_LOG(Warning, TEXT("FGBATestsFixtureRegistry::Preload - Unable to load %s"), *Path.ToString())
+			continue;
+		}
+
+		Cache.Add(Path, Object);
+		ReferencedObjects.Add(Object);
+
+		// Specs mostly ask for Blueprint generated classes
+		if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object); Blueprint && Blueprint->GeneratedClass)
+		{
+			Cache.Add(FSoftObjectPath(Blueprint->GeneratedClass), Blueprint->GeneratedClass);
+			ReferencedObjects.Add(Blueprint->GeneratedClass);
+		}
+	}
+
+	Stats.NumPreloaded = Paths.Num();
+	Stats.PreloadSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	GBA_TESTS_LOG(Verbose, TEXT("FGBATestsFixtureRegistry::Preload - %d assets in %.2f ms"), Stats.NumPreloaded, Stats.PreloadSeconds * 1000.0)
+}
+
+UObject* FGBATestsFixtureRegistry::GetObject(const FString& InPath)
+{
+	Preload();
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		Stats.LookupSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	};
+
+	const FSoftObjectPath Path = ToObjectPath(InPath);
+	if (UObject* const* Cached = Cache.Find(Path))
+	{
+		++Stats.NumHits;
+		return *Cached;
+	}
+
+	UObject* Object = Path.ResolveObject();
+	if (Object)
+	{
+		++Stats.NumResolved;
+	}
+	else
+	{
+		Object = Path.TryLoad();
+		++Stats.NumLoaded;
+		Stats.LoadSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	if (Object)
+	{
+		Cache.Add(Path, Object);
+		ReferencedObjects.Add(Object);
+	}
+
+	return Object;
+}
+
+UClass* FGBATestsFixtureRegistry::GetClass(const FString& InPath, const UClass* InBaseClass)
+{
+	UClass* Class = Cast<UClass>(GetObject(InPath));
+	return Class && (!InBaseClass || Class->IsChildOf(InBaseClass)) ? Class : nullptr;
+}
+
+FSoftObjectPath FGBATestsFixtureRegistry::ToObjectPath(const FString& InPath)
+{
+	int32 SlashIndex = INDEX_NONE;
+	InPath.FindLastChar(TEXT('/'), SlashIndex);
+
+	int32 DotIndex = INDEX_NONE;
+	InPath.FindLastChar(TEXT('.'), DotIndex);
+
+	if (DotIndex > SlashIndex)
+	{
+		return FSoftObjectPath(InPath);
+	}
+
+	return FSoftObjectPath(FString::Printf(TEXT("%s.%s"), *InPath, *FPackageName::GetShortName(InPath)));
+}
+
+void FGBATestsFixtureRegistry::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(ReferencedObjects);
+}
+
+FString FGBATestsFixtureRegistry::GetReferencerName() const
+{
+	return TEXT("FGBATestsFixtureRegistry");
+}
@@ -0,0 +1,154 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsGameplayEffectCache.h"
+
+#include "AbilitySystemComponent.h"
+#include "GBATestsLog.h"
+#include "GBATestsStats.h"
+#include "GBATestsTrace.h"
+#include "GameplayEffect.h"
+#include "UObject/Package.h"
+
+namespace GBATestsGameplayEffectCache
+{
+	static TUniquePtr<FGBATestsGameplayEffectCache> Instance;
+
+	static const FName MagnitudeName = TEXT("GBATests_Magnitude");
+}
+
+FGBATestsGameplayEffectSignature::FGBATestsGameplayEffectSignature(const FGameplayAttribute& InAttribute, const EGameplayModOp::Type InOp, const EGameplayEffectDurationType InDurationPolicy, const float InPeriod)
+	: DurationPolicy(InDurationPolicy)
+	, Period(InPeriod)
+{
+	Modifiers.Add({ InAttribute, InOp });
+}
+
+uint32 GetTypeHash(const FGBATestsGameplayEffectSignature& InSignature)
+{
+	uint32 Hash = HashCombine(GetTypeHash(static_cast<uint8>(InSignature.DurationPolicy)), GetTypeHash(InSignature.Period));
+	for (const FGBATestsGameplayEffectSignature::FModifier& Modifier : InSignature.Modifiers)
+	{
+		Hash = HashCombine(Hash, HashCombine(GetTypeHash(Modifier.Attribute), GetTypeHash(static_cast<uint8>(Modifier.Op))));
+	}
+	return Hash;
+}
+
+FString FGBATestsGameplayEffectSignature::ToString() const
+{
+	TArray<FString> ModifierNames;
+	for (const FModifier& Modifier : Modifiers)
+	{
+		ModifierNames.Add(FString::Printf(TEXT("%s %s"), *Modifier.Attribute.GetName(), *EGameplayModOpToString(Modifier.Op)));
+	}
+
+	return FString::Printf(
+		TEXT("%s, period %.2f: %s"),
+		*UEnum::GetValueAsString(DurationPolicy),
+		Period,
+		*FString::Join(ModifierNames, TEXT(", "))
+	);
+}
+
+FGBATestsGameplayEffectCache& FGBATestsGameplayEffectCache::Get()
+{
+	if (!GBATestsGameplayEffectCache::Instance.IsValid())
+	{
+		GBATestsGameplayEffectCache::Instance = MakeUnique<FGBATestsGameplayEffectCache>();
+	}
+
+	return *GBATestsGameplayEffectCache::Instance;
+}
+
+void FGBATestsGameplayEffectCache::Shutdown()
+{
+	GBATestsGameplayEffectCache::Instance.Reset();
+}
+
+FName FGBATestsGameplayEffectCache::GetMagnitudeName(const int32 InModifierIndex)
+{
+	// Numbered FName, which doesn't go through the name table
+	return FName(GBATestsGameplayEffectCache::MagnitudeName, NAME_EXTERNAL_TO_INTERNAL(InModifierIndex));
+}
+
+const UGameplayEffect* FGBATestsGameplayEffectCache::FindOrAdd(const FGBATestsGameplayEffectSignature& InSignature)
+{
+	check(IsInGameThread());
+
+	if (const TObjectPtr<UGameplayEffect>* Effect = Effects.Find(InSignature))
+	{
+		return *Effect;
+	}
+
+	UPackage* Package = GetTransientPackage();
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(Package, MakeUniqueObjectName(Package, UGameplayEffect::StaticClass(), TEXT("GE_GBATests_Cached")), RF_Transient);
+	Effect->DurationPolicy = InSignature.DurationPolicy;
+	if (InSignature.DurationPolicy == EGameplayEffectDurationType::HasDuration)
+	{
+		// Overridden on each spec by Apply()
+		Effect->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(0.f));
+	}
+	Effect->Period.Value = InSignature.Period;
+
+	Effect->Modifiers.Reserve(InSignature.Modifiers.Num());
+	for (int32 Index = 0; Index < InSignature.Modifiers.Num(); ++Index)
+	{
+		FSetByCallerFloat SetByCaller;
+		SetByCaller.DataName = GetMagnitudeName(Index);
+
+		FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = InSignature.Modifiers[Index].Attribute;
+		Modifier.ModifierOp = InSignature.Modifiers[Index].Op;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+	}
+
+	GBA_TESTS_LOG(Verbose, TEXT("FGBATestsGameplayEffectCache::FindOrAdd - %s for %s"), *Effect->GetName(), *InSignature.ToString())
+
+	Effects.Add(InSignature, Effect);
+	return Effect;
+}
+
+FActiveGameplayEffectHandle FGBATestsGameplayEffectCache::Apply(UAbilitySystemComponent* InASC, const FGBATestsGameplayEffectSignature& InSignature, const TConstArrayView<float> InMagnitudes, const float InDuration, const float InLevel)
+{
+	const UGameplayEffect* Effect = FindOrAdd(InSignature);
+	if (!InASC || !Effect)
+	{
+		return FActiveGameplayEffectHandle();
+	}
+
+	if (InMagnitudes.Num() != InSignature.Modifiers.Num())
+	{
+		GBA_TESTS_LOG(Warning, TEXT("FGBATestsGameplayEffectCache::Apply - %d magnitudes for %d modifiers (%s), missing ones are 0"), InMagnitudes.Num(), InSignature.Modifiers.Num(), *InSignature.ToString())
+	}
+
+	// On the stack, unlike UAbilitySystemComponent::MakeOutgoingSpec()
+	FGameplayEffectSpec Spec(Effect, InASC->MakeEffectContext(), InLevel);
+	for (int32 Index = 0; Index < InSignature.Modifiers.Num(); ++Index)
+	{
+		Spec.SetSetByCallerMagnitude(GetMagnitudeName(Index), InMagnitudes.IsValidIndex(Index) ? InMagnitudes[Index] : 0.f);
+	}
+
+	if (InSignature.DurationPolicy == EGameplayEffectDurationType::HasDuration)
+	{
+		Spec.SetDuration(InDuration, true);
+	}
+
+	GBA_TESTS_TRACE_SCOPE(EffectApply, InSignature.Modifiers.IsEmpty() ? FGameplayAttribute() : InSignature.Modifiers[0].Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_EffectApply, nullptr);
+	FGBATestsStats::CountEffectApplication(*Effect);
+	return InASC->ApplyGameplayEffectSpecToSelf(Spec);
+}
+
+void FGBATestsGameplayEffectCache::Reset()
+{
+	Effects.Reset();
+}
+
+void FGBATestsGameplayEffectCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(Effects);
+}
+
+FString FGBATestsGameplayEffectCache::GetReferencerName() const
+{
+	return TEXT("FGBATestsGameplayEffectCache");
+}
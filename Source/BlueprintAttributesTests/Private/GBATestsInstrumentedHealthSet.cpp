@@ -0,0 +1,41 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsInstrumentedHealthSet.h"
+
+#include "GBATestsStats.h"
+#include "GBATestsTrace.h"
+#include "GameplayEffectExtension.h"
+
+void UGBATestsInstrumentedHealthSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
+{
+	GBA_TESTS_TRACE_SCOPE(AttributeChange, Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_AttributeChange, GetClass());
+
+	if (Attribute != GetHealthAttribute())
+	{
+		Super::PreAttributeChange(Attribute, NewValue);
+		return;
+	}
+
+	// Health is clamped by the parent
+	GBA_TESTS_TRACE_SCOPE(AttributeClamp, Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_Clamp, GetClass());
+	Super::PreAttributeChange(Attribute, NewValue);
+}
+
+void UGBATestsInstrumentedHealthSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
+{
+	GBA_TESTS_TRACE_SCOPE(GameplayEffectExecute, Data.EvaluatedData.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_GameplayEffectExecute, GetClass());
+
+	if (Data.EvaluatedData.Attribute != GetHealthAttribute())
+	{
+		Super::PostGameplayEffectExecute(Data);
+		return;
+	}
+
+	// Health is clamped by the parent
+	GBA_TESTS_TRACE_SCOPE(AttributeClamp, Data.EvaluatedData.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_Clamp, GetClass());
+	Super::PostGameplayEffectExecute(Data);
+}
@@ -0,0 +1,92 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsLatencyHistogram.h"
+
+FGBATestsLatencyHistogram::FGBATestsLatencyHistogram()
+{
+	Counts.SetNumZeroed(NumBuckets);
+}
+
+void FGBATestsLatencyHistogram::Record(const uint64 InValue)
+{
+	++Counts[GetBucketIndex(InValue)];
+	++TotalCount;
+	Min = FMath::Min(Min, InValue);
+	Max = FMath::Max(Max, InValue);
+	Sum += static_cast<double>(InValue);
+}
+
+void FGBATestsLatencyHistogram::Add(const FGBATestsLatencyHistogram& InOther)
+{
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Counts[Index] += InOther.Counts[Index];
+	}
+
+	TotalCount += InOther.TotalCount;
+	Min = FMath::Min(Min, InOther.Min);
+	Max = FMath::Max(Max, InOther.Max);
+	Sum += InOther.Sum;
+}
+
+void FGBATestsLatencyHistogram::Reset()
+{
+	FMemory::Memzero(Counts.GetData(), Counts.Num() * sizeof(uint64));
+	TotalCount = 0;
+	Min = MAX_uint64;
+	Max = 0;
+	Sum = 0.0;
+}
+
+uint64 FGBATestsLatencyHistogram::GetPercentile(const double InPercentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0;
+	}
+
+	// Nearest rank, as FGBATestsBenchmarkStats::Percentile()
+	const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(InPercentile, 0.0, 100.0) / 100.0 * TotalCount)));
+
+	uint64 Count = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Count += Counts[Index];
+		if (Count >= Rank)
+		{
+			// Never report beyond what was actually recorded
+			return FMath::Min(GetHighestEquivalentValue(Index), Max);
+		}
+	}
+
+	return Max;
+}
+
+int32 FGBATestsLatencyHistogram::GetBucketIndex(const uint64 InValue)
+{
+	if (InValue < SubBucketCount)
+	{
+		return static_cast<int32>(InValue);
+	}
+
+	// Shift that brings InValue within [SubBucketHalfCount, SubBucketCount)
+	const int32 Shift = static_cast<int32>(FMath::FloorLog2_64(InValue)) - SubBucketBits + 1;
+	const int32 SubBucket = static_cast<int32>(InValue >> Shift);
+	return SubBucketCount + (Shift - 1) * SubBucketHalfCount + (SubBucket - SubBucketHalfCount);
+}
+
+uint64 FGBATestsLatencyHistogram::GetHighestEquivalentValue(const int32 InIndex)
+{
+	if (InIndex < SubBucketCount)
+	{
+		return static_cast<uint64>(InIndex);
+	}
+
+	const int32 Offset = InIndex - SubBucketCount;
+	const int32 Shift = Offset / SubBucketHalfCount + 1;
+	const uint64 SubBucket = static_cast<uint64>(Offset % SubBucketHalfCount + SubBucketHalfCount);
+
+	// Top bucket upper bound would overflow
+	const uint64 Next = SubBucket + 1;
+	return Shift + SubBucketBits >= 64 && Next == SubBucketCount ? MAX_uint64 : (Next << Shift) - 1;
+}
@@ -2,17 +2,62 @@
 
 #include "GBATestsModule.h"
 
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsAttributeDebugData.h"
+#include "GBATestsFixtureRegistry.h"
+#include "GBATestsGameplayEffectCache.h"
+#include "GBATestsStats.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "Debug/GBATestsGameplayDebuggerCategory_Attributes.h"
+#endif
+
 #define LOCTEXT_NAMESPACE "FGBATestsModule"
 
+namespace GBATestsModule
+{
+	static const FName GameplayDebuggerCategoryName = TEXT("BlueprintAttributes");
+}
+
 void FGBATestsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	FGBATestsStats::Initialize();
+	FGBATestsAttributeClassInfo::Initialize();
+	FGBATestsAttributeDebugLayout::Initialize();
+
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+	GameplayDebuggerModule.RegisterCategory(
+		GBATestsModule::GameplayDebuggerCategoryName,
+		IGameplayDebugger::FOnGetCategory::CreateStatic(&FGBATestsGameplayDebuggerCategory_Attributes::MakeInstance),
+		EGameplayDebuggerCategoryState::EnabledInGameAndSimulate
+	);
+	GameplayDebuggerModule.NotifyCategoriesChanged();
+#endif
 }
 
 void FGBATestsModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FGBATestsFixtureRegistry::Shutdown();
+	FGBATestsGameplayEffectCache::Shutdown();
+	FGBATestsStats::Shutdown();
+	FGBATestsAttributeClassInfo::Shutdown();
+	FGBATestsAttributeDebugLayout::Shutdown();
+
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+		GameplayDebuggerModule.UnregisterCategory(GBATestsModule::GameplayDebuggerCategoryName);
+		GameplayDebuggerModule.NotifyCategoriesChanged();
+	}
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,32 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsNativeHealthSet.h"
+
+#include "GameplayEffectExtension.h"
+
+UGBATestsNativeHealthSet::UGBATestsNativeHealthSet()
+{
+	InitHealth(0.f);
+	InitMinHealth(-20.f);
+	InitMaxHealth(80.f);
+}
+
+void UGBATestsNativeHealthSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
+{
+	Super::PreAttributeChange(Attribute, NewValue);
+
+	if (Attribute == GetHealthAttribute())
+	{
+		NewValue = FMath::Clamp(NewValue, GetMinHealth(), GetMaxHealth());
+	}
+}
+
+void UGBATestsNativeHealthSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
+{
+	Super::PostGameplayEffectExecute(Data);
+
+	if (Data.EvaluatedData.Attribute == GetHealthAttribute())
+	{
+		SetHealth(FMath::Clamp(GetHealth(), GetMinHealth(), GetMaxHealth()));
+	}
+}
@@ -0,0 +1,135 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsStats.h"
+
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "GameplayEffect.h"
+#include "Containers/Ticker.h"
+#include "UObject/UObjectHash.h"
+
+DEFINE_STAT(STAT_GBA_EffectApply);
+DEFINE_STAT(STAT_GBA_GameplayEffectExecute);
+DEFINE_STAT(STAT_GBA_AttributeChange);
+DEFINE_STAT(STAT_GBA_StorageRecord);
+DEFINE_STAT(STAT_GBA_Clamp);
+DEFINE_STAT(STAT_GBA_InitBaked);
+DEFINE_STAT(STAT_GBA_InitDataTable);
+DEFINE_STAT(STAT_GBA_AttributeWrites);
+DEFINE_STAT(STAT_GBA_GameplayEffectExecutions);
+DEFINE_STAT(STAT_GBA_NumAttributeSets);
+DEFINE_STAT(STAT_GBA_AttributeSetsMemory);
+
+CSV_DEFINE_CATEGORY_MODULE(BLUEPRINTATTRIBUTESTESTS_API, BlueprintAttributes, true);
+
+namespace GBATestsStats
+{
+	static constexpr float SamplePeriodSeconds = 1.f;
+
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	static bool IsCollecting()
+	{
+#if STATS
+		if (FThreadStats::IsCollectingData())
+		{
+			return true;
+		}
+#endif
+#if CSV_PROFILER
+		if (FCsvProfiler::Get()->IsCapturing())
+		{
+			return true;
+		}
+#endif
+		return false;
+	}
+
+	static bool Tick(float)
+	{
+		if (IsCollecting())
+		{
+			int32 Num = 0;
+			int64 Bytes = 0;
+			FGBATestsStats::SampleAttributeSets(Num, Bytes);
+		}
+
+		return true;
+	}
+}
+
+FGBATestsStats::FCsvScope::FCsvScope(const UClass* InClass)
+{
+#if CSV_PROFILER && GBA_TESTS_STATS_ENABLED
+	if (InClass && FCsvProfiler::Get()->IsCapturing())
+	{
+		StatName = InClass->GetFName();
+		StartCycles = FPlatformTime::Cycles64();
+	}
+#endif
+}
+
+FGBATestsStats::FCsvScope::~FCsvScope()
+{
+#if CSV_PROFILER && GBA_TESTS_STATS_ENABLED
+	if (StartCycles != 0)
+	{
+		const double Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		FCsvProfiler::RecordCustomStat(StatName, CSV_CATEGORY_INDEX(BlueprintAttributes), static_cast<float>(Milliseconds), ECsvCustomStatOp::Accumulate);
+	}
+#endif
+}
+
+void FGBATestsStats::Initialize()
+{
+#if GBA_TESTS_STATS_ENABLED
+	if (!GBATestsStats::TickerHandle.IsValid())
+	{
+		GBATestsStats::TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&GBATestsStats::Tick), GBATestsStats::SamplePeriodSeconds);
+	}
+#endif
+}
+
+void FGBATestsStats::Shutdown()
+{
+#if GBA_TESTS_STATS_ENABLED
+	if (GBATestsStats::TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(GBATestsStats::TickerHandle);
+		GBATestsStats::TickerHandle.Reset();
+	}
+#endif
+}
+
+void FGBATestsStats::CountEffectApplication(const UGameplayEffect& InEffect)
+{
+#if GBA_TESTS_STATS_ENABLED
+	const int32 NumWrites = InEffect.Modifiers.Num();
+	INC_DWORD_STAT_BY(STAT_GBA_AttributeWrites, NumWrites);
+	CSV_CUSTOM_STAT(BlueprintAttributes, AttributeWrites, NumWrites, ECsvCustomStatOp::Accumulate);
+
+	if (InEffect.DurationPolicy == EGameplayEffectDurationType::Instant)
+	{
+		GBA_TESTS_STAT_INC(STAT_GBA_GameplayEffectExecutions, GameplayEffectExecutions);
+	}
+#endif
+}
+
+void FGBATestsStats::SampleAttributeSets(int32& OutNum, int64& OutBytes)
+{
+	OutNum = 0;
+	OutBytes = 0;
+
+	// Through the class hash (sets of derived classes included), not the whole object array
+	ForEachObjectOfClass(UGBAAttributeSetBlueprintBase::StaticClass(), [&OutNum, &OutBytes](const UObject* InObject)
+	{
+		++OutNum;
+		OutBytes += InObject->GetClass()->GetStructureSize();
+	}, true, RF_ClassDefaultObject | RF_ArchetypeObject);
+
+#if GBA_TESTS_STATS_ENABLED
+	SET_DWORD_STAT(STAT_GBA_NumAttributeSets, OutNum);
+	SET_MEMORY_STAT(STAT_GBA_AttributeSetsMemory, OutBytes);
+	CSV_CUSTOM_STAT(BlueprintAttributes, NumAttributeSets, OutNum, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(BlueprintAttributes, AttributeSetsMemoryKB, static_cast<float>(OutBytes / 1024.0), ECsvCustomStatOp::Set);
+#endif
+}
@@ -4,10 +4,13 @@
 #include "GBATestsStorageSubsystem.h"
 
 #include "GBATestsLog.h"
+#include "GBATestsStats.h"
+#include "GBATestsTrace.h"
 
 void UGBATestsStorageSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	Recorder.Initialize();
 
 	GBA_TESTS_LOG(Display, TEXT("UGBATestsStorageSubsystem::Initialize ..."))
 }
@@ -27,11 +30,15 @@ void UGBATestsStorageSubsystem::ResetStore()
 	StorePostAttributeChangePayload.Reset();
 	StorePreAttributeBaseChangePayload.Reset();
 	StorePostAttributeBaseChangePayload.Reset();
+	Recorder.Reset();
 }
 
 void UGBATestsStorageSubsystem::SetPreGameplayEffectExecutePayload(const FName Key, const FGBATestStorage_PreGameplayEffectExecutePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPreGameplayEffectExecute, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePreGameplayEffectExecutePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PreGameplayEffectExecutePayload UGBATestsStorageSubsystem::GetValueAsPreGameplayEffectExecutePayload(const FName Key) const
@@ -48,7 +55,10 @@ FGBATestStorage_PreGameplayEffectExecutePayload UGBATestsStorageSubsystem::GetVa
 
 void UGBATestsStorageSubsystem::SetPostGameplayEffectExecutePayload(const FName Key, const FGBATestStorage_PostGameplayEffectExecutePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPostGameplayEffectExecute, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePostGameplayEffectExecutePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PostGameplayEffectExecutePayload UGBATestsStorageSubsystem::GetValueAsPostGameplayEffectExecutePayload(const FName Key) const
@@ -65,7 +75,10 @@ FGBATestStorage_PostGameplayEffectExecutePayload UGBATestsStorageSubsystem::GetV
 
 void UGBATestsStorageSubsystem::SetPreAttributeChangePayload(const FName Key, const FGBATestStorage_PreAttributeChangePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPreAttributeChange, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePreAttributeChangePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PreAttributeChangePayload UGBATestsStorageSubsystem::GetValueAsPreAttributeChangePayload(const FName Key) const
@@ -82,7 +95,10 @@ FGBATestStorage_PreAttributeChangePayload UGBATestsStorageSubsystem::GetValueAsP
 
 void UGBATestsStorageSubsystem::SetPreAttributeBaseChangePayload(const FName Key, const FGBATestStorage_PreAttributeBaseChangePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPreAttributeBaseChange, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePreAttributeBaseChangePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PreAttributeBaseChangePayload UGBATestsStorageSubsystem::GetValueAsPreAttributeBaseChangePayload(const FName Key) const
@@ -99,7 +115,10 @@ FGBATestStorage_PreAttributeBaseChangePayload UGBATestsStorageSubsystem::GetValu
 
 void UGBATestsStorageSubsystem::SetPostAttributeBaseChangePayload(const FName Key, const FGBATestStorage_PostAttributeBaseChangePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPostAttributeBaseChange, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePostAttributeBaseChangePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PostAttributeBaseChangePayload UGBATestsStorageSubsystem::GetValueAsPostAttributeBaseChangePayload(const FName Key) const
@@ -116,7 +135,10 @@ FGBATestStorage_PostAttributeBaseChangePayload UGBATestsStorageSubsystem::GetVal
 
 void UGBATestsStorageSubsystem::SetPostAttributeChangePayload(const FName Key, const FGBATestStorage_PostAttributeChangePayload& Payload)
 {
+	GBA_TESTS_TRACE_SCOPE(RecordPostAttributeChange, Payload.Attribute);
+	GBA_TESTS_STAT_SCOPE(STAT_GBA_StorageRecord, nullptr);
 	StorePostAttributeChangePayload.Add(Key, Payload);
+	Recorder.Record(Key, Payload);
 }
 
 FGBATestStorage_PostAttributeChangePayload UGBATestsStorageSubsystem::GetValueAsPostAttributeChangePayload(const FName Key) const
@@ -0,0 +1,189 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsTrace.h"
+
+#if GBA_TESTS_TRACE_ENABLED
+
+#include "AttributeSet.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include <atomic>
+
+UE_TRACE_CHANNEL_DEFINE(GBATestsChannel);
+
+TRACE_DECLARE_INT_COUNTER(GBATests_EffectApply, TEXT("GBATests/EffectApply"));
+TRACE_DECLARE_INT_COUNTER(GBATests_GameplayEffectExecute, TEXT("GBATests/GameplayEffectExecute"));
+TRACE_DECLARE_INT_COUNTER(GBATests_AttributeChange, TEXT("GBATests/AttributeChange"));
+TRACE_DECLARE_INT_COUNTER(GBATests_AttributeClamp, TEXT("GBATests/AttributeClamp"));
+TRACE_DECLARE_INT_COUNTER(GBATests_DataTableInit, TEXT("GBATests/DataTableInit"));
+TRACE_DECLARE_INT_COUNTER(GBATests_MetaDataLookup, TEXT("GBATests/MetaDataLookup"));
+TRACE_DECLARE_INT_COUNTER(GBATests_StorageRecords, TEXT("GBATests/StorageRecords"));
+
+namespace GBATestsTrace
+{
+	using FEventKey = TTuple<EGBATestsTraceEvent, FName, FName>;
+
+	static TMap<FEventKey, uint32> SpecIds;
+	static FRWLock SpecIdsLock;
+
+	static constexpr int32 NumEvents = static_cast<int32>(EGBATestsTraceEvent::Num);
+
+	static std::atomic<uint64> NumEmitted[NumEvents];
+
+	/** [Event][EnclosingEvent] */
+	static std::atomic<uint64> NumEmittedWithin[NumEvents][NumEvents];
+
+	/** Scopes currently open on this thread, per event */
+	static thread_local int32 NumOpenScopes[NumEvents];
+}
+
+FGBATestsTrace::FScope::FScope(const EGBATestsTraceEvent InEvent, const FGameplayAttribute& InAttribute)
+	: Event(InEvent)
+{
+	if (IsEnabled())
+	{
+		const FProperty* Property = InAttribute.GetUProperty();
+		const UClass* Class = InAttribute.GetAttributeSetClass();
+		BeginEvent(InEvent, Class ? Class->GetFName() : NAME_None, Property ? Property->GetFName() : NAME_None);
+		bEnabled = true;
+	}
+}
+
+FGBATestsTrace::FScope::FScope(const EGBATestsTraceEvent InEvent, const UClass* InClass, const FName InAttributeName)
+	: Event(InEvent)
+{
+	if (IsEnabled())
+	{
+		BeginEvent(InEvent, InClass ? InClass->GetFName() : NAME_None, InAttributeName);
+		bEnabled = true;
+	}
+}
+
+FGBATestsTrace::FScope::~FScope()
+{
+	if (bEnabled)
+	{
+		EndEvent(Event);
+	}
+}
+
+uint64 FGBATestsTrace::GetNumEmitted(const EGBATestsTraceEvent InEvent)
+{
+	return GBATestsTrace::NumEmitted[static_cast<int32>(InEvent)].load(std::memory_order_relaxed);
+}
+
+uint64 FGBATestsTrace::GetNumEmittedWithin(const EGBATestsTraceEvent InEvent, const EGBATestsTraceEvent InEnclosingEvent)
+{
+	return GBATestsTrace::NumEmittedWithin[static_cast<int32>(InEvent)][static_cast<int32>(InEnclosingEvent)].load(std::memory_order_relaxed);
+}
+
+void FGBATestsTrace::ResetNumEmitted()
+{
+	using namespace GBATestsTrace;
+
+	for (int32 Event = 0; Event < NumEvents; ++Event)
+	{
+		NumEmitted[Event].store(0, std::memory_order_relaxed);
+		for (std::atomic<uint64>& Num : NumEmittedWithin[Event])
+		{
+			Num.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+const TCHAR* FGBATestsTrace::LexToString(const EGBATestsTraceEvent InEvent)
+{
+	switch (InEvent)
+	{
+	case EGBATestsTraceEvent::EffectApply: return TEXT("EffectApply");
+	case EGBATestsTraceEvent::GameplayEffectExecute: return TEXT("GameplayEffectExecute");
+	case EGBATestsTraceEvent::AttributeChange: return TEXT("AttributeChange");
+	case EGBATestsTraceEvent::AttributeClamp: return TEXT("AttributeClamp");
+	case EGBATestsTraceEvent::DataTableInit: return TEXT("DataTableInit");
+	case EGBATestsTraceEvent::MetaDataLookup: return TEXT("MetaDataLookup");
+	case EGBATestsTraceEvent::RecordPreGameplayEffectExecute: return TEXT("Record PreGameplayEffectExecute");
+	case EGBATestsTraceEvent::RecordPostGameplayEffectExecute: return TEXT("Record PostGameplayEffectExecute");
+	case EGBATestsTraceEvent::RecordPreAttributeChange: return TEXT("Record PreAttributeChange");
+	case EGBATestsTraceEvent::RecordPostAttributeChange: return TEXT("Record PostAttributeChange");
+	case EGBATestsTraceEvent::RecordPreAttributeBaseChange: return TEXT("Record PreAttributeBaseChange");
+	case EGBATestsTraceEvent::RecordPostAttributeBaseChange: return TEXT("Record PostAttributeBaseChange");
+	default: return TEXT("Unknown");
+	}
+}
+
+uint32 FGBATestsTrace::GetEventSpecId(const EGBATestsTraceEvent InEvent, const FName InClassName, const FName InAttributeName)
+{
+	using namespace GBATestsTrace;
+
+	const FEventKey Key(InEvent, InClassName, InAttributeName);
+	{
+		FReadScopeLock ReadLock(SpecIdsLock);
+		if (const uint32* SpecId = SpecIds.Find(Key))
+		{
+			return *SpecId;
+		}
+	}
+
+	const FString Name = InAttributeName.IsNone()
+		? FString::Printf(TEXT("GBA %s %s"), LexToString(InEvent), *InClassName.ToString())
+		: FString::Printf(TEXT("GBA %s %s.%s"), LexToString(InEvent), *InClassName.ToString(), *InAttributeName.ToString());
+
+	FWriteScopeLock WriteLock(SpecIdsLock);
+	if (const uint32* SpecId = SpecIds.Find(Key))
+	{
+		return *SpecId;
+	}
+
+	return SpecIds.Add(Key, FCpuProfilerTrace::OutputEventType(*Name));
+}
+
+void FGBATestsTrace::BeginEvent(const EGBATestsTraceEvent InEvent, const FName InClassName, const FName InAttributeName)
+{
+	using namespace GBATestsTrace;
+
+	FCpuProfilerTrace::OutputBeginEvent(GetEventSpecId(InEvent, InClassName, InAttributeName));
+
+	const int32 Event = static_cast<int32>(InEvent);
+	NumEmitted[Event].fetch_add(1, std::memory_order_relaxed);
+	for (int32 EnclosingEvent = 0; EnclosingEvent < NumEvents; ++EnclosingEvent)
+	{
+		if (NumOpenScopes[EnclosingEvent] > 0)
+		{
+			NumEmittedWithin[Event][EnclosingEvent].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	++NumOpenScopes[Event];
+
+	switch (InEvent)
+	{
+	case EGBATestsTraceEvent::EffectApply:
+		TRACE_COUNTER_INCREMENT(GBATests_EffectApply);
+		break;
+	case EGBATestsTraceEvent::GameplayEffectExecute:
+		TRACE_COUNTER_INCREMENT(GBATests_GameplayEffectExecute);
+		break;
+	case EGBATestsTraceEvent::AttributeChange:
+		TRACE_COUNTER_INCREMENT(GBATests_AttributeChange);
+		break;
+	case EGBATestsTraceEvent::AttributeClamp:
+		TRACE_COUNTER_INCREMENT(GBATests_AttributeClamp);
+		break;
+	case EGBATestsTraceEvent::DataTableInit:
+		TRACE_COUNTER_INCREMENT(GBATests_DataTableInit);
+		break;
+	case EGBATestsTraceEvent::MetaDataLookup:
+		TRACE_COUNTER_INCREMENT(GBATests_MetaDataLookup);
+		break;
+	default:
+		TRACE_COUNTER_INCREMENT(GBATests_StorageRecords);
+		break;
+	}
+}
+
+void FGBATestsTrace::EndEvent(const EGBATestsTraceEvent InEvent)
+{
+	FCpuProfilerTrace::OutputEndEvent();
+	--GBATestsTrace::NumOpenScopes[static_cast<int32>(InEvent)];
+}
+
+#endif
@@ -0,0 +1,76 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsVirtualClock.h"
+
+#include "AbilitySystemComponent.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+
+namespace GBATestsVirtualClock
+{
+	/** Steps are never shorter than this, so that a timer due right now can't stall the clock */
+	constexpr float MinStepSeconds = 1.e-4f;
+}
+
+int32 FGBATestsVirtualClock::Advance(UWorld* InWorld, float InSeconds, const TArrayView<const UAbilitySystemComponent* const> InASCs)
+{
+	check(InWorld);
+	FTimerManager& TimerManager = InWorld->GetTimerManager();
+
+	int32 NumSteps = 0;
+	while (InSeconds > 0.f)
+	{
+		float Step = InSeconds;
+
+		const float TimeUntilNextEvent = GetTimeUntilNextEvent(InWorld, InASCs);
+		if (TimeUntilNextEvent >= 0.f)
+		{
+			// Not FMath::Clamp(), which returns the min step when less than that remains and overshoots InSeconds
+			Step = FMath::Min(FMath::Max(TimeUntilNextEvent, GBATestsVirtualClock::MinStepSeconds), InSeconds);
+		}
+
+		// Durations are checked against world time when their timer fires, advance it first
+		InWorld->TimeSeconds += Step;
+		InWorld->UnpausedTimeSeconds += Step;
+		InWorld->RealTimeSeconds += Step;
+		InWorld->DeltaTimeSeconds = Step;
+
+		TimerManager.Tick(Step);
+		GFrameCounter++;
+
+		InSeconds -= Step;
+		++NumSteps;
+	}
+
+	return NumSteps;
+}
+
+float FGBATestsVirtualClock::GetTimeUntilNextEvent(const UWorld* InWorld, const TArrayView<const UAbilitySystemComponent* const> InASCs)
+{
+	check(InWorld);
+	const FTimerManager& TimerManager = InWorld->GetTimerManager();
+
+	float Result = -1.f;
+	for (const UAbilitySystemComponent* ASC : InASCs)
+	{
+		if (!IsValid(ASC))
+		{
+			continue;
+		}
+
+		for (FActiveGameplayEffectsContainer::ConstIterator It = ASC->GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+		{
+			for (const FTimerHandle& Handle : { It->PeriodHandle, It->DurationHandle })
+			{
+				// -1 for invalid or inactive timers
+				const float Remaining = TimerManager.GetTimerRemaining(Handle);
+				if (Remaining >= 0.f && (Result < 0.f || Remaining < Result))
+				{
+					Result = Remaining;
+				}
+			}
+		}
+	}
+
+	return Result;
+}
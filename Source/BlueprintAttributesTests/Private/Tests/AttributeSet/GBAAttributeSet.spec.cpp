@@ -32,9 +32,9 @@ void FGBAAttributeSetBlueprintBaseSpec::Define()
 		AddInfo(TEXT("Before Each ..."));
 
 		// Setup tests
-		World = CreateWorld(InitialFrameCounter);
+		AcquireWorld();
 
-		UClass* ActorClass = StaticLoadClass(UObject::StaticClass(), nullptr, FixtureCharacterLoadPath);
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
 		if (!IsValid(ActorClass))
 		{
 			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
@@ -61,7 +61,7 @@ void FGBAAttributeSetBlueprintBaseSpec::Define()
 		TestActor->DispatchBeginPlay();
 
 		// Grab fixture Attribute Set class for further use later on
-		TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, FixtureAttributeSetLoadPath);
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureAttributeSetLoadPath);
 		if (!IsValid(TestAttributeSetClass))
 		{
 			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureAttributeSetLoadPath));
@@ -106,7 +106,7 @@ void FGBAAttributeSetBlueprintBaseSpec::Define()
 		It(TEXT("should have value changed after application of override instant GE"), [this]()
 		{
 			// Grab fixture Attribute Set class for further use later on
-			const TSubclassOf<UGameplayEffect> Effect = StaticLoadClass(UGameplayEffect::StaticClass(), nullptr, FixtureGameplayEffectLoadPath);
+			const TSubclassOf<UGameplayEffect> Effect = LoadFixtureClass(UGameplayEffect::StaticClass(), FixtureGameplayEffectLoadPath);
 			if (!IsValid(Effect))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureGameplayEffectLoadPath));
@@ -198,7 +198,7 @@ void FGBAAttributeSetBlueprintBaseSpec::Define()
 			TestAttributeValue(TEXT("Faith"), 0.f);
 			TestAttributeValue(TEXT("Luck"), 0.f);
 
-			const TSubclassOf<UGameplayEffect> Effect = StaticLoadClass(UGameplayEffect::StaticClass(), nullptr, FixtureGameplayEffectLoadPath);
+			const TSubclassOf<UGameplayEffect> Effect = LoadFixtureClass(UGameplayEffect::StaticClass(), FixtureGameplayEffectLoadPath);
 			if (!IsValid(Effect))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureGameplayEffectLoadPath));
@@ -515,13 +515,7 @@ void FGBAAttributeSetBlueprintBaseSpec::Define()
 	{
 		AddInfo(TEXT("After Each ..."));
 
-		// Destroy the actors
-		if (TestActor)
-		{
-			World->EditorDestroyActor(TestActor, false);
-		}
-
-		// Destroy World
-		TeardownWorld(World, InitialFrameCounter);
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
 	});
 }
@@ -0,0 +1,183 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAllocationCounter.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetAllocationsSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBAAttributeSetAllocations", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureStatsAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureStatsInitEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+	static constexpr const TCHAR* FixtureClampAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Clamping.GBA_Test_Clamping_C");
+	static constexpr const TCHAR* FixtureClampDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Clamp");
+	static constexpr const TCHAR* FixtureClampedAddEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Clamped_Add.GE_Test_Clamped_Add_C");
+
+	/** As many warm-up iterations as measured ones, so that measured events only reuse recorder slots */
+	static constexpr int32 NumIterations = 256;
+	static constexpr int32 NumWarmupIterations = NumIterations;
+
+	/** Counts InOp allocations (see CountAllocations()), reports them, and expects none if bInExpectZero */
+	void TestAllocations(const FString& InWhat, const bool bInExpectZero, const TFunctionRef<void()> InOp)
+	{
+		if (!FGBATestsScopedAllocationCounter::IsSupported())
+		{
+			AddWarning(FString::Printf(TEXT("%s: allocations can't be observed on this platform, skipping"), *InWhat));
+			return;
+		}
+
+		const uint64 NumAllocations = CountAllocations(NumWarmupIterations, NumIterations, InOp);
+		AddInfo(FString::Printf(TEXT("%s: %llu allocations over %d iterations (%.2f per op)"), *InWhat, NumAllocations, NumIterations, static_cast<double>(NumAllocations) / NumIterations));
+
+		if (bInExpectZero)
+		{
+			TestTrue(FString::Printf(TEXT("%s doesn't allocate after warm-up"), *InWhat), NumAllocations == 0);
+		}
+	}
+
+	void GrantAttributeSet(const TCHAR* InLoadPath, const UDataTable* InDataTable = nullptr)
+	{
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), InLoadPath);
+		if (!IsValid(TestAttributeSetClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), InLoadPath));
+			return;
+		}
+
+		if (!HasAttributeSet(TestASC, TestAttributeSetClass))
+		{
+			TestASC->InitStats(TestAttributeSetClass, InDataTable);
+		}
+
+		TestAttributeSet = Cast<UGBAAttributeSetBlueprintBase>(const_cast<UAttributeSet*>(TestASC->GetAttributeSet(TestAttributeSetClass)));
+		if (!TestAttributeSet)
+		{
+			AddError(FString::Printf(TEXT("Couldn't get attribute set or cast to UGBAAttributeSetBlueprintBase")));
+		}
+	}
+
+	/** Read, write and clamp paths of InAttributeName on the current TestAttributeSet */
+	void DefineHotPaths(const FName& InAttributeName, const bool bInExpectZeroWrites)
+	{
+		Describe(InAttributeName.ToString(), [this, InAttributeName, bInExpectZeroWrites]()
+		{
+			It(TEXT("GetAttributeValue()"), [this, InAttributeName]()
+			{
+				const FGameplayAttribute Attribute = GetAttributeProperty(TestAttributeSetClass, InAttributeName);
+				float Sum = 0.f;
+
+				TestAllocations(TEXT("GetAttributeValue"), true, [this, &Attribute, &Sum]()
+				{
+					bool bFound = false;
+					Sum += TestAttributeSet->GetAttributeValue(Attribute, bFound);
+				});
+			});
+
+			It(TEXT("SetAttributeValue()"), [this, InAttributeName, bInExpectZeroWrites]()
+			{
+				const FGameplayAttribute Attribute = GetAttributeProperty(TestAttributeSetClass, InAttributeName);
+				int32 Iteration = 0;
+
+				TestAllocations(TEXT("SetAttributeValue"), bInExpectZeroWrites, [this, &Attribute, &Iteration]()
+				{
+					TestAttributeSet->SetAttributeValue(Attribute, ++Iteration % 2 ? 12.f : 13.f);
+				});
+			});
+
+			It(TEXT("ClampAttributeValue()"), [this, InAttributeName, bInExpectZeroWrites]()
+			{
+				const FGameplayAttribute Attribute = GetAttributeProperty(TestAttributeSetClass, InAttributeName);
+
+				TestAllocations(TEXT("SetAttributeValue + ClampAttributeValue"), bInExpectZeroWrites, [this, &Attribute]()
+				{
+					TestAttributeSet->SetAttributeValue(Attribute, 99.f);
+					TestAttributeSet->ClampAttributeValue(Attribute, 0.f, 25.f);
+				});
+			});
+		});
+	}
+
+	/** Reports GE application allocations, as those involve spec and context allocations by design */
+	void DefineEffectApplication(const TCHAR* InEffectLoadPath)
+	{
+		It(TEXT("Gameplay Effect application"), [this, InEffectLoadPath]()
+		{
+			const TSubclassOf<UGameplayEffect> EffectClass = LoadFixtureClass(UGameplayEffect::StaticClass(), InEffectLoadPath);
+			if (!IsValid(EffectClass))
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), InEffectLoadPath));
+				return;
+			}
+
+			TestAllocations(FString::Printf(TEXT("Apply %s"), *EffectClass->GetName()), false, [this, &EffectClass]()
+			{
+				TestASC->BP_ApplyGameplayEffectToSelf(EffectClass, 1.f, TestASC->MakeEffectContext());
+			});
+		});
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeSetAllocationsSpec)
+
+void FGBAAttributeSetAllocationsSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return;
+		}
+
+		TestActor = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!TestASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+			return;
+		}
+
+		TestActor->DispatchBeginPlay();
+	});
+
+	// Blueprint events of GBA_Test_Stats build their storage keys with Format Text and String To Name, which allocates
+	// on every write by design of the fixture. Its write paths are only reported, reads must not allocate.
+	Describe(TEXT("GBA_Test_Stats"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			GrantAttributeSet(FixtureStatsAttributeSetLoadPath);
+		});
+
+		DefineHotPaths(TEXT("Vitality"), false);
+		DefineEffectApplication(FixtureStatsInitEffectLoadPath);
+	});
+
+	Describe(TEXT("GBA_Test_Clamping"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			GrantAttributeSet(FixtureClampAttributeSetLoadPath, StaticLoadDataTable(FixtureClampDataTableLoadPath));
+		});
+
+		DefineHotPaths(TEXT("TestDTClamp"), true);
+		DefineHotPaths(TEXT("TestBoth"), true);
+		DefineEffectApplication(FixtureClampedAddEffectLoadPath);
+	});
+
+	AfterEach([this]()
+	{
+		ReleaseWorld();
+	});
+}
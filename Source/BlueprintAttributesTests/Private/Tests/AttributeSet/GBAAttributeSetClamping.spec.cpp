@@ -39,9 +39,9 @@ void FGBAAttributeSetClampingSpec::Define()
 		AddInfo(TEXT("Before Each ..."));
 
 		// Setup tests
-		World = CreateWorld(InitialFrameCounter);
+		AcquireWorld();
 
-		UClass* ActorClass = StaticLoadClass(UObject::StaticClass(), nullptr, FixtureCharacterLoadPath);
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
 		if (!IsValid(ActorClass))
 		{
 			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
@@ -66,6 +66,9 @@ void FGBAAttributeSetClampingSpec::Define()
 
 		// Make sure BeginPlay is invoked (this is where fixture char is granting attributes)
 		TestActor->DispatchBeginPlay();
+
+		// Regen checks span dozens of periods, jump from one effect timer to the next
+		bUseVirtualClock = true;
 	});
 
 	DescribeAttributeClamp(TEXT("Clamping (Attribute Based - Health)"), TEXT("GBA_Test_HealthSet"), [this]()
@@ -93,7 +96,7 @@ void FGBAAttributeSetClampingSpec::Define()
 		BeforeEach([this]()
 		{
 			// Grab fixture Attribute Set class for further use later on
-			TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, FixtureClampAttributeSetLoadPath);
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
 			if (!IsValid(TestAttributeSetClass))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureClampAttributeSetLoadPath));
@@ -209,7 +212,7 @@ void FGBAAttributeSetClampingSpec::Define()
 		It(TEXT("Should clamp property even with DataTable BaseValue higher (and without valid clamp range)"), [this]()
 		{
 			// Grab fixture Attribute Set class for further use later on
-			const UClass* AttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, FixtureClampAttributeSetLoadPath);
+			const UClass* AttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
 			if (!IsValid(AttributeSetClass))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureClampAttributeSetLoadPath));
@@ -237,13 +240,7 @@ void FGBAAttributeSetClampingSpec::Define()
 	{
 		AddInfo(TEXT("After Each ..."));
 
-		// Destroy the actors
-		if (TestActor)
-		{
-			World->EditorDestroyActor(TestActor, false);
-		}
-
-		// Destroy World
-		TeardownWorld(World, InitialFrameCounter);
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
 	});
 }
@@ -0,0 +1,281 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsBenchmark.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Parse.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Spawns crowds of fixture characters with attribute based clamping and regen sets, and runs a scripted combat load
+ * on them. Crowd sizes and duration can be set from the command line:
+ *
+ *   -GBACrowdSizes=500,1000,2500,5000 -GBACrowdSeconds=10
+ *
+ * Each crowd size reports a CSV row (see CsvHeader), rows across sizes plot as a scaling curve. BytesPerActor is the
+ * heap the spawn retains (-1 when the allocator can't tell), loop GC is a full purge every simulated second (not part
+ * of tick times), and post-run GC a last one with the crowd still alive.
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetCrowdStressSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Stress.Crowd", EAutomationTestFlags::StressFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureHealthSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthSet.GBA_Test_HealthSet_C");
+	static constexpr const TCHAR* FixtureHealthRegenSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthRegenSet.GBA_Test_HealthRegenSet_C");
+	static constexpr const TCHAR* FixtureDamageEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_Damage.GE_Test_Damage_C");
+	static constexpr const TCHAR* FixtureHealthRegenEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_HealthRegen.GE_Test_HealthRegen_C");
+
+	static constexpr int32 MaxCrowdSize = 10000;
+	static constexpr float TickDeltaSeconds = 0.1f;
+
+	/** Share of the crowd hit by damage each tick (every actor about once a second), and buffed each second */
+	static constexpr int32 DamageDivisor = 10;
+	static constexpr int32 BuffDivisor = 20;
+
+	static constexpr const TCHAR* CsvHeader = TEXT("NumActors,Seconds,TickMeanMs,TickP50Ms,TickP99Ms,TickMaxMs,BytesPerActor,LoopGCMeanMs,LoopGCMaxMs,PostRunGCMs");
+
+	TArray<ACharacter*> Crowd;
+	TArray<UAbilitySystemComponent*> CrowdASCs;
+
+	static TArray<int32> GetCrowdSizes()
+	{
+		TArray<int32> Sizes = { 100, 500, 1000, 2500, 5000 };
+
+		FString SizesParam;
+		if (FParse::Value(FCommandLine::Get(), TEXT("GBACrowdSizes="), SizesParam, false))
+		{
+			TArray<FString> Values;
+			SizesParam.ParseIntoArray(Values, TEXT(","));
+
+			Sizes.Reset();
+			for (const FString& Value : Values)
+			{
+				Sizes.Add(FMath::Clamp(FCString::Atoi(*Value), 1, MaxCrowdSize));
+			}
+		}
+
+		return Sizes;
+	}
+
+	static float GetCombatSeconds()
+	{
+		float Seconds = 10.f;
+		FParse::Value(FCommandLine::Get(), TEXT("GBACrowdSeconds="), Seconds);
+		return FMath::Max(Seconds, TickDeltaSeconds);
+	}
+
+	/** Loads every fixture up front, so that spawn memory and tick times don't account for it */
+	bool PreloadFixtures()
+	{
+		for (const TCHAR* LoadPath : { FixtureCharacterLoadPath, FixtureHealthSetLoadPath, FixtureHealthRegenSetLoadPath, FixtureDamageEffectLoadPath, FixtureHealthRegenEffectLoadPath })
+		{
+			if (!IsValid(LoadFixtureClass(UObject::StaticClass(), LoadPath)))
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), LoadPath));
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool SpawnCrowd(const int32 InNumActors)
+	{
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		const TSubclassOf<UAttributeSet> HealthSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath);
+		const TSubclassOf<UAttributeSet> HealthRegenSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthRegenSetLoadPath);
+		if (!IsValid(ActorClass) || !IsValid(HealthSetClass) || !IsValid(HealthRegenSetClass))
+		{
+			AddError(TEXT("Unable to load fixtures"));
+			return false;
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		// Laid out on a grid, so that characters don't collide
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(InNumActors)));
+		Crowd.Reserve(InNumActors);
+		CrowdASCs.Reserve(InNumActors);
+
+		for (int32 Index = 0; Index < InNumActors; ++Index)
+		{
+			const FVector Location((Index % GridSize) * 200.f, (Index / GridSize) * 200.f, 0.f);
+			ACharacter* Character = Cast<ACharacter>(World->SpawnActor(ActorClass, &Location, nullptr, SpawnParameters));
+			UAbilitySystemComponent* ASC = Character ? Character->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+			if (!ASC)
+			{
+				AddError(FString::Printf(TEXT("Unable to setup crowd actor %d from %s"), Index, *GetNameSafe(ActorClass)));
+				return false;
+			}
+
+			Character->DispatchBeginPlay();
+			ASC->InitStats(HealthSetClass, nullptr);
+			ASC->InitStats(HealthRegenSetClass, nullptr);
+
+			Crowd.Add(Character);
+			CrowdASCs.Add(ASC);
+		}
+
+		return true;
+	}
+
+	/** Timed world ticks under combat load: regen on everyone, rolling damage and short buffs, and a timed GC each second */
+	TArray<double> RunCombat(const float InSeconds, TArray<double>& OutGCSamples)
+	{
+		const TSubclassOf<UGameplayEffect> DamageEffect = LoadFixtureClass(UGameplayEffect::StaticClass(), FixtureDamageEffectLoadPath);
+		const TSubclassOf<UGameplayEffect> RegenEffect = LoadFixtureClass(UGameplayEffect::StaticClass(), FixtureHealthRegenEffectLoadPath);
+		if (!IsValid(DamageEffect) || !IsValid(RegenEffect))
+		{
+			AddError(TEXT("Unable to load fixture effects"));
+			return {};
+		}
+
+		// Temporary MaxHealth buff, kept alive across the loop GCs
+		const TStrongObjectPtr<UGameplayEffect> BuffEffect(NewObject<UGameplayEffect>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UGameplayEffect::StaticClass(), TEXT("CrowdBuffEffect"))));
+		AddModifier(BuffEffect.Get(), FindFieldChecked<FProperty>(LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath), TEXT("MaxHealth")), EGameplayModOp::Additive, FScalableFloat(20.f));
+		BuffEffect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+		BuffEffect->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(2.f));
+
+		for (UAbilitySystemComponent* ASC : CrowdASCs)
+		{
+			ASC->BP_ApplyGameplayEffectToSelf(RegenEffect, 1.f, ASC->MakeEffectContext());
+		}
+
+		const int32 NumTicks = FMath::CeilToInt(InSeconds / TickDeltaSeconds);
+		const int32 TicksPerSecond = FMath::RoundToInt(1.f / TickDeltaSeconds);
+		const int32 NumDamagedPerTick = FMath::Max(1, CrowdASCs.Num() / DamageDivisor);
+		const int32 NumBuffedPerSecond = FMath::Max(1, CrowdASCs.Num() / BuffDivisor);
+
+		TArray<double> TickSamples;
+		TickSamples.Reserve(NumTicks);
+
+		int32 NextDamaged = 0;
+		int32 NextBuffed = 0;
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			for (int32 Index = 0; Index < NumDamagedPerTick; ++Index)
+			{
+				UAbilitySystemComponent* ASC = CrowdASCs[NextDamaged++ % CrowdASCs.Num()];
+				ASC->BP_ApplyGameplayEffectToSelf(DamageEffect, 1.f, ASC->MakeEffectContext());
+			}
+
+			if (Tick % TicksPerSecond == 0)
+			{
+				for (int32 Index = 0; Index < NumBuffedPerSecond; ++Index)
+				{
+					UAbilitySystemComponent* ASC = CrowdASCs[NextBuffed++ % CrowdASCs.Num()];
+					ASC->ApplyGameplayEffectToSelf(BuffEffect.Get(), 1.f, ASC->MakeEffectContext());
+				}
+			}
+
+			TickWorld(World, TickDeltaSeconds);
+
+			TickSamples.Add(FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - StartCycles));
+
+			// Expired buffs and effect specs are garbage by now, reachability analysis scales with the crowd
+			if ((Tick + 1) % TicksPerSecond == 0)
+			{
+				const uint64 GCStartCycles = FPlatformTime::Cycles64();
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+				OutGCSamples.Add(FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - GCStartCycles));
+			}
+		}
+
+		return TickSamples;
+	}
+
+	void RunCrowd(const int32 InNumActors)
+	{
+		const float Seconds = GetCombatSeconds();
+
+		if (!PreloadFixtures())
+		{
+			return;
+		}
+
+		double BytesPerActor = -1.0;
+		{
+			const FGBATestsScopedAllocationCounter Counter;
+			if (!SpawnCrowd(InNumActors))
+			{
+				return;
+			}
+
+			if (FGBATestsScopedAllocationCounter::IsRetainedSizeSupported())
+			{
+				BytesPerActor = static_cast<double>(Counter.GetNumRetainedBytes()) / InNumActors;
+			}
+		}
+
+		TArray<double> GCSamples;
+		const TArray<double> TickSamples = RunCombat(Seconds, GCSamples);
+		const FGBATestsBenchmarkStats TickStats = FGBATestsBenchmarkStats::Compute(TickSamples);
+		const double TickMax = TickSamples.IsEmpty() ? 0.0 : FMath::Max(TickSamples);
+		const FGBATestsBenchmarkStats GCStats = FGBATestsBenchmarkStats::Compute(GCSamples);
+		const double GCMax = GCSamples.IsEmpty() ? 0.0 : FMath::Max(GCSamples);
+
+		// Full purge with the crowd alive, after the run
+		const uint64 GCStartCycles = FPlatformTime::Cycles64();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		const double PostRunGCMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - GCStartCycles);
+
+		AddInfo(CsvHeader);
+		AddInfo(FString::Printf(
+			TEXT("%d,%.1f,%.3f,%.3f,%.3f,%.3f,%.0f,%.3f,%.3f,%.3f"),
+			InNumActors,
+			Seconds,
+			TickStats.Mean / 1000000.0,
+			TickStats.Median / 1000000.0,
+			TickStats.P99 / 1000000.0,
+			TickMax / 1000000.0,
+			BytesPerActor,
+			GCStats.Mean / 1000000.0,
+			GCMax / 1000000.0,
+			PostRunGCMs
+		));
+
+		TestEqual(TEXT("Number of ticks"), TickStats.NumSamples, FMath::CeilToInt(Seconds / TickDeltaSeconds));
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeSetCrowdStressSpec)
+
+void FGBAAttributeSetCrowdStressSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = CreateWorld(InitialFrameCounter);
+	});
+
+	for (const int32 CrowdSize : GetCrowdSizes())
+	{
+		It(FString::Printf(TEXT("should sustain combat load with %d actors"), CrowdSize), [this, CrowdSize]()
+		{
+			RunCrowd(CrowdSize);
+		});
+	}
+
+	AfterEach([this]()
+	{
+		for (ACharacter* Character : Crowd)
+		{
+			World->EditorDestroyActor(Character, false);
+		}
+
+		Crowd.Reset();
+		CrowdASCs.Reset();
+		TeardownWorld(World, InitialFrameCounter);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
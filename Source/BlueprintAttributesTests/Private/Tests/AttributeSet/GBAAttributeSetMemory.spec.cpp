@@ -0,0 +1,270 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Parse.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Memory footprint of generated Blueprint attribute sets as their number of attributes grows, split between memory
+ * shared by all instances of a class (class, properties, CDO and meta data DataTable) and memory each instance adds:
+ *
+ * - Object: the attribute set UObject, with its attribute values (and clamping definitions for clamped attributes)
+ * - Init: what InitFromMetaDataTable() keeps around, such as per attribute meta data used for clamping
+ * - ASC: the owning ability system component bookkeeping of the set
+ *
+ * Sizes are net heap growth as reported by the allocator (see FGBATestsScopedAllocationCounter::GetNumRetainedBytes()),
+ * averaged over several instances. Attribute counts, clamped ratio (of both attribute types and DataTable rows) and the
+ * per attribute budget can be set from the command line:
+ *
+ *   -GBAMemoryAttributeCounts=8,64,256,1024 -GBAMemoryClampedRatio=0.5 -GBAMemoryBytesPerAttributeBudget=512
+ *
+ * Fails when per instance memory grows by more than the budget per added attribute between two attribute counts.
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetMemorySpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Perf.GBAAttributeSetMemory", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 MaxNumAttributes = 8192;
+
+	/** Instances measured (and averaged) for each attribute count */
+	static constexpr int32 NumInstances = 8;
+
+	static constexpr const TCHAR* CsvHeader = TEXT("NumAttributes,ClassBytes,DataTableBytes,ObjectBytes,PropertyBytes,InitBytes,ASCBytes,PerInstanceBytes,PerInstanceBytesPerAttribute");
+
+	struct FFootprint
+	{
+		int32 NumAttributes = 0;
+
+		/** Shared by all instances */
+		int64 ClassBytes = 0;
+		int64 DataTableBytes = 0;
+
+		/** Per instance */
+		int64 ObjectBytes = 0;
+		int64 PropertyBytes = 0;
+		int64 InitBytes = 0;
+		int64 ASCBytes = 0;
+
+		int64 GetPerInstanceBytes() const
+		{
+			return ObjectBytes + InitBytes + ASCBytes;
+		}
+	};
+
+	TArray<UAbilitySystemComponent*> ASCs;
+	TArray<UObject*> GeneratedObjects;
+
+	static TArray<int32> GetAttributeCounts()
+	{
+		TArray<int32> Counts = { 8, 64, 256, 1024 };
+
+		FString CountsParam;
+		if (FParse::Value(FCommandLine::Get(), TEXT("GBAMemoryAttributeCounts="), CountsParam, false))
+		{
+			TArray<FString> Values;
+			CountsParam.ParseIntoArray(Values, TEXT(","));
+
+			Counts.Reset();
+			for (const FString& Value : Values)
+			{
+				Counts.AddUnique(FMath::Clamp(FCString::Atoi(*Value), 1, MaxNumAttributes));
+			}
+			Counts.Sort();
+		}
+
+		return Counts;
+	}
+
+	static float GetClampedRatio()
+	{
+		float Ratio = 0.5f;
+		FParse::Value(FCommandLine::Get(), TEXT("GBAMemoryClampedRatio="), Ratio);
+		return FMath::Clamp(Ratio, 0.f, 1.f);
+	}
+
+	static double GetBytesPerAttributeBudget()
+	{
+		double Budget = 512.0;
+		FParse::Value(FCommandLine::Get(), TEXT("GBAMemoryBytesPerAttributeBudget="), Budget);
+		return Budget;
+	}
+
+	static int64 Measure(const TFunctionRef<void()> InOp)
+	{
+		const FGBATestsScopedAllocationCounter Counter;
+		InOp();
+		return Counter.GetNumRetainedBytes();
+	}
+
+	bool SpawnOwners()
+	{
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return false;
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const FVector Location(Index * 200.f, 0.f, 0.f);
+			ACharacter* Character = Cast<ACharacter>(World->SpawnActor(ActorClass, &Location, nullptr, SpawnParameters));
+			UAbilitySystemComponent* ASC = Character ? Character->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+			if (!ASC)
+			{
+				AddError(FString::Printf(TEXT("Unable to setup owner %d from %s"), Index, *GetNameSafe(ActorClass)));
+				return false;
+			}
+
+			Character->DispatchBeginPlay();
+			ASCs.Add(ASC);
+		}
+
+		return true;
+	}
+
+	/** Generates a set of InNumAttributes, and measures shared and per instance memory (averaged over NumInstances) */
+	FFootprint MeasureFootprint(const int32 InNumAttributes, const float InClampedRatio)
+	{
+		FFootprint Footprint;
+		Footprint.NumAttributes = InNumAttributes;
+
+		FGBATestsAttributeSetGeneratorParams Params;
+		Params.NumAttributes = InNumAttributes;
+		Params.ClampedRatio = InClampedRatio;
+		Params.DataTableClampedRatio = InClampedRatio;
+
+		UClass* AttributeSetClass = nullptr;
+		Footprint.ClassBytes = Measure([&AttributeSetClass, &Params]()
+		{
+			AttributeSetClass = FGBATestsAttributeSetGenerator::CreateAttributeSetClass(FString::Printf(TEXT("GBA_Test_Memory_%d"), Params.NumAttributes), Params);
+		});
+		GeneratedObjects.Add(AttributeSetClass);
+
+		UDataTable* DataTable = nullptr;
+		Footprint.DataTableBytes = Measure([&DataTable, AttributeSetClass, &Params]()
+		{
+			DataTable = FGBATestsAttributeSetGenerator::CreateMetaDataTable(AttributeSetClass, Params);
+		});
+
+		Footprint.PropertyBytes = AttributeSetClass->GetStructureSize() - UGBAAttributeSetBlueprintBase::StaticClass()->GetStructureSize();
+
+		// Same steps as UAbilitySystemComponent::InitStats(), measured apart
+		for (UAbilitySystemComponent* ASC : ASCs)
+		{
+			UAttributeSet* AttributeSet = nullptr;
+			Footprint.ObjectBytes += Measure([&AttributeSet, ASC, AttributeSetClass]()
+			{
+				AttributeSet = NewObject<UAttributeSet>(ASC->GetOwner(), AttributeSetClass);
+			});
+
+			Footprint.InitBytes += Measure([AttributeSet, DataTable]()
+			{
+				AttributeSet->InitFromMetaDataTable(DataTable);
+			});
+
+			Footprint.ASCBytes += Measure([AttributeSet, ASC]()
+			{
+				ASC->AddSpawnedAttribute(AttributeSet);
+			});
+		}
+
+		Footprint.ObjectBytes /= NumInstances;
+		Footprint.InitBytes /= NumInstances;
+		Footprint.ASCBytes /= NumInstances;
+		return Footprint;
+	}
+
+	static FString ToCsvRow(const FFootprint& InFootprint)
+	{
+		return FString::Printf(
+			TEXT("%d,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%.1f"),
+			InFootprint.NumAttributes,
+			InFootprint.ClassBytes,
+			InFootprint.DataTableBytes,
+			InFootprint.ObjectBytes,
+			InFootprint.PropertyBytes,
+			InFootprint.InitBytes,
+			InFootprint.ASCBytes,
+			InFootprint.GetPerInstanceBytes(),
+			static_cast<double>(InFootprint.GetPerInstanceBytes()) / InFootprint.NumAttributes
+		);
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeSetMemorySpec)
+
+void FGBAAttributeSetMemorySpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+	});
+
+	It(TEXT("should report shared and per instance memory as attribute count grows"), [this]()
+	{
+		if (!FGBATestsScopedAllocationCounter::IsRetainedSizeSupported())
+		{
+			AddWarning(FString::Printf(TEXT("Retained bytes can't be observed with %s, skipping"), GMalloc->GetDescriptiveName()));
+			return;
+		}
+
+		if (!SpawnOwners())
+		{
+			return;
+		}
+
+		const float ClampedRatio = GetClampedRatio();
+		const double Budget = GetBytesPerAttributeBudget();
+
+		TArray<FFootprint> Footprints;
+		for (const int32 NumAttributes : GetAttributeCounts())
+		{
+			Footprints.Add(MeasureFootprint(NumAttributes, ClampedRatio));
+		}
+
+		AddInfo(FString::Printf(TEXT("%d instances per attribute count, %.0f%% clamped attributes"), NumInstances, ClampedRatio * 100.f));
+		AddInfo(CsvHeader);
+		for (const FFootprint& Footprint : Footprints)
+		{
+			AddInfo(ToCsvRow(Footprint));
+		}
+
+		for (int32 Index = 1; Index < Footprints.Num(); ++Index)
+		{
+			const FFootprint& Previous = Footprints[Index - 1];
+			const FFootprint& Current = Footprints[Index];
+			const double Growth = static_cast<double>(Current.GetPerInstanceBytes() - Previous.GetPerInstanceBytes()) / (Current.NumAttributes - Previous.NumAttributes);
+			TestTrue(
+				FString::Printf(TEXT("Per instance growth from %d to %d attributes (%.1f bytes per attribute) within budget (%.0f)"), Previous.NumAttributes, Current.NumAttributes, Growth, Budget),
+				Growth <= Budget
+			);
+		}
+	});
+
+	AfterEach([this]()
+	{
+		ASCs.Reset();
+		ReleaseWorld();
+
+		for (UObject* Object : GeneratedObjects)
+		{
+			FGBATestsAttributeSetGenerator::Destroy(Object);
+		}
+		GeneratedObjects.Reset();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
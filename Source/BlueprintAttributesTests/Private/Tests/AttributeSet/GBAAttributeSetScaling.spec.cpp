@@ -0,0 +1,98 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "GBATestsBenchmark.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * How attribute set hot paths scale with the number of attributes of generated Blueprint attribute sets, each sweep
+ * reporting time per operation relative to the smallest set (see GBA_BENCHMARK_SWEEP).
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetScalingSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Perf.GBAAttributeSetScaling", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumAttributes = 256;
+
+	TArray<UObject*> GeneratedObjects;
+
+	FGBATestsGeneratedAttributeSet Generated;
+	FGameplayAttribute LastAttribute;
+
+	/** Generates a set of InNumAttributes attributes (half of them clamped), and an instance initialized from its DataTable */
+	UGBAAttributeSetBlueprintBase* GenerateAttributeSet(const int32 InNumAttributes)
+	{
+		FGBATestsAttributeSetGeneratorParams Params;
+		Params.NumAttributes = InNumAttributes;
+		Params.ClampedRatio = 0.5f;
+		Params.DataTableClampedRatio = 0.5f;
+
+		Generated = FGBATestsAttributeSetGenerator::Generate(FString::Printf(TEXT("GBA_Test_Scaling_%d"), InNumAttributes), Params);
+		GeneratedObjects.Add(Generated.Class);
+
+		UGBAAttributeSetBlueprintBase* AttributeSet = NewObject<UGBAAttributeSetBlueprintBase>(GetTransientPackage(), Generated.Class);
+		AttributeSet->InitFromMetaDataTable(Generated.DataTable);
+		GeneratedObjects.Add(AttributeSet);
+
+		LastAttribute = GetAttributeProperty(Generated.Class, FGBATestsAttributeSetGenerator::GetAttributeName(InNumAttributes - 1));
+		return AttributeSet;
+	}
+
+END_DEFINE_SPEC(FGBAAttributeSetScalingSpec)
+
+void FGBAAttributeSetScalingSpec::Define()
+{
+	GBA_BENCHMARK_SWEEP(TEXT("InitFromMetaDataTable()"), (8, 64, 256, 1024), {
+		UGBAAttributeSetBlueprintBase* AttributeSet = GenerateAttributeSet(Size);
+		const UDataTable* DataTable = Generated.DataTable;
+		return [AttributeSet, DataTable]()
+		{
+			AttributeSet->InitFromMetaDataTable(DataTable);
+		};
+	});
+
+	GBA_BENCHMARK_SWEEP(TEXT("GetAttributeValue()"), (8, 64, 256, 1024), {
+		const UGBAAttributeSetBlueprintBase* AttributeSet = GenerateAttributeSet(Size);
+		const FGameplayAttribute Attribute = LastAttribute;
+		return [AttributeSet, Attribute]()
+		{
+			bool bFound = false;
+			FGBATestsBenchmark::DoNotOptimize(AttributeSet->GetAttributeValue(Attribute, bFound));
+		};
+	});
+
+	Describe(TEXT("Class meta data"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			GenerateAttributeSet(NumAttributes);
+		});
+
+		GBA_BENCHMARK(TEXT("FGBATestsAttributeClassInfo::FindOrAdd()"), {
+			FGBATestsBenchmark::DoNotOptimize(FGBATestsAttributeClassInfo::FindOrAdd(Generated.Class));
+		});
+
+		GBA_BENCHMARK(TEXT("FGBATestsAttributeClassInfo::FindIndex()"), {
+			FGBATestsBenchmark::DoNotOptimize(FGBATestsAttributeClassInfo::FindOrAdd(Generated.Class)->FindIndex(LastAttribute.GetUProperty()->GetFName()));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		for (UObject* Object : GeneratedObjects)
+		{
+			FGBATestsAttributeSetGenerator::Destroy(Object);
+		}
+		GeneratedObjects.Reset();
+		Generated = FGBATestsGeneratedAttributeSet();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
@@ -0,0 +1,453 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsBenchmark.h"
+#include "GBATestsLatencyHistogram.h"
+#include "GBATestsStats.h"
+#include "GameplayEffect.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Character.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Long running soak of fixture characters, under a randomized but seeded mix of Gameplay Effect application,
+ * clamping, DataTable init and respawns. Duration, seed, sample period and number of actors can be set from the
+ * command line:
+ *
+ *   -GBASoakSeconds=3600 -GBASoakSeed=1337 -GBASoakSampleSeconds=10 -GBASoakActors=64
+ *
+ * Every sample period, throughput, latency percentiles (over that period) and memory are appended to
+ * Saved/BlueprintAttributesTests/Soak/Soak_<Seed>_<Timestamp>.csv (see CsvHeader), so that slow leaks and
+ * fragmentation show up as a drift across rows. The same seed replays the same sequence of operations.
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetSoakSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Stress.Soak", EAutomationTestFlags::StressFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureHealthSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthSet.GBA_Test_HealthSet_C");
+	static constexpr const TCHAR* FixtureHealthRegenSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthRegenSet.GBA_Test_HealthRegenSet_C");
+	static constexpr const TCHAR* FixtureDamageEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_Damage.GE_Test_Damage_C");
+	static constexpr const TCHAR* FixtureHealthRegenEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_HealthRegen.GE_Test_HealthRegen_C");
+	static constexpr const TCHAR* FixtureStatsAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureStatsDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats");
+	static constexpr const TCHAR* FixtureStatsInitEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+	static constexpr const TCHAR* FixtureClampAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Clamping.GBA_Test_Clamping_C");
+	static constexpr const TCHAR* FixtureClampDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Clamp");
+	static constexpr const TCHAR* FixtureClampedAddEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Clamped_Add.GE_Test_Clamped_Add_C");
+	static constexpr const TCHAR* FixtureClampedSubstractEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Clamped_Substract.GE_Test_Clamped_Substract_C");
+
+	static constexpr int32 MaxActors = 4096;
+	static constexpr float TickDeltaSeconds = 0.1f;
+
+	/** Operations between two world ticks */
+	static constexpr int32 OpsPerTick = 64;
+
+	/** Relative weights of randomized operations */
+	static constexpr int32 ApplyWeight = 50;
+	static constexpr int32 ClampWeight = 30;
+	static constexpr int32 InitWeight = 15;
+	static constexpr int32 RespawnWeight = 5;
+
+	/** UObject count growth across the soak (after each sample's GC) reported as a warning */
+	static constexpr double MaxObjectGrowth = 0.1;
+
+	static constexpr const TCHAR* CsvHeader = TEXT("ElapsedSeconds,Ops,OpsPerSecond,P50Us,P90Us,P99Us,P999Us,MaxUs,ApplyP99Us,ClampP99Us,InitP99Us,RespawnP99Us,TickP99Us,UsedPhysicalMB,NumUObjects,NumAttributeSets,GCMs");
+
+	enum class ESoakOp : uint8
+	{
+		Apply,
+		Clamp,
+		Init,
+		Respawn,
+		Tick,
+		Num
+	};
+
+	struct FSoakActor
+	{
+		ACharacter* Character = nullptr;
+		UAbilitySystemComponent* ASC = nullptr;
+		UGBAAttributeSetBlueprintBase* StatsSet = nullptr;
+		UGBAAttributeSetBlueprintBase* ClampSet = nullptr;
+	};
+
+	struct FSoakFixtures
+	{
+		UClass* ActorClass = nullptr;
+		TSubclassOf<UAttributeSet> HealthSetClass;
+		TSubclassOf<UAttributeSet> HealthRegenSetClass;
+		TSubclassOf<UAttributeSet> StatsSetClass;
+		TSubclassOf<UAttributeSet> ClampSetClass;
+		const UDataTable* StatsDataTable = nullptr;
+		const UDataTable* ClampDataTable = nullptr;
+		TSubclassOf<UGameplayEffect> RegenEffect;
+		TArray<TSubclassOf<UGameplayEffect>> Effects;
+		TArray<FGameplayAttribute> ClampAttributes;
+	};
+
+	FSoakFixtures Fixtures;
+	TArray<FSoakActor> Actors;
+
+	static float GetSoakSeconds()
+	{
+		float Seconds = 60.f;
+		FParse::Value(FCommandLine::Get(), TEXT("GBASoakSeconds="), Seconds);
+		return FMath::Max(Seconds, TickDeltaSeconds);
+	}
+
+	static float GetSampleSeconds()
+	{
+		float Seconds = 5.f;
+		FParse::Value(FCommandLine::Get(), TEXT("GBASoakSampleSeconds="), Seconds);
+		return FMath::Max(Seconds, 1.f);
+	}
+
+	static int32 GetSeed()
+	{
+		int32 Seed = 1337;
+		FParse::Value(FCommandLine::Get(), TEXT("GBASoakSeed="), Seed);
+		return Seed;
+	}
+
+	static int32 GetNumActors()
+	{
+		int32 NumActors = 64;
+		FParse::Value(FCommandLine::Get(), TEXT("GBASoakActors="), NumActors);
+		return FMath::Clamp(NumActors, 1, MaxActors);
+	}
+
+	bool LoadFixtures()
+	{
+		Fixtures.ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		Fixtures.HealthSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath);
+		Fixtures.HealthRegenSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthRegenSetLoadPath);
+		Fixtures.StatsSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureStatsAttributeSetLoadPath);
+		Fixtures.ClampSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
+		Fixtures.StatsDataTable = StaticLoadDataTable(FixtureStatsDataTableLoadPath);
+		Fixtures.ClampDataTable = StaticLoadDataTable(FixtureClampDataTableLoadPath);
+		Fixtures.RegenEffect = LoadFixtureClass(UGameplayEffect::StaticClass(), FixtureHealthRegenEffectLoadPath);
+
+		for (const TCHAR* EffectLoadPath : { FixtureDamageEffectLoadPath, FixtureStatsInitEffectLoadPath, FixtureClampedAddEffectLoadPath, FixtureClampedSubstractEffectLoadPath })
+		{
+			const TSubclassOf<UGameplayEffect> EffectClass = LoadFixtureClass(UGameplayEffect::StaticClass(), EffectLoadPath);
+			if (!IsValid(EffectClass))
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), EffectLoadPath));
+				return false;
+			}
+
+			Fixtures.Effects.Add(EffectClass);
+		}
+
+		if (!IsValid(Fixtures.ActorClass) || !IsValid(Fixtures.HealthSetClass) || !IsValid(Fixtures.HealthRegenSetClass) ||
+			!IsValid(Fixtures.StatsSetClass) || !IsValid(Fixtures.ClampSetClass) ||
+			!Fixtures.StatsDataTable || !Fixtures.ClampDataTable || !IsValid(Fixtures.RegenEffect))
+		{
+			AddError(TEXT("Unable to load fixtures"));
+			return false;
+		}
+
+		Fixtures.ClampAttributes.Add(GetAttributeProperty(Fixtures.ClampSetClass, TEXT("TestDTClamp")));
+		Fixtures.ClampAttributes.Add(GetAttributeProperty(Fixtures.ClampSetClass, TEXT("TestBoth")));
+		return true;
+	}
+
+	bool SpawnSoakActor(const int32 InIndex, FSoakActor& OutActor)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		const FVector Location(InIndex * 200.f, 0.f, 0.f);
+		ACharacter* Character = Cast<ACharacter>(World->SpawnActor(Fixtures.ActorClass, &Location, nullptr, SpawnParameters));
+		UAbilitySystemComponent* ASC = Character ? Character->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!ASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup soak actor %d from %s"), InIndex, *GetNameSafe(Fixtures.ActorClass)));
+			return false;
+		}
+
+		// Fixture character grants GBA_Test_Stats on BeginPlay
+		Character->DispatchBeginPlay();
+		ASC->InitStats(Fixtures.HealthSetClass, nullptr);
+		ASC->InitStats(Fixtures.HealthRegenSetClass, nullptr);
+		if (!HasAttributeSet(ASC, Fixtures.StatsSetClass))
+		{
+			ASC->InitStats(Fixtures.StatsSetClass, nullptr);
+		}
+		ASC->InitStats(Fixtures.ClampSetClass, Fixtures.ClampDataTable);
+		ASC->BP_ApplyGameplayEffectToSelf(Fixtures.RegenEffect, 1.f, ASC->MakeEffectContext());
+
+		OutActor.Character = Character;
+		OutActor.ASC = ASC;
+		OutActor.StatsSet = Cast<UGBAAttributeSetBlueprintBase>(const_cast<UAttributeSet*>(ASC->GetAttributeSet(Fixtures.StatsSetClass)));
+		OutActor.ClampSet = Cast<UGBAAttributeSetBlueprintBase>(const_cast<UAttributeSet*>(ASC->GetAttributeSet(Fixtures.ClampSetClass)));
+		if (!OutActor.StatsSet || !OutActor.ClampSet)
+		{
+			AddError(FString::Printf(TEXT("Soak actor %d is missing its Blueprint attribute sets"), InIndex));
+			return false;
+		}
+
+		return true;
+	}
+
+	static ESoakOp PickOp(const FRandomStream& InRandom)
+	{
+		int32 Roll = InRandom.RandRange(0, ApplyWeight + ClampWeight + InitWeight + RespawnWeight - 1);
+		if ((Roll -= ApplyWeight) < 0)
+		{
+			return ESoakOp::Apply;
+		}
+		if ((Roll -= ClampWeight) < 0)
+		{
+			return ESoakOp::Clamp;
+		}
+		if ((Roll -= InitWeight) < 0)
+		{
+			return ESoakOp::Init;
+		}
+		return ESoakOp::Respawn;
+	}
+
+	bool RunOp(const ESoakOp InOp, const FRandomStream& InRandom)
+	{
+		const int32 Index = InRandom.RandRange(0, Actors.Num() - 1);
+		FSoakActor& Actor = Actors[Index];
+
+		switch (InOp)
+		{
+		case ESoakOp::Apply:
+			{
+				const TSubclassOf<UGameplayEffect>& EffectClass = Fixtures.Effects[InRandom.RandRange(0, Fixtures.Effects.Num() - 1)];
+				Actor.ASC->BP_ApplyGameplayEffectToSelf(EffectClass, 1.f, Actor.ASC->MakeEffectContext());
+				return true;
+			}
+		case ESoakOp::Clamp:
+			{
+				const FGameplayAttribute& Attribute = Fixtures.ClampAttributes[InRandom.RandRange(0, Fixtures.ClampAttributes.Num() - 1)];
+				Actor.ClampSet->SetAttributeValue(Attribute, InRandom.FRandRange(-50.f, 150.f));
+				Actor.ClampSet->ClampAttributeValue(Attribute, 0.f, 100.f);
+				return true;
+			}
+		case ESoakOp::Init:
+			Actor.StatsSet->InitFromMetaDataTable(Fixtures.StatsDataTable);
+			return true;
+		case ESoakOp::Respawn:
+			World->EditorDestroyActor(Actor.Character, false);
+			return SpawnSoakActor(Index, Actor);
+		default:
+			checkNoEntry();
+			return false;
+		}
+	}
+
+	static double ToMicroseconds(const uint64 InNanoseconds)
+	{
+		return InNanoseconds / 1000.0;
+	}
+
+	static void WriteLine(FArchive& InArchive, const FString& InLine)
+	{
+		const FTCHARToUTF8 Converter(*(InLine + LINE_TERMINATOR_ANSI));
+		InArchive.Serialize(const_cast<ANSICHAR*>(Converter.Get()), Converter.Length());
+		InArchive.Flush();
+	}
+
+	/** Appends a row for the last sample period to InArchive, collecting garbage first so memory reflects live data */
+	static void Sample(FArchive& InArchive, const double InElapsedSeconds, const uint64 InNumOps, const double InPeriodSeconds, const FGBATestsLatencyHistogram& InHistogram, const TArray<FGBATestsLatencyHistogram>& InOpHistograms, int32& OutNumUObjects)
+	{
+		const uint64 GCStartCycles = FPlatformTime::Cycles64();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		const double GCMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - GCStartCycles);
+
+		int32 NumAttributeSets = 0;
+		int64 AttributeSetsBytes = 0;
+		FGBATestsStats::SampleAttributeSets(NumAttributeSets, AttributeSetsBytes);
+		OutNumUObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		WriteLine(InArchive, FString::Printf(
+			TEXT("%.1f,%llu,%.0f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%d,%d,%.3f"),
+			InElapsedSeconds,
+			InNumOps,
+			InHistogram.GetTotalCount() / FMath::Max(InPeriodSeconds, UE_DOUBLE_SMALL_NUMBER),
+			ToMicroseconds(InHistogram.GetPercentile(50.0)),
+			ToMicroseconds(InHistogram.GetPercentile(90.0)),
+			ToMicroseconds(InHistogram.GetPercentile(99.0)),
+			ToMicroseconds(InHistogram.GetPercentile(99.9)),
+			ToMicroseconds(InHistogram.GetMax()),
+			ToMicroseconds(InOpHistograms[static_cast<int32>(ESoakOp::Apply)].GetPercentile(99.0)),
+			ToMicroseconds(InOpHistograms[static_cast<int32>(ESoakOp::Clamp)].GetPercentile(99.0)),
+			ToMicroseconds(InOpHistograms[static_cast<int32>(ESoakOp::Init)].GetPercentile(99.0)),
+			ToMicroseconds(InOpHistograms[static_cast<int32>(ESoakOp::Respawn)].GetPercentile(99.0)),
+			ToMicroseconds(InOpHistograms[static_cast<int32>(ESoakOp::Tick)].GetPercentile(99.0)),
+			FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0),
+			OutNumUObjects,
+			NumAttributeSets,
+			GCMs
+		));
+	}
+
+	void RunSoak()
+	{
+		const float Seconds = GetSoakSeconds();
+		const float SampleSeconds = GetSampleSeconds();
+		const int32 Seed = GetSeed();
+		const int32 NumActors = GetNumActors();
+
+		if (!LoadFixtures())
+		{
+			return;
+		}
+
+		Actors.SetNum(NumActors);
+		for (int32 Index = 0; Index < NumActors; ++Index)
+		{
+			if (!SpawnSoakActor(Index, Actors[Index]))
+			{
+				return;
+			}
+		}
+
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("BlueprintAttributesTests") / TEXT("Soak") / FString::Printf(TEXT("Soak_%d_%s.csv"), Seed, *FDateTime::Now().ToString());
+		const TUniquePtr<FArchive> CsvArchive(IFileManager::Get().CreateFileWriter(*Filename));
+		if (!CsvArchive)
+		{
+			AddError(FString::Printf(TEXT("Unable to open %s"), *Filename));
+			return;
+		}
+
+		AddInfo(FString::Printf(TEXT("Soaking %d actors for %.0fs with seed %d, sampling every %.0fs to %s"), NumActors, Seconds, Seed, SampleSeconds, *Filename));
+		WriteLine(*CsvArchive, CsvHeader);
+
+		// Per sample period, and whole soak
+		FGBATestsLatencyHistogram Histogram;
+		FGBATestsLatencyHistogram TotalHistogram;
+		TArray<FGBATestsLatencyHistogram> OpHistograms;
+		OpHistograms.SetNum(static_cast<int32>(ESoakOp::Num));
+
+		const FRandomStream Random(Seed);
+		const double StartSeconds = FPlatformTime::Seconds();
+		double SampleStartSeconds = StartSeconds;
+		uint64 NumOps = 0;
+		int32 FirstNumUObjects = INDEX_NONE;
+		int32 LastNumUObjects = INDEX_NONE;
+
+		auto FlushSample = [&]()
+		{
+			const double NowSeconds = FPlatformTime::Seconds();
+			Sample(*CsvArchive, NowSeconds - StartSeconds, NumOps, NowSeconds - SampleStartSeconds, Histogram, OpHistograms, LastNumUObjects);
+			if (FirstNumUObjects == INDEX_NONE)
+			{
+				FirstNumUObjects = LastNumUObjects;
+			}
+
+			TotalHistogram.Add(Histogram);
+			Histogram.Reset();
+			for (FGBATestsLatencyHistogram& OpHistogram : OpHistograms)
+			{
+				OpHistogram.Reset();
+			}
+
+			// Sampling (GC) time isn't part of the next period
+			SampleStartSeconds = FPlatformTime::Seconds();
+		};
+
+		while (FPlatformTime::Seconds() - StartSeconds < Seconds)
+		{
+			for (int32 OpIndex = 0; OpIndex < OpsPerTick; ++OpIndex)
+			{
+				const ESoakOp Op = PickOp(Random);
+
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const bool bSucceeded = RunOp(Op, Random);
+				const uint64 Nanoseconds = static_cast<uint64>(FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - StartCycles));
+
+				if (!bSucceeded)
+				{
+					return;
+				}
+
+				Histogram.Record(Nanoseconds);
+				OpHistograms[static_cast<int32>(Op)].Record(Nanoseconds);
+				++NumOps;
+			}
+
+			const uint64 TickStartCycles = FPlatformTime::Cycles64();
+			TickWorld(World, TickDeltaSeconds);
+			OpHistograms[static_cast<int32>(ESoakOp::Tick)].Record(static_cast<uint64>(FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - TickStartCycles)));
+
+			if (FPlatformTime::Seconds() - SampleStartSeconds >= SampleSeconds)
+			{
+				FlushSample();
+			}
+		}
+
+		if (Histogram.GetTotalCount() > 0)
+		{
+			FlushSample();
+		}
+
+		CsvArchive->Close();
+
+		AddInfo(FString::Printf(
+			TEXT("%llu ops, latency P50 %.3fus P99 %.3fus P99.9 %.3fus Max %.3fus Mean %.3fus"),
+			NumOps,
+			ToMicroseconds(TotalHistogram.GetPercentile(50.0)),
+			ToMicroseconds(TotalHistogram.GetPercentile(99.0)),
+			ToMicroseconds(TotalHistogram.GetPercentile(99.9)),
+			ToMicroseconds(TotalHistogram.GetMax()),
+			TotalHistogram.GetMean() / 1000.0
+		));
+
+		if (FirstNumUObjects > 0 && LastNumUObjects > FirstNumUObjects * (1.0 + MaxObjectGrowth))
+		{
+			AddWarning(FString::Printf(TEXT("UObject count grew from %d to %d over the soak, see %s"), FirstNumUObjects, LastNumUObjects, *Filename));
+		}
+
+		TestTrue(TEXT("Soak ran operations"), NumOps > 0);
+		TestTrue(TEXT("Every operation was sampled"), TotalHistogram.GetTotalCount() == NumOps);
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeSetSoakSpec)
+
+void FGBAAttributeSetSoakSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = CreateWorld(InitialFrameCounter);
+	});
+
+	It(TEXT("should sustain randomized Gameplay Effect, clamp, init and respawn load"), [this]()
+	{
+		RunSoak();
+	});
+
+	AfterEach([this]()
+	{
+		for (const FSoakActor& Actor : Actors)
+		{
+			if (IsValid(Actor.Character))
+			{
+				World->EditorDestroyActor(Actor.Character, false);
+			}
+		}
+
+		Actors.Reset();
+		Fixtures = FSoakFixtures();
+		TeardownWorld(World, InitialFrameCounter);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
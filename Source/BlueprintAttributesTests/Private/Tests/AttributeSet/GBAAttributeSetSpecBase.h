@@ -4,11 +4,24 @@
 
 #include "AbilitySystemComponent.h"
 #include "AttributeSet.h"
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsBaselineStore.h"
+#include "GBATestsBenchmark.h"
+#include "GBATestsFixtureRegistry.h"
+#include "GBATestsGameplayEffectCache.h"
+#include "GBATestsStats.h"
 #include "GBATestsStorageSubsystem.h"
+#include "GBATestsTrace.h"
+#include "GBATestsVirtualClock.h"
+#include "EngineUtils.h"
 #include "GameplayEffect.h"
+#include "TimerManager.h"
 #include "Engine/Engine.h"
+#include "HAL/FileManager.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "UObject/Package.h"
 
 class ACharacter;
@@ -76,6 +89,35 @@ class UGBAAttributeSetBlueprintBase;
 		}
 #endif
 
+/**
+ * Declares an It benchmarking its body as a single operation, with FGBAAttributeSetSpecBase::RunBenchmark(). The body
+ * captures everything by reference, setup belongs in BeforeEach:
+ *
+ *     GBA_BENCHMARK(TEXT("GetAttributeValue()"), {
+ *         bool bFound = false;
+ *         FGBATestsBenchmark::DoNotOptimize(TestAttributeSet->GetAttributeValue(Attribute, bFound));
+ *     });
+ */
+#define GBA_BENCHMARK( Description, ... ) \
+	It(Description, [this, BenchmarkName = FString(Description)]() \
+	{ \
+		RunBenchmark(BenchmarkName, [&]() __VA_ARGS__); \
+	})
+
+/**
+ * Declares an It benchmarking an operation over parenthesized input sizes, with FGBAAttributeSetSpecBase::RunBenchmarkSweep().
+ * The body receives a const int32 Size, runs untimed setup for it and returns the operation:
+ *
+ *     GBA_BENCHMARK_SWEEP(TEXT("InitFromMetaDataTable()"), (8, 64, 256), {
+ *         const FGBATestsGeneratedAttributeSet Generated = FGBATestsAttributeSetGenerator::Generate(..., Params);
+ *         return [Generated]() { ... };
+ *     });
+ */
+#define GBA_BENCHMARK_SWEEP( Description, Sizes, ... ) \
+	RunBenchmarkSweep(Description, { GBA_BENCHMARK_PRIVATE_UNPAREN Sizes }, [this](const int32 Size) -> TFunction<void()> __VA_ARGS__)
+
+#define GBA_BENCHMARK_PRIVATE_UNPAREN( ... ) __VA_ARGS__
+
 class FGBAAttributeSetSpecBase : public FAutomationSpecBase
 {
 public:
@@ -99,6 +141,24 @@ protected:
 
 	TSubclassOf<UAttributeSet> TestAttributeSetClass = nullptr;
 	UGBAAttributeSetBlueprintBase* TestAttributeSet = nullptr;
+
+	/** When true, AdvanceTime() only runs TestASC effect timers (see FGBATestsVirtualClock), instead of ticking the whole world */
+	bool bUseVirtualClock = false;
+
+	/** World shared by every It of this spec (see AcquireWorld()), with the actors it had once created */
+	UWorld* PooledWorld = nullptr;
+	uint64 PooledFrameCounter = 0;
+	TSet<TWeakObjectPtr<AActor>> PooledWorldActors;
+	TSet<FTimerHandle> PooledWorldTimers;
+
+	/** Pooled world times when it was created, restored by ReleaseWorld() */
+	double PooledTimeSeconds = 0.0;
+	double PooledUnpausedTimeSeconds = 0.0;
+	double PooledRealTimeSeconds = 0.0;
+	double PooledAudioTimeSeconds = 0.0;
+
+	/** Only one spec keeps a pooled world around at a time */
+	inline static FGBAAttributeSetSpecBase* PooledWorldOwner = nullptr;
 	
 	static constexpr const TCHAR* FixtureCharacterLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/BP_Attributes_Test_Character.BP_Attributes_Test_Character_C");
 
@@ -132,7 +192,7 @@ protected:
 
 	bool ApplyGameplayEffect(UAbilitySystemComponent* ASC, const FString& EffectLoadPath, const float Level = 1.f)
 	{
-		const TSubclassOf<UGameplayEffect> Effect = StaticLoadClass(UGameplayEffect::StaticClass(), nullptr, *EffectLoadPath);
+		const TSubclassOf<UGameplayEffect> Effect = LoadFixtureClass(UGameplayEffect::StaticClass(), EffectLoadPath);
 		if (!IsValid(Effect))
 		{
 			AddError(FString::Printf(TEXT("Unable to load %s"), *EffectLoadPath));
@@ -140,13 +200,22 @@ protected:
 		}
 
 		AddInfo(FString::Printf(TEXT("Applying effect %s (%s)"), *Effect->GetName(), *EffectLoadPath));
+		GBA_TESTS_TRACE_SCOPE(EffectApply, Effect.Get());
+		GBA_TESTS_STAT_SCOPE(STAT_GBA_EffectApply, nullptr);
+		FGBATestsStats::CountEffectApplication(*Effect->GetDefaultObject<UGameplayEffect>());
 		const FActiveGameplayEffectHandle Handle = ASC->BP_ApplyGameplayEffectToSelf(Effect, Level, ASC->MakeEffectContext());
 		return Handle.IsValid();
 	}
 
+	/** Fixture class from the preloaded fixture registry (loaded on demand if not under the fixtures root) */
+	static UClass* LoadFixtureClass(const UClass* InBaseClass, const FString& InLoadPath)
+	{
+		return FGBATestsFixtureRegistry::Get().GetClass(InLoadPath, InBaseClass);
+	}
+
 	static UDataTable* StaticLoadDataTable(const FString& InPackageName)
 	{
-		return Cast<UDataTable>(StaticLoadObject(UDataTable::StaticClass(), nullptr, *InPackageName));
+		return FGBATestsFixtureRegistry::Get().Get<UDataTable>(InPackageName);
 	}
 
 	static UWorld* CreateWorld(uint64& OutInitialFrameCounter)
@@ -186,6 +255,19 @@ protected:
 		}
 	}
 
+	/** Advances World by Time, with TickWorld() or the virtual clock depending on bUseVirtualClock */
+	void AdvanceTime(const float Time) const
+	{
+		if (bUseVirtualClock)
+		{
+			FGBATestsVirtualClock::Advance(World, Time, { TestASC });
+		}
+		else
+		{
+			TickWorld(World, Time);
+		}
+	}
+
 	static void TeardownWorld(UWorld* InWorld, const uint64 InFrameCounter)
 	{
 		GFrameCounter = InFrameCounter;
@@ -195,6 +277,330 @@ protected:
 		InWorld->DestroyWorld(false);
 	}
 
+	/**
+	 * Sets World for the next It, as CreateWorld() would: the first call creates a world that is kept around, and
+	 * later ones reuse it once reset by ReleaseWorld(). Pair with ReleaseWorld() in AfterEach, instead of TeardownWorld().
+	 */
+	void AcquireWorld()
+	{
+		if (PooledWorldOwner && PooledWorldOwner != this)
+		{
+			PooledWorldOwner->DestroyPooledWorld();
+		}
+
+		if (!PooledWorld)
+		{
+			PooledWorld = CreateWorld(PooledFrameCounter);
+			PooledWorldOwner = this;
+
+			PooledWorldActors.Reset();
+			for (TActorIterator<AActor> It(PooledWorld); It; ++It)
+			{
+				PooledWorldActors.Add(*It);
+			}
+
+			PooledWorldTimers.Reset();
+			PooledWorld->GetTimerManager().ForEachHandle([this](const FTimerHandle Handle)
+			{
+				PooledWorldTimers.Add(Handle);
+			});
+
+			PooledTimeSeconds = PooledWorld->TimeSeconds;
+			PooledUnpausedTimeSeconds = PooledWorld->UnpausedTimeSeconds;
+			PooledRealTimeSeconds = PooledWorld->RealTimeSeconds;
+			PooledAudioTimeSeconds = PooledWorld->AudioTimeSeconds;
+
+			static bool bRegisteredCleanup = false;
+			if (!bRegisteredCleanup)
+			{
+				bRegisteredCleanup = true;
+				FAutomationTestFramework::Get().OnAfterAllTestsEvent.AddLambda([]()
+				{
+					if (PooledWorldOwner)
+					{
+						PooledWorldOwner->DestroyPooledWorld();
+					}
+				});
+			}
+		}
+
+		World = PooledWorld;
+		InitialFrameCounter = PooledFrameCounter;
+	}
+
+	/**
+	 * Brings the pooled world back to how it was created: actors spawned since are destroyed (after removing their
+	 * active effects), timers set since are cleared, world time and GFrameCounter are restored and tests storage is reset.
+	 */
+	void ReleaseWorld()
+	{
+		if (!PooledWorld)
+		{
+			return;
+		}
+
+		FTimerManager& TimerManager = PooledWorld->GetTimerManager();
+
+		TArray<AActor*> SpawnedActors;
+		for (TActorIterator<AActor> It(PooledWorld); It; ++It)
+		{
+			if (!PooledWorldActors.Contains(*It))
+			{
+				SpawnedActors.Add(*It);
+			}
+		}
+
+		for (AActor* Actor : SpawnedActors)
+		{
+			TInlineComponentArray<UAbilitySystemComponent*> ASCs(Actor);
+			for (UAbilitySystemComponent* ASC : ASCs)
+			{
+				for (const FActiveGameplayEffectHandle& Handle : ASC->GetActiveGameplayEffects().GetAllActiveEffectHandles())
+				{
+					ASC->RemoveActiveGameplayEffect(Handle);
+				}
+			}
+
+			PooledWorld->EditorDestroyActor(Actor, false);
+		}
+
+		// Every timer set since creation, not only those of spawned actors (eg. set by subsystems or on pooled actors).
+		// Cleared rather than run, even if already due.
+		TArray<FTimerHandle> Timers;
+		TimerManager.ForEachHandle([this, &Timers](const FTimerHandle Handle)
+		{
+			if (!PooledWorldTimers.Contains(Handle))
+			{
+				Timers.Add(Handle);
+			}
+		});
+
+		for (FTimerHandle& Handle : Timers)
+		{
+			TimerManager.ClearTimer(Handle);
+		}
+
+		// The timer manager skips ticks on the frame it last ticked. Have that be the frame it was created on, one
+		// before PooledFrameCounter, so that going back in frames doesn't make it skip one later on. Timers of the
+		// test are cleared by now, this tick has none of them left to fire.
+		GFrameCounter = PooledFrameCounter - 1;
+		TimerManager.Tick(0.f);
+		GFrameCounter = PooledFrameCounter;
+
+		PooledWorld->TimeSeconds = PooledTimeSeconds;
+		PooledWorld->UnpausedTimeSeconds = PooledUnpausedTimeSeconds;
+		PooledWorld->RealTimeSeconds = PooledRealTimeSeconds;
+		PooledWorld->AudioTimeSeconds = PooledAudioTimeSeconds;
+
+		GetStorage().ResetStore();
+
+		TestActor = nullptr;
+		TestASC = nullptr;
+		TestAttributeSet = nullptr;
+	}
+
+	/** Resets and tears down the pooled world, if any */
+	void DestroyPooledWorld()
+	{
+		if (!PooledWorld)
+		{
+			return;
+		}
+
+		ReleaseWorld();
+		TeardownWorld(PooledWorld, PooledFrameCounter);
+
+		if (World == PooledWorld)
+		{
+			World = nullptr;
+		}
+
+		PooledWorld = nullptr;
+		PooledWorldActors.Reset();
+		PooledWorldTimers.Reset();
+		PooledWorldOwner = PooledWorldOwner == this ? nullptr : PooledWorldOwner;
+	}
+
+	/** What a test world holds, to tell a reset world apart from a fresh one */
+	struct FWorldSnapshot
+	{
+		/** Class names of every actor, sorted */
+		TArray<FString> Actors;
+
+		int32 NumAbilitySystemComponents = 0;
+		int32 NumAttributeSets = 0;
+		int32 NumActiveGameplayEffects = 0;
+		int32 NumTimers = 0;
+		int32 NumStorageEvents = 0;
+		double TimeSeconds = 0.0;
+
+		bool operator==(const FWorldSnapshot& Other) const
+		{
+			return Actors == Other.Actors
+				&& NumAbilitySystemComponents == Other.NumAbilitySystemComponents
+				&& NumAttributeSets == Other.NumAttributeSets
+				&& NumActiveGameplayEffects == Other.NumActiveGameplayEffects
+				&& NumTimers == Other.NumTimers
+				&& NumStorageEvents == Other.NumStorageEvents
+				&& FMath::IsNearlyEqual(TimeSeconds, Other.TimeSeconds);
+		}
+
+		FString ToString() const
+		{
+			return FString::Printf(
+				TEXT("Actors: [%s], ASCs: %d, attribute sets: %d, active effects: %d, timers: %d, storage events: %d, time: %.4f s"),
+				*FString::Join(Actors, TEXT(", ")),
+				NumAbilitySystemComponents,
+				NumAttributeSets,
+				NumActiveGameplayEffects,
+				NumTimers,
+				NumStorageEvents,
+				TimeSeconds
+			);
+		}
+	};
+
+	static FWorldSnapshot CaptureWorld(UWorld* InWorld)
+	{
+		FWorldSnapshot Snapshot;
+		for (TActorIterator<AActor> It(InWorld); It; ++It)
+		{
+			Snapshot.Actors.Add(It->GetClass()->GetName());
+		}
+		Snapshot.Actors.Sort();
+
+		for (TObjectIterator<UAbilitySystemComponent> It; It; ++It)
+		{
+			if (IsValid(*It) && It->GetWorld() == InWorld)
+			{
+				++Snapshot.NumAbilitySystemComponents;
+				Snapshot.NumActiveGameplayEffects += It->GetActiveGameplayEffects().GetNumGameplayEffects();
+			}
+		}
+
+		// Attribute sets of destroyed actors are only marked as garbage by the next GC
+		for (TObjectIterator<UAttributeSet> It; It; ++It)
+		{
+			const AActor* Owner = Cast<AActor>(It->GetOuter());
+			Snapshot.NumAttributeSets += IsValid(*It) && IsValid(Owner) && Owner->GetWorld() == InWorld ? 1 : 0;
+		}
+
+		InWorld->GetTimerManager().ForEachHandle([&Snapshot](FTimerHandle)
+		{
+			++Snapshot.NumTimers;
+		});
+
+		Snapshot.NumStorageEvents = GetStorage().GetRecorder().Num();
+		Snapshot.TimeSeconds = InWorld->TimeSeconds;
+		return Snapshot;
+	}
+
+	/**
+	 * Heap allocations of InNumIterations InOp calls on the game thread, after InNumWarmupIterations untimed ones.
+	 *
+	 * The storage is reset in between, so that measured events reuse the recorder slots (and their payload
+	 * allocations) of the warm-up. The warm-up runs at least InNumIterations times for every measured call to land
+	 * on a slot it already filled. Returns 0 if allocations can't be observed on this platform.
+	 */
+	static uint64 CountAllocations(const int32 InNumWarmupIterations, const int32 InNumIterations, const TFunctionRef<void()> InOp)
+	{
+		const int32 NumWarmupIterations = FMath::Max(InNumWarmupIterations, InNumIterations);
+		for (int32 Index = 0; Index < NumWarmupIterations; ++Index)
+		{
+			InOp();
+		}
+
+		GetStorage().ResetStore();
+
+		const FGBATestsScopedAllocationCounter Counter;
+		for (int32 Index = 0; Index < InNumIterations; ++Index)
+		{
+			InOp();
+		}
+
+		return Counter.GetNum();
+	}
+
+	/**
+	 * Times InOp with FGBATestsBenchmark::RunAdaptive() and checks its stats against the baseline named InName (InName.InSize
+	 * with a size). Results are reported as info and as automation telemetry (in the test report, with the machine profile
+	 * of the baseline store as context), and appended as a CSV row to Saved/BlueprintAttributesTests/Benchmarks/<TestFullName>.csv.
+	 */
+	FGBATestsBenchmarkResult RunBenchmark(const FString& InName, const TFunctionRef<void()> InOp, const FGBATestsBenchmarkParams& InParams = FGBATestsBenchmarkParams(), const int32 InSize = INDEX_NONE)
+	{
+		const FGBATestsBenchmarkResult Result = FGBATestsBenchmark::RunAdaptive(InParams, InOp);
+		const FString MetricName = InSize == INDEX_NONE ? InName : FString::Printf(TEXT("%s.%d"), *InName, InSize);
+
+		AddInfo(FString::Printf(TEXT("%s: %s, %d ops per sample, %.2f allocs per op"), *MetricName, *Result.Stats.ToString(), Result.OpsPerSample, Result.AllocsPerOp));
+
+		const FString Profile = FGBATestsBaselineStore::Get().GetMachineProfile();
+
+		TMap<FString, double> Telemetry;
+		Telemetry.Add(MetricName + TEXT(".MinNsPerOp"), Result.Stats.Min);
+		Telemetry.Add(MetricName + TEXT(".P50NsPerOp"), Result.Stats.Median);
+		Telemetry.Add(MetricName + TEXT(".P99NsPerOp"), Result.Stats.P99);
+		Telemetry.Add(MetricName + TEXT(".StdDevNsPerOp"), Result.Stats.StdDev);
+		if (Result.AllocsPerOp >= 0.0)
+		{
+			Telemetry.Add(MetricName + TEXT(".AllocsPerOp"), Result.AllocsPerOp);
+			Telemetry.Add(MetricName + TEXT(".BytesPerOp"), Result.BytesPerOp);
+		}
+		AddTelemetryData(Telemetry, Profile);
+
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("BlueprintAttributesTests") / TEXT("Benchmarks") / GetTestFullName() + TEXT(".csv");
+		FString Csv = IFileManager::Get().FileExists(*Filename) ? FString() : FString::Printf(TEXT("Timestamp,Profile,Name,Size,%s\n"), FGBATestsBenchmarkResult::CsvHeader);
+		Csv += FString::Printf(
+			TEXT("%s,\"%s\",\"%s\",%d,%s\n"),
+			*FDateTime::UtcNow().ToIso8601(),
+			*Profile.Replace(TEXT("\""), TEXT("\"\"")),
+			*InName.Replace(TEXT("\""), TEXT("\"\"")),
+			InSize,
+			*Result.ToCsvRow()
+		);
+
+		if (!FFileHelper::SaveStringToFile(Csv, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+		{
+			AddWarning(FString::Printf(TEXT("Unable to write benchmark results to %s"), *Filename));
+		}
+
+		FGBATestsBaselineStore::Get().Check(*this, MetricName, Result.Stats);
+		return Result;
+	}
+
+	/**
+	 * Declares an It running RunBenchmark() for each of InSizes (eg. attribute or actor counts) on the operation InSetup
+	 * returns for that size, then reporting how median time per operation scales from the first size.
+	 */
+	void RunBenchmarkSweep(const FString& InName, const TArray<int32>& InSizes, const TFunction<TFunction<void()>(int32)>& InSetup, const FGBATestsBenchmarkParams& InParams = FGBATestsBenchmarkParams())
+	{
+		TArray<FString> SizeNames;
+		for (const int32 Size : InSizes)
+		{
+			SizeNames.Add(FString::FromInt(Size));
+		}
+
+		It(FString::Printf(TEXT("%s (%s)"), *InName, *FString::Join(SizeNames, TEXT(", "))), [this, InName, InSizes, InSetup, InParams]()
+		{
+			TArray<FString> Scaling;
+			double FirstMedian = 0.0;
+			for (const int32 Size : InSizes)
+			{
+				const TFunction<void()> Op = InSetup(Size);
+				if (!Op)
+				{
+					AddError(FString::Printf(TEXT("%s: no operation to benchmark for size %d"), *InName, Size));
+					continue;
+				}
+
+				const FGBATestsBenchmarkResult Result = RunBenchmark(InName, Op, InParams, Size);
+				FirstMedian = FirstMedian > 0.0 ? FirstMedian : Result.Stats.Median;
+				Scaling.Add(FString::Printf(TEXT("%d: x%.2f"), Size, FirstMedian > 0.0 ? Result.Stats.Median / FirstMedian : 0.0));
+			}
+
+			AddInfo(FString::Printf(TEXT("%s scaling: %s"), *InName, *FString::Join(Scaling, TEXT(", "))));
+		});
+	}
+
 	static FGameplayAttribute GetAttributeProperty(const UClass* InClass, const FName& InPropertyName)
 	{
 		return FindFProperty<FProperty>(InClass, InPropertyName);
@@ -337,23 +743,18 @@ protected:
 
 		constexpr float DamageValue = 100.f;
 
+		FGBATestsGameplayEffectCache& EffectCache = FGBATestsGameplayEffectCache::Get();
+
 		// Effect has a -100 modifier for Stamina
 		// just try and reduce the health attribute
 		{
-			const FString EffectName = FString::Printf(TEXT("%sDamageEffect"), *AttributeName.ToString());
-			UGameplayEffect* DamageEffect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(*EffectName));
-
-			FProperty* Property = FindFieldChecked<FProperty>(TestAttributeSetClass, AttributeName);
-			AddModifier(DamageEffect, Property, EGameplayModOp::Additive, FScalableFloat(-DamageValue));
-
-			DamageEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
-			
-			TestASC->ApplyGameplayEffectToSelf(DamageEffect, 1.f, FGameplayEffectContextHandle());
+			const FGBATestsGameplayEffectSignature DamageEffect(Attribute, EGameplayModOp::Additive);
+			EffectCache.Apply(TestASC, DamageEffect, { -DamageValue });
 
 			float ExpectedValue = GetClampedExpectedValue(InMinAttributeDef, InMaxAttributeDef, AttributeInitialValue - DamageValue);
 			TestAttribute(AttributeName, ExpectedValue);
 
-			TestASC->ApplyGameplayEffectToSelf(DamageEffect, 1.f, FGameplayEffectContextHandle());
+			EffectCache.Apply(TestASC, DamageEffect, { -DamageValue });
 			
 			ExpectedValue = GetClampedExpectedValue(InMinAttributeDef, InMaxAttributeDef, AttributeInitialValue - 2 * DamageValue);
 			TestAttribute(AttributeName, ExpectedValue);
@@ -361,14 +762,8 @@ protected:
 
 		// Reset to initial value
 		{
-			const FString EffectName = FString::Printf(TEXT("%sResetEffect"), *AttributeName.ToString());
-			UGameplayEffect* OverrideEffect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(*EffectName));
-
-			FProperty* Property = FindFieldChecked<FProperty>(TestAttributeSetClass, AttributeName);
-			AddModifier(OverrideEffect, Property, EGameplayModOp::Override, AttributeInitialValue);
-
-			OverrideEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
-			TestASC->ApplyGameplayEffectToSelf(OverrideEffect, 1.f, FGameplayEffectContextHandle());
+			const FGBATestsGameplayEffectSignature OverrideEffect(Attribute, EGameplayModOp::Override);
+			EffectCache.Apply(TestASC, OverrideEffect, { AttributeInitialValue });
 
 			const float ExpectedValue = GetClampedExpectedValue(InMinAttributeDef, InMaxAttributeDef, AttributeInitialValue);
 			TestAttribute(AttributeName, ExpectedValue);
@@ -382,34 +777,26 @@ protected:
 		// Effect is an infinite, regen effect adding a set amount of Stamina every 1 seconds
 		// just try and regen the Stamina attribute
 		{
-			const FString EffectName = FString::Printf(TEXT("%sRegenEffect"), *AttributeName.ToString());
-			UGameplayEffect* BaseRegenEffect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(*EffectName));
-
-			FProperty* Property = FindFieldChecked<FProperty>(TestAttributeSetClass, AttributeName);
-			AddModifier(BaseRegenEffect, Property, EGameplayModOp::Additive, FScalableFloat(MagnitudePerPeriod));
-
-			BaseRegenEffect->DurationPolicy = EGameplayEffectDurationType::Infinite;
-			BaseRegenEffect->Period.Value = PeriodSecs;
-
-			TestASC->ApplyGameplayEffectToSelf(BaseRegenEffect, 1.f, FGameplayEffectContextHandle());
+			const FGBATestsGameplayEffectSignature BaseRegenEffect(Attribute, EGameplayModOp::Additive, EGameplayEffectDurationType::Infinite, PeriodSecs);
+			EffectCache.Apply(TestASC, BaseRegenEffect, { MagnitudePerPeriod });
 		}
 
 		int32 NumApplications = 0;
 
 		// Tick a small number to verify the application tick
-		TickWorld(World, SMALL_NUMBER);
+		AdvanceTime(SMALL_NUMBER);
 		++NumApplications;
 
 		TestAttribute(AttributeName, StartingAttributeValue + (MagnitudePerPeriod * NumApplications));
 
 		// Tick a bit more to address possible floating point issues
-		TickWorld(World, PeriodSecs * .1f);
+		AdvanceTime(PeriodSecs * .1f);
 
 		// Tick for 4 times as long
 		for (int32 i = 0; i < NumPeriods * 4; ++i)
 		{
 			// advance time by one period
-			TickWorld(World, PeriodSecs);
+			AdvanceTime(PeriodSecs);
 
 			++NumApplications;
 
@@ -439,7 +826,7 @@ protected:
 			BeforeEach([this, FixtureLoadPath]()
 			{
 				// Grab fixture Attribute Set class for further use later on
-				TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureLoadPath);
+				TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureLoadPath);
 				if (!IsValid(TestAttributeSetClass))
 				{
 					AddError(FString::Printf(TEXT("Unable to load %s"), *FixtureLoadPath));
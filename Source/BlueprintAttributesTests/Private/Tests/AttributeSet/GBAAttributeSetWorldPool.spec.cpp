@@ -0,0 +1,128 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeSetWorldPoolSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBAAttributeSetSpecBase.WorldPool", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureHealthSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthSet.GBA_Test_HealthSet_C");
+	static constexpr const TCHAR* FixtureHealthRegenEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_HealthRegen.GE_Test_HealthRegen_C");
+
+	static constexpr int32 NumSpeedupIterations = 20;
+
+	/** What a typical It does: spawn the fixture character, grant a set, apply an infinite periodic effect and tick */
+	void RunTypicalTest()
+	{
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		TestActor = IsValid(ActorClass) ? Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters())) : nullptr;
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!TestASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), FixtureCharacterLoadPath));
+			return;
+		}
+
+		TestActor->DispatchBeginPlay();
+		TestASC->InitStats(LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath), nullptr);
+		ApplyGameplayEffect(TestASC, FixtureHealthRegenEffectLoadPath);
+		TickWorld(World, 1.f);
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeSetWorldPoolSpec)
+
+void FGBAAttributeSetWorldPoolSpec::Define()
+{
+	It(TEXT("should reset to the same state as a fresh world"), [this]()
+	{
+		GetStorage().ResetStore();
+
+		// Fresh world, as CreateWorld() gives
+		uint64 FreshFrameCounter = 0;
+		UWorld* FreshWorld = CreateWorld(FreshFrameCounter);
+		const FWorldSnapshot Fresh = CaptureWorld(FreshWorld);
+		TeardownWorld(FreshWorld, FreshFrameCounter);
+
+		AcquireWorld();
+		TestTrue(TEXT("Pooled world starts fresh"), CaptureWorld(World) == Fresh);
+
+		RunTypicalTest();
+		TWeakObjectPtr<AActor> WeakActor = TestActor;
+		TWeakObjectPtr<UAbilitySystemComponent> WeakASC = TestASC;
+		const FWorldSnapshot Used = CaptureWorld(World);
+		TestFalse(TEXT("Test left actors and events behind"), Used == Fresh);
+
+		ReleaseWorld();
+		const FWorldSnapshot Reset = CaptureWorld(World);
+		if (!TestTrue(TEXT("Reset world is equivalent to a fresh one"), Reset == Fresh))
+		{
+			AddInfo(FString::Printf(TEXT("Fresh: %s"), *Fresh.ToString()));
+			AddInfo(FString::Printf(TEXT("Reset: %s"), *Reset.ToString()));
+		}
+
+		TestTrue(TEXT("Frame counter restored"), GFrameCounter == InitialFrameCounter);
+		TestTrue(TEXT("Used world had timers and effects"), Used.NumTimers > Fresh.NumTimers && Used.NumActiveGameplayEffects > 0);
+		TestTrue(TEXT("World time went on, then was restored"), Used.TimeSeconds > Fresh.TimeSeconds && FMath::IsNearlyEqual(Reset.TimeSeconds, Fresh.TimeSeconds));
+		TestTrue(TEXT("Test pointers cleared"), TestActor == nullptr && TestASC == nullptr);
+
+		// Nothing of the test outlives a GC
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		TestFalse(TEXT("Actor collected"), WeakActor.IsValid());
+		TestFalse(TEXT("ASC collected"), WeakASC.IsValid());
+
+		// And the world is still usable
+		AcquireWorld();
+		RunTypicalTest();
+		TestTrue(TEXT("Reused world runs tests"), TestASC && TestASC->GetActiveGameplayEffects().GetNumGameplayEffects() > 0);
+		ReleaseWorld();
+	});
+
+	// Synthetic: NumSpeedupIterations runs of RunTypicalTest(), not the suite. Gives the per test saving of the pool, not
+	// the wall time it saves on BlueprintAttributes.*, which depends on how many Its acquire the pooled world.
+	It(TEXT("should be faster than creating a world for each test, on a synthetic loop"), [this]()
+	{
+		const uint64 FreshStartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumSpeedupIterations; ++Index)
+		{
+			World = CreateWorld(InitialFrameCounter);
+			RunTypicalTest();
+			if (TestActor)
+			{
+				World->EditorDestroyActor(TestActor, false);
+			}
+			TeardownWorld(World, InitialFrameCounter);
+		}
+		const double FreshMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FreshStartCycles);
+
+		const uint64 PooledStartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumSpeedupIterations; ++Index)
+		{
+			AcquireWorld();
+			RunTypicalTest();
+			ReleaseWorld();
+		}
+		const double PooledMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PooledStartCycles);
+
+		AddInfo(FString::Printf(
+			TEXT("Synthetic loop of %d typical tests (not the suite): fresh worlds %.2f ms, pooled world %.2f ms (%.1fx)"),
+			NumSpeedupIterations,
+			FreshMs,
+			PooledMs,
+			PooledMs > 0.0 ? FreshMs / PooledMs : 0.0
+		));
+		TestTrue(TEXT("Pooled world is faster"), PooledMs < FreshMs);
+	});
+
+	AfterEach([this]()
+	{
+		DestroyPooledWorld();
+	});
+}
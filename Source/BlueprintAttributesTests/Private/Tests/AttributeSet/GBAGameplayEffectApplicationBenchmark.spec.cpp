@@ -0,0 +1,247 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsBaselineStore.h"
+#include "GBATestsBenchmark.h"
+#include "GBATestsNativeHealthSet.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAGameplayEffectApplicationBenchmarkSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Perf.GameplayEffectApplication", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureHealthSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthSet.GBA_Test_HealthSet_C");
+	static constexpr const TCHAR* FixtureDamageEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_Damage.GE_Test_Damage_C");
+	static constexpr const TCHAR* FixtureHealthRegenEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GE_Test_HealthRegen.GE_Test_HealthRegen_C");
+	static constexpr const TCHAR* FixtureStatsAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureStatsInitEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+
+	static constexpr int32 NumWarmupPasses = 2;
+	static constexpr int32 NumPasses = 50;
+	static constexpr int32 NumOpsPerPass = 200;
+
+	static constexpr const TCHAR* CsvHeader = TEXT("Effect,AttributeSet,MeanNsPerOp,P50NsPerOp,P99NsPerOp,AllocsPerOp");
+
+	/** Same attributes on both, TestASC has the native set and BlueprintASC the Blueprint one */
+	ACharacter* BlueprintActor = nullptr;
+	UAbilitySystemComponent* BlueprintASC = nullptr;
+
+	ACharacter* SpawnFixtureCharacter(UAbilitySystemComponent*& OutASC)
+	{
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return nullptr;
+		}
+
+		ACharacter* Character = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+		OutASC = Character ? Character->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!OutASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+			return nullptr;
+		}
+
+		Character->DispatchBeginPlay();
+		return Character;
+	}
+
+	bool GrantAttributeSet(UAbilitySystemComponent* InASC, const TCHAR* InLoadPath)
+	{
+		const TSubclassOf<UAttributeSet> AttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), InLoadPath);
+		if (!IsValid(AttributeSetClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), InLoadPath));
+			return false;
+		}
+
+		InASC->InitStats(AttributeSetClass, nullptr);
+		return HasAttributeSet(InASC, AttributeSetClass);
+	}
+
+	/** Health +1 effect, with the same shape for both sets */
+	static UGameplayEffect* MakeHealthEffect(const UClass* InAttributeSetClass, const EGameplayEffectDurationType InDurationPolicy, const float InPeriod = 0.f)
+	{
+		const FName Name = MakeUniqueObjectName(GetTransientPackage(), UGameplayEffect::StaticClass(), *FString::Printf(TEXT("%s_HealthEffect"), *InAttributeSetClass->GetName()));
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), Name);
+
+		FProperty* Property = FindFieldChecked<FProperty>(InAttributeSetClass, TEXT("Health"));
+		AddModifier(Effect, Property, EGameplayModOp::Additive, FScalableFloat(1.f));
+
+		Effect->DurationPolicy = InDurationPolicy;
+		if (InDurationPolicy == EGameplayEffectDurationType::HasDuration)
+		{
+			Effect->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(10.f));
+		}
+		Effect->Period.Value = InPeriod;
+		return Effect;
+	}
+
+	static UGameplayEffect* LoadEffect(const TCHAR* InLoadPath)
+	{
+		const TSubclassOf<UGameplayEffect> EffectClass = LoadFixtureClass(UGameplayEffect::StaticClass(), InLoadPath);
+		return EffectClass ? EffectClass->GetDefaultObject<UGameplayEffect>() : nullptr;
+	}
+
+	/** Times InOp, then counts its allocations (on the game thread) over one more pass, reports a CSV row and checks it against its baseline */
+	void Measure(const FString& InEffectName, const FString& InAttributeSetName, const TFunctionRef<void()> InOp)
+	{
+		const FGBATestsBenchmarkStats Stats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, NumOpsPerPass, [InOp]()
+		{
+			for (int32 Index = 0; Index < NumOpsPerPass; ++Index)
+			{
+				InOp();
+			}
+		});
+
+		double AllocsPerOp = -1.0;
+		if (FGBATestsScopedAllocationCounter::IsSupported())
+		{
+			const FGBATestsScopedAllocationCounter Counter;
+			for (int32 Index = 0; Index < NumOpsPerPass; ++Index)
+			{
+				InOp();
+			}
+			AllocsPerOp = static_cast<double>(Counter.GetNum()) / NumOpsPerPass;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s,%s,%.1f,%.1f,%.1f,%.2f"), *InEffectName, *InAttributeSetName, Stats.Mean, Stats.Median, Stats.P99, AllocsPerOp));
+		FGBATestsBaselineStore::Get().Check(*this, FString::Printf(TEXT("%s.%s"), *InEffectName, *InAttributeSetName), Stats);
+	}
+
+	/** Applies InEffect, removing it right away when it isn't instant so that active effects don't pile up */
+	void MeasureApply(const FString& InEffectName, UAbilitySystemComponent* InASC, const UGameplayEffect* InEffect)
+	{
+		if (!InEffect)
+		{
+			AddError(FString::Printf(TEXT("Invalid effect for %s"), *InEffectName));
+			return;
+		}
+
+		const FString AttributeSetName = InASC == TestASC ? TEXT("Native") : TEXT("Blueprint");
+		Measure(InEffectName, AttributeSetName, [InASC, InEffect]()
+		{
+			const FActiveGameplayEffectHandle Handle = InASC->ApplyGameplayEffectToSelf(InEffect, 1.f, InASC->MakeEffectContext());
+			if (Handle.IsValid())
+			{
+				InASC->RemoveActiveGameplayEffect(Handle);
+			}
+		});
+	}
+
+	/** Executes one period of InEffect, as the active effect timer does */
+	void MeasurePeriod(const FString& InEffectName, UAbilitySystemComponent* InASC, const UGameplayEffect* InEffect)
+	{
+		const FActiveGameplayEffectHandle Handle = InASC->ApplyGameplayEffectToSelf(InEffect, 1.f, InASC->MakeEffectContext());
+		if (!Handle.IsValid())
+		{
+			AddError(FString::Printf(TEXT("Unable to apply %s"), *InEffectName));
+			return;
+		}
+
+		const FString AttributeSetName = InASC == TestASC ? TEXT("Native") : TEXT("Blueprint");
+		Measure(InEffectName, AttributeSetName, [InASC, Handle]()
+		{
+			InASC->ExecutePeriodicEffect(Handle);
+		});
+
+		InASC->RemoveActiveGameplayEffect(Handle);
+	}
+
+	/** Builds the same effect for both sets, and measures it on each */
+	void CompareHealthEffect(const FString& InEffectName, const EGameplayEffectDurationType InDurationPolicy, const float InPeriod = 0.f)
+	{
+		AddInfo(CsvHeader);
+		for (UAbilitySystemComponent* ASC : { TestASC, BlueprintASC })
+		{
+			const UClass* AttributeSetClass = ASC == TestASC ? UGBATestsNativeHealthSet::StaticClass() : LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath);
+			UGameplayEffect* Effect = MakeHealthEffect(AttributeSetClass, InDurationPolicy, InPeriod);
+			if (InPeriod > 0.f)
+			{
+				MeasurePeriod(InEffectName, ASC, Effect);
+			}
+			else
+			{
+				MeasureApply(InEffectName, ASC, Effect);
+			}
+		}
+	}
+
+GBA_END_DEFINE_SPEC(FGBAGameplayEffectApplicationBenchmarkSpec)
+
+void FGBAGameplayEffectApplicationBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+		TestActor = SpawnFixtureCharacter(TestASC);
+		BlueprintActor = SpawnFixtureCharacter(BlueprintASC);
+		if (!TestASC || !BlueprintASC)
+		{
+			return;
+		}
+
+		TestASC->InitStats(UGBATestsNativeHealthSet::StaticClass(), nullptr);
+		TestTrue(TEXT("Native set granted"), HasAttributeSet(TestASC, UGBATestsNativeHealthSet::StaticClass()));
+		TestTrue(TEXT("Blueprint set granted"), GrantAttributeSet(BlueprintASC, FixtureHealthSetLoadPath));
+	});
+
+	Describe(TEXT("Native UAttributeSet vs UGBAAttributeSetBlueprintBase"), [this]()
+	{
+		It(TEXT("instant effect"), [this]()
+		{
+			CompareHealthEffect(TEXT("Instant"), EGameplayEffectDurationType::Instant);
+		});
+
+		It(TEXT("duration effect (apply and remove)"), [this]()
+		{
+			CompareHealthEffect(TEXT("Duration"), EGameplayEffectDurationType::HasDuration);
+		});
+
+		It(TEXT("infinite effect (apply and remove)"), [this]()
+		{
+			CompareHealthEffect(TEXT("Infinite"), EGameplayEffectDurationType::Infinite);
+		});
+
+		It(TEXT("periodic effect (one period)"), [this]()
+		{
+			CompareHealthEffect(TEXT("Periodic"), EGameplayEffectDurationType::Infinite, 1.f);
+		});
+	});
+
+	Describe(TEXT("Fixture effects"), [this]()
+	{
+		It(TEXT("GE_Test_Damage and GE_Test_HealthRegen on GBA_Test_HealthSet"), [this]()
+		{
+			AddInfo(CsvHeader);
+			MeasureApply(TEXT("GE_Test_Damage"), BlueprintASC, LoadEffect(FixtureDamageEffectLoadPath));
+			MeasureApply(TEXT("GE_Test_HealthRegen"), BlueprintASC, LoadEffect(FixtureHealthRegenEffectLoadPath));
+		});
+
+		It(TEXT("GE_Test_Stats_Init on GBA_Test_Stats"), [this]()
+		{
+			if (!GrantAttributeSet(BlueprintASC, FixtureStatsAttributeSetLoadPath))
+			{
+				return;
+			}
+
+			AddInfo(CsvHeader);
+			MeasureApply(TEXT("GE_Test_Stats_Init"), BlueprintASC, LoadEffect(FixtureStatsInitEffectLoadPath));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
+	});
+}
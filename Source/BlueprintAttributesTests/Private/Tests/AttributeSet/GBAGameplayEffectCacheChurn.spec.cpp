@@ -0,0 +1,145 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsBenchmark.h"
+#include "GBATestsGameplayEffectCache.h"
+#include "GBATestsNativeHealthSet.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Parse.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Cost of one-off runtime Gameplay Effects (eg. dynamic damage), built per hit with NewObject() and AddModifier() as
+ * gameplay code commonly does, against shared effects from FGBATestsGameplayEffectCache with set by caller magnitudes.
+ *
+ * Reports time per hit, then UObjects created by a burst of hits and the time the following GC takes. The number of
+ * hits of a burst can be set from the command line: -GBAEffectCacheHits=10000
+ *
+ * Fails if hits through the cache create any UObject.
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAGameplayEffectCacheChurnSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Perf.GameplayEffectCache", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* CsvHeader = TEXT("Mode,Hits,NewUObjects,NsPerHit,GCMs");
+
+	int32 NumHits = 10000;
+	int32 HitIndex = 0;
+
+	FGameplayAttribute HealthAttribute;
+
+	/** Alternates damage and heal, so that Health stays around its initial value */
+	float NextMagnitude()
+	{
+		return (HitIndex++ & 1) ? 1.f : -1.f;
+	}
+
+	void HitWithNewEffect()
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UGameplayEffect::StaticClass(), TEXT("DamageEffect")));
+		AddModifier(Effect, HealthAttribute.GetUProperty(), EGameplayModOp::Additive, FScalableFloat(NextMagnitude()));
+		Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		TestASC->ApplyGameplayEffectToSelf(Effect, 1.f, TestASC->MakeEffectContext());
+	}
+
+	void HitWithCachedEffect()
+	{
+		FGBATestsGameplayEffectCache::Get().Apply(TestASC, { HealthAttribute, EGameplayModOp::Additive }, { NextMagnitude() });
+	}
+
+	/** Runs a burst of NumHits hits, then collects garbage. Returns the UObjects the burst created. */
+	int32 MeasureChurn(const FString& InMode, const TFunctionRef<void()> InHit)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		const int32 NumObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumHits; ++Index)
+		{
+			InHit();
+		}
+		const double HitsNanoseconds = FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		const int32 NumNewObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - NumObjectsBefore;
+
+		const uint64 GCStartCycles = FPlatformTime::Cycles64();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		const double GCMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - GCStartCycles);
+
+		AddInfo(FString::Printf(TEXT("%s,%d,%d,%.1f,%.3f"), *InMode, NumHits, NumNewObjects, HitsNanoseconds / FMath::Max(NumHits, 1), GCMs));
+		return NumNewObjects;
+	}
+
+GBA_END_DEFINE_SPEC(FGBAGameplayEffectCacheChurnSpec)
+
+void FGBAGameplayEffectCacheChurnSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("GBAEffectCacheHits="), NumHits);
+
+		AcquireWorld();
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		TestActor = ActorClass ? Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters())) : nullptr;
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!TestASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), FixtureCharacterLoadPath));
+			return;
+		}
+
+		TestActor->DispatchBeginPlay();
+		TestASC->InitStats(UGBATestsNativeHealthSet::StaticClass(), nullptr);
+		HealthAttribute = UGBATestsNativeHealthSet::GetHealthAttribute();
+		HitIndex = 0;
+	});
+
+	It(TEXT("time per hit"), [this]()
+	{
+		if (!TestASC)
+		{
+			return;
+		}
+
+		// Keeps the number of effects NewObject() leaves behind for GC in check
+		FGBATestsBenchmarkParams Params;
+		Params.NumSamples = 20;
+		Params.MaxOpsPerSample = 1024;
+
+		RunBenchmark(TEXT("NewObject"), [this]() { HitWithNewEffect(); }, Params);
+		RunBenchmark(TEXT("Cached"), [this]() { HitWithCachedEffect(); }, Params);
+	});
+
+	It(TEXT("UObject churn and GC time"), [this]()
+	{
+		if (!TestASC)
+		{
+			return;
+		}
+
+		// Builds the cached effect
+		HitWithCachedEffect();
+		HitWithCachedEffect();
+
+		AddInfo(CsvHeader);
+		MeasureChurn(TEXT("NewObject"), [this]() { HitWithNewEffect(); });
+		const int32 NumCachedObjects = MeasureChurn(TEXT("Cached"), [this]() { HitWithCachedEffect(); });
+
+		TestEqual(TEXT("UObjects created by cached effect hits"), NumCachedObjects, 0);
+	});
+
+	AfterEach([this]()
+	{
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
+	});
+}
@@ -0,0 +1,275 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsAttributeMetaDataImporter.h"
+#include "GBATestsBakedAttributeInit.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBATestsBakedAttributeInitSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBATestsBakedAttributeInit", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureStatsAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureStatsDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats");
+	static constexpr const TCHAR* FixtureClampAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Clamping.GBA_Test_Clamping_C");
+	static constexpr const TCHAR* FixtureClampDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Clamp");
+	static constexpr const TCHAR* NativeHealthSetLoadPath = TEXT("/Script/BlueprintAttributesTests.GBATestsNativeHealthSet");
+
+	/** Distinct base values for every GBA_Test_Stats attribute, without min / max values so that nothing requires the DataTable */
+	static constexpr const TCHAR* StatsRows = TEXT(R"(
+		---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack
+		GBA_Test_Stats.Vitality,"12.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Endurance,"13.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Strength,"14.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Dexterity,"15.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Intelligence,"16.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Faith,"17.000000","0.000000","0.000000","","False"
+		GBA_Test_Stats.Luck,"18.000000","0.000000","0.000000","","False"
+	)");
+
+	/** Native sets ignore min / max values of their rows */
+	static constexpr const TCHAR* NativeHealthRows = TEXT(R"(
+		---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack
+		GBATestsNativeHealthSet.Health,"50.000000","0.000000","100.000000","","False"
+		GBATestsNativeHealthSet.MinHealth,"-10.000000","0.000000","0.000000","","False"
+		GBATestsNativeHealthSet.MaxHealth,"100.000000","0.000000","0.000000","","False"
+	)");
+
+	/** Initialized from the baked asset, while TestActor / TestASC are initialized from the DataTable */
+	ACharacter* BakedActor = nullptr;
+	UAbilitySystemComponent* BakedASC = nullptr;
+
+	ACharacter* SpawnFixtureCharacter(UAbilitySystemComponent*& OutASC)
+	{
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return nullptr;
+		}
+
+		ACharacter* Character = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+		if (!Character)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+			return nullptr;
+		}
+
+		OutASC = Character->FindComponentByClass<UAbilitySystemComponent>();
+		if (!OutASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to get ASC from test actor %s"), *GetNameSafe(Character)));
+			return nullptr;
+		}
+
+		Character->DispatchBeginPlay();
+		return Character;
+	}
+
+	static UDataTable* ImportDataTable(const TCHAR* InRows)
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UDataTable::StaticClass(), TEXT("TempDataTable")));
+		DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+
+		FGBATestsAttributeMetaDataImporter Importer(false);
+		Importer.ImportString(InRows, DataTable);
+		return DataTable;
+	}
+
+	static UGBATestsBakedAttributeInit* CreateBakedInit(const TSubclassOf<UAttributeSet>& InAttributeSetClass, UDataTable* InDataTable)
+	{
+		UGBATestsBakedAttributeInit* BakedInit = NewObject<UGBATestsBakedAttributeInit>(GetTransientPackage());
+		BakedInit->AttributeSetClass = InAttributeSetClass;
+		BakedInit->DataTable = InDataTable;
+		BakedInit->Bake();
+		return BakedInit;
+	}
+
+	/** Every attribute of InAttributeSetClass has the same base and current value on both ASCs */
+	void TestSameValues(const UClass* InAttributeSetClass)
+	{
+		TArray<FProperty*> Properties;
+		UGBATestsBakedAttributeInit::GetAttributeProperties(InAttributeSetClass, Properties);
+		TestTrue(TEXT("Has attributes"), Properties.Num() > 0);
+
+		for (FProperty* Property : Properties)
+		{
+			const FGameplayAttribute Attribute(Property);
+			const FString Name = Attribute.GetName();
+
+			TestEqual(*FString::Printf(TEXT("%s base value"), *Name), BakedASC->GetNumericAttributeBase(Attribute), TestASC->GetNumericAttributeBase(Attribute), 0.f);
+			TestEqual(*FString::Printf(TEXT("%s current value"), *Name), BakedASC->GetNumericAttribute(Attribute), TestASC->GetNumericAttribute(Attribute), 0.f);
+		}
+	}
+
+	/** Initializes TestASC from the DataTable and BakedASC from the baked asset, and compares their values */
+	void TestInitFromBaked(const TSubclassOf<UAttributeSet>& InAttributeSetClass, UDataTable* InDataTable, const UGBATestsBakedAttributeInit* InBakedInit, const EGBATestsBakedAttributeInitPath InExpectedPath)
+	{
+		TestASC->InitStats(InAttributeSetClass, InDataTable);
+		const EGBATestsBakedAttributeInitPath Path = InBakedInit->InitStats(BakedASC);
+
+		TestTrue(TEXT("Initialized from the expected path"), Path == InExpectedPath);
+		TestSameValues(InAttributeSetClass);
+	}
+
+	/** Baked vs DataTable equivalence, for a fixture that must take the baked path (anything else compares the DataTable against itself) */
+	void DescribeFixture(const FString& InDescription, const TCHAR* InAttributeSetLoadPath, const TFunction<UDataTable*()>& InGetDataTable)
+	{
+		Describe(InDescription, [this, InAttributeSetLoadPath, InGetDataTable]()
+		{
+			BeforeEach([this, InAttributeSetLoadPath]()
+			{
+				TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), InAttributeSetLoadPath);
+				if (!IsValid(TestAttributeSetClass))
+				{
+					AddError(FString::Printf(TEXT("Unable to load %s"), InAttributeSetLoadPath));
+				}
+			});
+
+			It(TEXT("should bake values resolved against the attribute set layout"), [this, InGetDataTable]()
+			{
+				const UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, InGetDataTable());
+				TestTrue(TEXT("Has baked values"), BakedInit->GetBakedValues().Num() > 0);
+				TestTrue(TEXT("Layout is up to date"), BakedInit->IsLayoutUpToDate(TestAttributeSetClass));
+				TestFalse(TEXT("Requires DataTable"), BakedInit->RequiresDataTable());
+				AddInfo(FString::Printf(TEXT("%d baked values"), BakedInit->GetBakedValues().Num()));
+			});
+
+			It(TEXT("should init the same values as the DataTable"), [this, InGetDataTable]()
+			{
+				UDataTable* DataTable = InGetDataTable();
+				const UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, DataTable);
+				TestFalse(TEXT("Requires DataTable"), BakedInit->RequiresDataTable());
+				TestInitFromBaked(TestAttributeSetClass, DataTable, BakedInit, EGBATestsBakedAttributeInitPath::Baked);
+			});
+
+			It(TEXT("should init the same values once serialized"), [this, InGetDataTable]()
+			{
+				UDataTable* DataTable = InGetDataTable();
+				UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, DataTable);
+
+				TArray<uint8> Bytes;
+				FObjectWriter Writer(BakedInit, Bytes);
+
+				UGBATestsBakedAttributeInit* LoadedBakedInit = NewObject<UGBATestsBakedAttributeInit>(GetTransientPackage());
+				FObjectReader Reader(LoadedBakedInit, Bytes);
+
+				TestTrue(TEXT("Layout hash"), LoadedBakedInit->GetLayoutHash() == BakedInit->GetLayoutHash());
+				TestEqual(TEXT("Number of baked values"), LoadedBakedInit->GetBakedValues().Num(), BakedInit->GetBakedValues().Num());
+				TestFalse(TEXT("Requires DataTable"), LoadedBakedInit->RequiresDataTable());
+				TestInitFromBaked(TestAttributeSetClass, DataTable, LoadedBakedInit, EGBATestsBakedAttributeInitPath::Baked);
+			});
+		});
+	}
+
+GBA_END_DEFINE_SPEC(FGBATestsBakedAttributeInitSpec)
+
+void FGBATestsBakedAttributeInitSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+		TestActor = SpawnFixtureCharacter(TestASC);
+		BakedActor = SpawnFixtureCharacter(BakedASC);
+	});
+
+	// Only unclamped fixtures take the baked path. GBA_Test_Clamping (FGBAGameplayClampedAttributeData attributes) always
+	// falls back to the DataTable, which the Clamping block below covers.
+	DescribeFixture(TEXT("GBA_Test_Stats with unclamped rows"), FixtureStatsAttributeSetLoadPath, []() { return ImportDataTable(StatsRows); });
+	DescribeFixture(TEXT("GBA_Test_Stats with DT_Test_Stats"), FixtureStatsAttributeSetLoadPath, []() { return StaticLoadDataTable(FixtureStatsDataTableLoadPath); });
+	DescribeFixture(TEXT("UGBATestsNativeHealthSet with rows"), NativeHealthSetLoadPath, []() { return ImportDataTable(NativeHealthRows); });
+
+	Describe(TEXT("Clamping"), [this]()
+	{
+		It(TEXT("should require the DataTable for clamped attributes, and init clamped values"), [this]()
+		{
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
+			if (!IsValid(TestAttributeSetClass))
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureClampAttributeSetLoadPath));
+				return;
+			}
+
+			// Same case as GBAAttributeSetClamping spec, a DataTable base value higher than the property clamp
+			UDataTable* DataTable = ImportDataTable(TEXT(R"(
+				---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack
+				GBA_Test_Clamping.TestClampedAttributeOnInit_02,"2000.000000","0.000000","0.000000","","False"
+			)"));
+
+			const UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, DataTable);
+			TestTrue(TEXT("Clamped attributes require the DataTable"), BakedInit->RequiresDataTable());
+
+			TestInitFromBaked(TestAttributeSetClass, DataTable, BakedInit, EGBATestsBakedAttributeInitPath::DataTable);
+			TestEqual(TEXT("Clamped on init"), BakedASC->GetNumericAttribute(GetAttributeProperty(TestAttributeSetClass, TEXT("TestClampedAttributeOnInit_02"))), 100.f);
+		});
+
+		It(TEXT("should fall back to the DataTable with DT_Test_Clamp clamping ranges"), [this]()
+		{
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
+			UDataTable* DataTable = StaticLoadDataTable(FixtureClampDataTableLoadPath);
+			if (!IsValid(TestAttributeSetClass) || !DataTable)
+			{
+				AddError(TEXT("Unable to load fixtures"));
+				return;
+			}
+
+			const UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, DataTable);
+			TestTrue(TEXT("Clamping ranges require the DataTable"), BakedInit->RequiresDataTable());
+			TestInitFromBaked(TestAttributeSetClass, DataTable, BakedInit, EGBATestsBakedAttributeInitPath::DataTable);
+		});
+	});
+
+	Describe(TEXT("Layout hash"), [this]()
+	{
+		It(TEXT("should fall back to the DataTable when the layout hash mismatches"), [this]()
+		{
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureStatsAttributeSetLoadPath);
+			const TSubclassOf<UAttributeSet> OtherAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureClampAttributeSetLoadPath);
+			UDataTable* DataTable = StaticLoadDataTable(FixtureStatsDataTableLoadPath);
+			if (!IsValid(TestAttributeSetClass) || !IsValid(OtherAttributeSetClass) || !DataTable)
+			{
+				AddError(TEXT("Unable to load fixtures"));
+				return;
+			}
+
+			// Baked for GBA_Test_Stats, but used with another layout
+			UGBATestsBakedAttributeInit* BakedInit = CreateBakedInit(TestAttributeSetClass, DataTable);
+			BakedInit->AttributeSetClass = OtherAttributeSetClass;
+
+			TestFalse(TEXT("Layout is stale"), BakedInit->IsLayoutUpToDate(OtherAttributeSetClass));
+			TestInitFromBaked(OtherAttributeSetClass, DataTable, BakedInit, EGBATestsBakedAttributeInitPath::DataTable);
+		});
+
+		It(TEXT("should fall back to the DataTable when not baked"), [this]()
+		{
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureStatsAttributeSetLoadPath);
+			UDataTable* DataTable = StaticLoadDataTable(FixtureStatsDataTableLoadPath);
+			if (!IsValid(TestAttributeSetClass) || !DataTable)
+			{
+				AddError(TEXT("Unable to load fixtures"));
+				return;
+			}
+
+			UGBATestsBakedAttributeInit* BakedInit = NewObject<UGBATestsBakedAttributeInit>(GetTransientPackage());
+			BakedInit->AttributeSetClass = TestAttributeSetClass;
+			BakedInit->DataTable = DataTable;
+
+			TestInitFromBaked(TestAttributeSetClass, DataTable, BakedInit, EGBATestsBakedAttributeInitPath::DataTable);
+		});
+	});
+
+	AfterEach([this]()
+	{
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
+	});
+}
@@ -0,0 +1,155 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsFixtureRegistry.h"
+#include "GBATestsGameplayEffectCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Cold first lookup of every fixture, with a synchronous load per fixture (registry off, as BeforeEach blocks did)
+ * against a registry preload followed by cached lookups (registry on).
+ *
+ * Fixture packages are unloaded in between, which releases the pooled world, the Gameplay Effect cache and the shared
+ * registry first. Flags cleared to unload are restored and the registry preloaded again once done, but fixture objects
+ * other tests already hold are not valid anymore: run it in its own process, eg.
+ * -ExecCmds="Automation RunTests BlueprintAttributes.Perf.GBATestsFixtureRegistry; Quit"
+ */
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBATestsFixtureRegistryBenchmarkSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.Perf.GBATestsFixtureRegistry", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Objects of fixture packages RF_Standalone was cleared on, restored by AfterEach() if not collected */
+	TArray<TWeakObjectPtr<UObject>> StandaloneObjects;
+
+	/** Asset paths of every fixture, as the specs look them up */
+	static TArray<FSoftObjectPath> GetFixturePaths()
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPath(FGBATestsFixtureRegistry::FixturesRoot, Assets, true);
+
+		TArray<FSoftObjectPath> Paths;
+		Paths.Reserve(Assets.Num());
+		for (const FAssetData& Asset : Assets)
+		{
+			Paths.Add(Asset.GetSoftObjectPath());
+		}
+		return Paths;
+	}
+
+	/** Unloads fixture packages nothing else references, so that the next lookups are cold. Returns the number still loaded. */
+	int32 UnloadFixturePackages(const TArray<FSoftObjectPath>& InPaths)
+	{
+		// Loaded assets are RF_Standalone, which keeps them around across GC until cleared
+		for (const FSoftObjectPath& Path : InPaths)
+		{
+			UPackage* Package = FindPackage(nullptr, *Path.GetLongPackageName());
+			if (Package && !Package->IsDirty())
+			{
+				ForEachObjectWithPackage(Package, [this](UObject* Object)
+				{
+					if (Object->HasAnyFlags(RF_Standalone))
+					{
+						Object->ClearFlags(RF_Standalone);
+						StandaloneObjects.Add(Object);
+					}
+					return true;
+				}, true, RF_NoFlags);
+			}
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		int32 NumLoaded = 0;
+		for (const FSoftObjectPath& Path : InPaths)
+		{
+			NumLoaded += FindPackage(nullptr, *Path.GetLongPackageName()) ? 1 : 0;
+		}
+		return NumLoaded;
+	}
+
+GBA_END_DEFINE_SPEC(FGBATestsFixtureRegistryBenchmarkSpec)
+
+void FGBATestsFixtureRegistryBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		// Whatever still references fixtures: the world another spec pooled (through taking it over), cached effects
+		// keyed on fixture attributes, and the shared registry (recreated on next Get())
+		AcquireWorld();
+		DestroyPooledWorld();
+		FGBATestsGameplayEffectCache::Get().Reset();
+		FGBATestsFixtureRegistry::Shutdown();
+	});
+
+	It(TEXT("should report first lookup times of every fixture with and without preloading"), [this]()
+	{
+		const TArray<FSoftObjectPath> Paths = GetFixturePaths();
+		if (!TestTrue(TEXT("Fixtures"), !Paths.IsEmpty()))
+		{
+			return;
+		}
+
+		// Registry off: a synchronous load per fixture
+		const int32 NumStillLoadedOff = UnloadFixturePackages(Paths);
+		const uint64 OffStartCycles = FPlatformTime::Cycles64();
+		int32 NumLoadedOff = 0;
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			NumLoadedOff += Path.TryLoad() ? 1 : 0;
+		}
+		const double OffMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - OffStartCycles);
+
+		// Registry on: parallel preload, then cached lookups
+		const int32 NumStillLoadedOn = UnloadFixturePackages(Paths);
+		double OnMs = 0.0;
+		int32 NumLoadedOn = 0;
+		{
+			FGBATestsFixtureRegistry Registry;
+
+			const uint64 OnStartCycles = FPlatformTime::Cycles64();
+			Registry.Preload();
+			for (const FSoftObjectPath& Path : Paths)
+			{
+				NumLoadedOn += Registry.GetObject(Path.ToString()) ? 1 : 0;
+			}
+			OnMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - OnStartCycles);
+
+			AddInfo(FString::Printf(TEXT("Registry on: %s"), *Registry.GetStats().ToString()));
+		}
+
+		if (NumStillLoadedOff > 0 || NumStillLoadedOn > 0)
+		{
+			AddWarning(FString::Printf(TEXT("%d / %d fixture packages referenced elsewhere stayed loaded, first lookups are not fully cold"), FMath::Max(NumStillLoadedOff, NumStillLoadedOn), Paths.Num()));
+		}
+
+		TestEqual(TEXT("Same fixtures loaded"), NumLoadedOn, NumLoadedOff);
+
+		AddInfo(TEXT("Mode,Fixtures,FirstLookupMs"));
+		AddInfo(FString::Printf(TEXT("RegistryOff,%d,%.2f"), NumLoadedOff, OffMs));
+		AddInfo(FString::Printf(TEXT("RegistryOn,%d,%.2f"), NumLoadedOn, OnMs));
+		AddInfo(FString::Printf(TEXT("Cold first lookup speedup: %.2fx"), OnMs > 0.0 ? OffMs / OnMs : 0.0));
+	});
+
+	AfterEach([this]()
+	{
+		for (const TWeakObjectPtr<UObject>& Object : StandaloneObjects)
+		{
+			if (Object.IsValid())
+			{
+				Object->SetFlags(RF_Standalone);
+			}
+		}
+		StandaloneObjects.Reset();
+
+		FGBATestsFixtureRegistry::Shutdown();
+		FGBATestsFixtureRegistry::Get().Preload();
+	});
+}
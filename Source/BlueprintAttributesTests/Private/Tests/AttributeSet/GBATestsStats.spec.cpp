@@ -0,0 +1,68 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsStats.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBATestsStatsSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBATestsStats", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+
+GBA_END_DEFINE_SPEC(FGBATestsStatsSpec)
+
+void FGBATestsStatsSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+	});
+
+	Describe(TEXT("SampleAttributeSets()"), [this]()
+	{
+		It(TEXT("should count live Blueprint attribute sets and their memory"), [this]()
+		{
+			int32 NumBefore = 0;
+			int64 BytesBefore = 0;
+			FGBATestsStats::SampleAttributeSets(NumBefore, BytesBefore);
+
+			UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+			TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureAttributeSetLoadPath);
+			if (!IsValid(ActorClass) || !IsValid(TestAttributeSetClass))
+			{
+				AddError(TEXT("Unable to load fixtures"));
+				return;
+			}
+
+			// Fixture character grants GBA_Test_Stats on BeginPlay
+			TestActor = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+			TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+			if (!TestASC)
+			{
+				AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+				return;
+			}
+			TestActor->DispatchBeginPlay();
+
+			int32 NumAfter = 0;
+			int64 BytesAfter = 0;
+			FGBATestsStats::SampleAttributeSets(NumAfter, BytesAfter);
+
+			AddInfo(FString::Printf(TEXT("%d sets (%lld bytes) before, %d sets (%lld bytes) after"), NumBefore, BytesBefore, NumAfter, BytesAfter));
+			TestTrue(TEXT("Granted set is counted"), NumAfter > NumBefore);
+			TestTrue(TEXT("Granted set memory is counted"), BytesAfter - BytesBefore >= TestAttributeSetClass->GetStructureSize());
+		});
+	});
+
+	AfterEach([this]()
+	{
+		ReleaseWorld();
+	});
+}
@@ -0,0 +1,160 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsGameplayEffectCache.h"
+#include "GBATestsInstrumentedHealthSet.h"
+#include "GBATestsTrace.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+#if GBA_TESTS_TRACE_ENABLED
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBATestsTraceSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBATestsTrace", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureGameplayEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+
+	/** Channel state before the spec enabled it */
+	bool bWasChannelEnabled = false;
+
+	void CheckEmitted(const EGBATestsTraceEvent InEvent, const bool bInExpected)
+	{
+		const uint64 NumEmitted = FGBATestsTrace::GetNumEmitted(InEvent);
+		AddInfo(FString::Printf(TEXT("%s: %llu events"), FGBATestsTrace::LexToString(InEvent), NumEmitted));
+
+		if (bInExpected)
+		{
+			TestTrue(FString::Printf(TEXT("%s emitted"), FGBATestsTrace::LexToString(InEvent)), NumEmitted > 0);
+		}
+		else
+		{
+			TestTrue(FString::Printf(TEXT("%s not emitted"), FGBATestsTrace::LexToString(InEvent)), NumEmitted == 0);
+		}
+	}
+
+	/** Checks InEvent was emitted, and only ever inside an InEnclosingEvent scope */
+	void CheckEnclosed(const EGBATestsTraceEvent InEvent, const EGBATestsTraceEvent InEnclosingEvent)
+	{
+		const uint64 NumEmitted = FGBATestsTrace::GetNumEmitted(InEvent);
+		const uint64 NumEmittedWithin = FGBATestsTrace::GetNumEmittedWithin(InEvent, InEnclosingEvent);
+		AddInfo(FString::Printf(TEXT("%s: %llu events, %llu within %s"), FGBATestsTrace::LexToString(InEvent), NumEmitted, NumEmittedWithin, FGBATestsTrace::LexToString(InEnclosingEvent)));
+
+		TestTrue(FString::Printf(TEXT("%s emitted"), FGBATestsTrace::LexToString(InEvent)), NumEmitted > 0);
+		TestTrue(FString::Printf(TEXT("%s within %s"), FGBATestsTrace::LexToString(InEvent), FGBATestsTrace::LexToString(InEnclosingEvent)), NumEmittedWithin == NumEmitted);
+	}
+
+	static void SetChannelEnabled(const bool bInEnabled)
+	{
+		UE::Trace::ToggleChannel(TEXT("GBATests"), bInEnabled);
+	}
+
+GBA_END_DEFINE_SPEC(FGBATestsTraceSpec)
+
+void FGBATestsTraceSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AcquireWorld();
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return;
+		}
+
+		TestActor = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!TestASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+			return;
+		}
+
+		// Fixture character grants GBA_Test_Stats on BeginPlay
+		TestActor->DispatchBeginPlay();
+
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureAttributeSetLoadPath);
+		if (!HasAttributeSet(TestASC, TestAttributeSetClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to grant %s"), FixtureAttributeSetLoadPath));
+			return;
+		}
+
+		bWasChannelEnabled = FGBATestsTrace::IsEnabled();
+		FGBATestsTrace::ResetNumEmitted();
+	});
+
+	It(TEXT("should record every Blueprint event within the effect application"), [this]()
+	{
+		SetChannelEnabled(true);
+		if (!FGBATestsTrace::IsEnabled())
+		{
+			AddWarning(TEXT("GBATests trace channel couldn't be enabled (trace is read only?), skipping"));
+			return;
+		}
+
+		ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+		CheckEmitted(EGBATestsTraceEvent::EffectApply, true);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPreGameplayEffectExecute, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPostGameplayEffectExecute, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPreAttributeChange, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPostAttributeChange, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPreAttributeBaseChange, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::RecordPostAttributeBaseChange, EGBATestsTraceEvent::EffectApply);
+	});
+
+	It(TEXT("should enclose native clamping in the effect execution"), [this]()
+	{
+		SetChannelEnabled(true);
+		if (!FGBATestsTrace::IsEnabled())
+		{
+			AddWarning(TEXT("GBATests trace channel couldn't be enabled (trace is read only?), skipping"));
+			return;
+		}
+
+		TestASC->InitStats(UGBATestsInstrumentedHealthSet::StaticClass(), nullptr);
+		FGBATestsTrace::ResetNumEmitted();
+
+		FGBATestsGameplayEffectCache::Get().Apply(TestASC, { UGBATestsInstrumentedHealthSet::GetHealthAttribute(), EGameplayModOp::Additive }, { -200.f });
+
+		CheckEnclosed(EGBATestsTraceEvent::GameplayEffectExecute, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::AttributeChange, EGBATestsTraceEvent::EffectApply);
+		CheckEnclosed(EGBATestsTraceEvent::AttributeClamp, EGBATestsTraceEvent::EffectApply);
+		TestTrue(TEXT("AttributeClamp within GameplayEffectExecute"), FGBATestsTrace::GetNumEmittedWithin(EGBATestsTraceEvent::AttributeClamp, EGBATestsTraceEvent::GameplayEffectExecute) > 0);
+		TestEqual(TEXT("Clamped Health"), TestASC->GetNumericAttribute(UGBATestsInstrumentedHealthSet::GetHealthAttribute()), -20.f);
+	});
+
+	It(TEXT("should emit nothing when the channel is disabled"), [this]()
+	{
+		SetChannelEnabled(false);
+		if (FGBATestsTrace::IsEnabled())
+		{
+			AddWarning(TEXT("GBATests trace channel couldn't be disabled (trace is read only?), skipping"));
+			return;
+		}
+
+		ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+		for (int32 Index = 0; Index < static_cast<int32>(EGBATestsTraceEvent::Num); ++Index)
+		{
+			CheckEmitted(static_cast<EGBATestsTraceEvent>(Index), false);
+		}
+	});
+
+	AfterEach([this]()
+	{
+		SetChannelEnabled(bWasChannelEnabled);
+		ReleaseWorld();
+	});
+}
+
+#endif
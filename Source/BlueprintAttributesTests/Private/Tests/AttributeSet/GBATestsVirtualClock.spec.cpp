@@ -0,0 +1,175 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBAAttributeSetSpecBase.h"
+#include "GBATestsVirtualClock.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBATestsVirtualClockSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBATestsVirtualClock", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureHealthSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/AttributeBasedClamping/GBA_Test_HealthSet.GBA_Test_HealthSet_C");
+
+	static constexpr int32 NumChunks = 10;
+	static constexpr float ChunkSeconds = 60.f;
+
+	/** Attribute values sampled after each chunk of a scenario run */
+	struct FScenarioResult
+	{
+		TArray<float> Health;
+		TArray<float> MaxHealth;
+		TArray<int32> NumActiveEffects;
+		double WallSeconds = 0.0;
+	};
+
+	UGameplayEffect* MakeEffect(const TCHAR* InName, const FName& InAttributeName, const float InMagnitude, const EGameplayEffectDurationType InDurationPolicy, const float InDuration, const float InPeriod) const
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UGameplayEffect::StaticClass(), InName));
+		AddModifier(Effect, FindFieldChecked<FProperty>(TestAttributeSetClass, InAttributeName), EGameplayModOp::Additive, FScalableFloat(InMagnitude));
+
+		Effect->DurationPolicy = InDurationPolicy;
+		if (InDurationPolicy == EGameplayEffectDurationType::HasDuration)
+		{
+			Effect->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(InDuration));
+		}
+		Effect->Period.Value = InPeriod;
+		return Effect;
+	}
+
+	/**
+	 * Ten minutes of regen, periodic damage and a five minutes MaxHealth buff on GBA_Test_HealthSet.
+	 *
+	 * Effects are applied and sampled at offsets that keep every timer away from each other and from chunk
+	 * boundaries, so that fixed step ticking and the virtual clock can't order them differently.
+	 */
+	FScenarioResult RunScenario(const bool bInVirtualClock)
+	{
+		FScenarioResult Result;
+
+		World = CreateWorld(InitialFrameCounter);
+		bUseVirtualClock = bInVirtualClock;
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath);
+		TestActor = IsValid(ActorClass) ? Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters())) : nullptr;
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (!TestASC || !IsValid(TestAttributeSetClass))
+		{
+			AddError(TEXT("Unable to setup fixtures"));
+			TeardownWorld(World, InitialFrameCounter);
+			return Result;
+		}
+
+		TestActor->DispatchBeginPlay();
+		TestASC->InitStats(TestAttributeSetClass, nullptr);
+
+		const FGameplayAttribute HealthAttribute = GetAttributeProperty(TestAttributeSetClass, TEXT("Health"));
+		const FGameplayAttribute MaxHealthAttribute = GetAttributeProperty(TestAttributeSetClass, TEXT("MaxHealth"));
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		TestASC->ApplyGameplayEffectToSelf(MakeEffect(TEXT("RegenEffect"), TEXT("Health"), 1.f, EGameplayEffectDurationType::Infinite, 0.f, 1.f), 1.f, TestASC->MakeEffectContext());
+		AdvanceTime(0.05f);
+
+		TestASC->ApplyGameplayEffectToSelf(MakeEffect(TEXT("DamageEffect"), TEXT("Health"), -2.f, EGameplayEffectDurationType::Infinite, 0.f, 2.5f), 1.f, TestASC->MakeEffectContext());
+		TestASC->ApplyGameplayEffectToSelf(MakeEffect(TEXT("BuffEffect"), TEXT("MaxHealth"), 50.f, EGameplayEffectDurationType::HasDuration, 299.7f, 0.f), 1.f, TestASC->MakeEffectContext());
+		AdvanceTime(0.3f);
+
+		for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+		{
+			AdvanceTime(ChunkSeconds);
+
+			Result.Health.Add(TestASC->GetNumericAttribute(HealthAttribute));
+			Result.MaxHealth.Add(TestASC->GetNumericAttribute(MaxHealthAttribute));
+			Result.NumActiveEffects.Add(TestASC->GetActiveGameplayEffects().GetNumGameplayEffects());
+		}
+
+		Result.WallSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+		World->EditorDestroyActor(TestActor, false);
+		TeardownWorld(World, InitialFrameCounter);
+		TestActor = nullptr;
+		TestASC = nullptr;
+		World = nullptr;
+
+		return Result;
+	}
+
+GBA_END_DEFINE_SPEC(FGBATestsVirtualClockSpec)
+
+void FGBATestsVirtualClockSpec::Define()
+{
+	It(TEXT("should give the same results as ticking the world, in less time"), [this]()
+	{
+		const FScenarioResult Ticked = RunScenario(false);
+		const FScenarioResult Virtual = RunScenario(true);
+		if (Ticked.Health.Num() != NumChunks || Virtual.Health.Num() != NumChunks)
+		{
+			return;
+		}
+
+		for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+		{
+			const FString Time = FString::Printf(TEXT("%.0fs"), (Chunk + 1) * ChunkSeconds);
+			TestEqual(*FString::Printf(TEXT("Health at %s"), *Time), Virtual.Health[Chunk], Ticked.Health[Chunk]);
+			TestEqual(*FString::Printf(TEXT("MaxHealth at %s"), *Time), Virtual.MaxHealth[Chunk], Ticked.MaxHealth[Chunk]);
+			TestEqual(*FString::Printf(TEXT("Active effects at %s"), *Time), Virtual.NumActiveEffects[Chunk], Ticked.NumActiveEffects[Chunk]);
+		}
+
+		TestEqual(TEXT("Buff expired"), Virtual.NumActiveEffects[0] - Virtual.NumActiveEffects.Last(), 1);
+
+		AddInfo(FString::Printf(
+			TEXT("%.0f seconds of effects: ticked %.3f ms, virtual clock %.3f ms (%.1fx)"),
+			NumChunks * ChunkSeconds,
+			Ticked.WallSeconds * 1000.0,
+			Virtual.WallSeconds * 1000.0,
+			Virtual.WallSeconds > 0.0 ? Ticked.WallSeconds / Virtual.WallSeconds : 0.0
+		));
+		TestTrue(TEXT("Virtual clock is faster"), Virtual.WallSeconds < Ticked.WallSeconds);
+	});
+
+	It(TEXT("should step from one effect timer to the next"), [this]()
+	{
+		World = CreateWorld(InitialFrameCounter);
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureHealthSetLoadPath);
+		TestActor = IsValid(ActorClass) ? Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters())) : nullptr;
+		TestASC = TestActor ? TestActor->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		if (TestASC && IsValid(TestAttributeSetClass))
+		{
+			TestActor->DispatchBeginPlay();
+			TestASC->InitStats(TestAttributeSetClass, nullptr);
+
+			const UAbilitySystemComponent* ASC = TestASC;
+			TestEqual(TEXT("No pending event"), FGBATestsVirtualClock::GetTimeUntilNextEvent(World, { ASC }), -1.f);
+
+			TestASC->ApplyGameplayEffectToSelf(MakeEffect(TEXT("RegenEffect"), TEXT("Health"), 1.f, EGameplayEffectDurationType::Infinite, 0.f, 1.f), 1.f, TestASC->MakeEffectContext());
+			TestEqual(TEXT("Next period"), FGBATestsVirtualClock::GetTimeUntilNextEvent(World, { ASC }), 1.f, KINDA_SMALL_NUMBER);
+
+			const uint64 FrameCounter = GFrameCounter;
+			const int32 NumSteps = FGBATestsVirtualClock::Advance(World, 100.f, { ASC });
+			TestEqual(TEXT("One step per period"), NumSteps, 100);
+			TestTrue(TEXT("One frame per step"), GFrameCounter == FrameCounter + NumSteps);
+			TestAttribute(TEXT("Health"), 80.f);
+		}
+		else
+		{
+			AddError(TEXT("Unable to setup fixtures"));
+		}
+
+		if (TestActor)
+		{
+			World->EditorDestroyActor(TestActor, false);
+		}
+		TeardownWorld(World, InitialFrameCounter);
+		TestTrue(TEXT("Frame counter restored on teardown"), GFrameCounter == InitialFrameCounter);
+	});
+}
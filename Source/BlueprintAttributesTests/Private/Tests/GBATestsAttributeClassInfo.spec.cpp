@@ -0,0 +1,107 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "GBATestsBakedAttributeInit.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeClassInfoSpec, "BlueprintAttributes.GBATestsAttributeClassInfo", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumAttributes = 8;
+
+	UClass* GeneratedClass = nullptr;
+
+END_DEFINE_SPEC(FGBATestsAttributeClassInfoSpec)
+
+void FGBATestsAttributeClassInfoSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		FGBATestsAttributeSetGeneratorParams Params;
+		Params.NumAttributes = NumAttributes;
+		Params.ClampedRatio = 0.5f;
+		GeneratedClass = FGBATestsAttributeSetGenerator::CreateAttributeSetClass(TEXT("GBA_Test_ClassInfo"), Params);
+	});
+
+	Describe(TEXT("FindOrAdd()"), [this]()
+	{
+		It(TEXT("should only build class meta data on first call"), [this]()
+		{
+			TestNull(TEXT("Not built on class creation"), FGBATestsAttributeClassInfo::Find(GeneratedClass));
+
+			const FGBATestsAttributeClassInfo* Info = FGBATestsAttributeClassInfo::FindOrAdd(GeneratedClass);
+			if (!TestNotNull(TEXT("Built"), Info))
+			{
+				return;
+			}
+
+			TestTrue(TEXT("Cached"), FGBATestsAttributeClassInfo::Find(GeneratedClass) == Info);
+			TestTrue(TEXT("Reused"), FGBATestsAttributeClassInfo::FindOrAdd(GeneratedClass) == Info);
+		});
+
+		It(TEXT("should resolve attribute indices, row names and clamped attributes"), [this]()
+		{
+			const FGBATestsAttributeClassInfo* Info = FGBATestsAttributeClassInfo::FindOrAdd(GeneratedClass);
+			if (!TestNotNull(TEXT("Built"), Info))
+			{
+				return;
+			}
+
+			TestTrue(TEXT("Blueprint attribute set"), Info->bIsBlueprintAttributeSet);
+			TestEqual(TEXT("Set name"), Info->SetName, TEXT("GBA_Test_ClassInfo"));
+
+			TArray<FProperty*> Properties;
+			TestTrue(TEXT("Same layout hash as UGBATestsBakedAttributeInit"), Info->LayoutHash == UGBATestsBakedAttributeInit::GetAttributeProperties(GeneratedClass, Properties));
+			TestTrue(TEXT("Same attributes as UGBATestsBakedAttributeInit"), Info->Properties == Properties);
+			TestTrue(TEXT("Generated attributes"), Info->Properties.Num() >= NumAttributes);
+			TestEqual(TEXT("Row names"), Info->RowNames.Num(), Info->Properties.Num());
+			TestEqual(TEXT("Clamped attributes"), Info->ClampedIndices.Num(), NumAttributes / 2);
+
+			const FName AttributeName = FGBATestsAttributeSetGenerator::GetAttributeName(3);
+			const int32 Index = Info->FindIndex(AttributeName);
+			if (TestTrue(TEXT("Attribute index"), Info->Properties.IsValidIndex(Index)))
+			{
+				TestTrue(TEXT("Indexed property"), Info->Properties[Index]->GetFName() == AttributeName);
+				TestTrue(TEXT("Row name"), Info->RowNames[Index] == FName(TEXT("GBA_Test_ClassInfo.Attribute_0003")));
+			}
+			TestEqual(TEXT("Unknown attribute"), Info->FindIndex(TEXT("DoesNotExist")), INDEX_NONE);
+		});
+	});
+
+	Describe(TEXT("Invalidation"), [this]()
+	{
+		It(TEXT("should forget classes destroyed by the generator"), [this]()
+		{
+			TestNotNull(TEXT("Built"), FGBATestsAttributeClassInfo::FindOrAdd(GeneratedClass));
+
+			FGBATestsAttributeSetGenerator::Destroy(GeneratedClass);
+			TestNull(TEXT("Removed on Destroy()"), FGBATestsAttributeClassInfo::Find(GeneratedClass));
+			GeneratedClass = nullptr;
+		});
+
+#if WITH_EDITOR
+		It(TEXT("should forget classes whose objects are reinstanced"), [this]()
+		{
+			TestNotNull(TEXT("Built"), FGBATestsAttributeClassInfo::FindOrAdd(GeneratedClass));
+
+			// What Blueprint compilation broadcasts for the CDO of a recompiled class
+			TMap<UObject*, UObject*> OldToNewObjects;
+			OldToNewObjects.Add(GeneratedClass->GetDefaultObject(), GeneratedClass->GetDefaultObject());
+			FCoreUObjectDelegates::OnObjectsReinstanced.Broadcast(OldToNewObjects);
+			TestNull(TEXT("Removed on reinstancing"), FGBATestsAttributeClassInfo::Find(GeneratedClass));
+		});
+#endif
+	});
+
+	AfterEach([this]()
+	{
+		FGBATestsAttributeSetGenerator::Destroy(GeneratedClass);
+		GeneratedClass = nullptr;
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
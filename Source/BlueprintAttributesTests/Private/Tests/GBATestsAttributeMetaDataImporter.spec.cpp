@@ -0,0 +1,262 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBATestsAttributeMetaDataImporter.h"
+#include "GBATestsFixtureRegistry.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeMetaDataImporterSpec, "BlueprintAttributes.GBATestsAttributeMetaDataImporter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureClampAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Clamping.GBA_Test_Clamping_C");
+
+	FString TempFilename;
+
+	static UDataTable* CreateEmptyDataTable(const TCHAR* InName)
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage(), FName(InName));
+		DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+		return DataTable;
+	}
+
+	void TestSameRows(const UDataTable* InExpected, const UDataTable* InActual)
+	{
+		TestEqual(TEXT("Number of rows"), InActual->GetRowMap().Num(), InExpected->GetRowMap().Num());
+
+		for (const TPair<FName, uint8*>& Pair : InExpected->GetRowMap())
+		{
+			const FAttributeMetaData* Expected = reinterpret_cast<const FAttributeMetaData*>(Pair.Value);
+			const FAttributeMetaData* Actual = InActual->FindRow<FAttributeMetaData>(Pair.Key, TEXT("GBATestsAttributeMetaDataImporterSpec"), false);
+			if (!Actual)
+			{
+				AddError(FString::Printf(TEXT("Missing row %s"), *Pair.Key.ToString()));
+				continue;
+			}
+
+			const FString RowName = Pair.Key.ToString();
+			TestEqual(*FString::Printf(TEXT("%s BaseValue"), *RowName), Actual->BaseValue, Expected->BaseValue, 0.f);
+			TestEqual(*FString::Printf(TEXT("%s MinValue"), *RowName), Actual->MinValue, Expected->MinValue, 0.f);
+			TestEqual(*FString::Printf(TEXT("%s MaxValue"), *RowName), Actual->MaxValue, Expected->MaxValue, 0.f);
+			TestEqual(*FString::Printf(TEXT("%s DerivedAttributeInfo"), *RowName), Actual->DerivedAttributeInfo, Expected->DerivedAttributeInfo);
+			TestTrue(*FString::Printf(TEXT("%s bCanStack"), *RowName), Actual->bCanStack == Expected->bCanStack);
+		}
+	}
+
+	void TestLines(const TCHAR* InWhat, const TArray<FGBATestsAttributeMetaDataImportError>& InReported, const TArray<int32>& InExpectedLines)
+	{
+		TArray<int32> Lines;
+		for (const FGBATestsAttributeMetaDataImportError& Reported : InReported)
+		{
+			AddInfo(FString::Printf(TEXT("%s: %s"), InWhat, *Reported.ToString()));
+			Lines.Add(Reported.Line);
+		}
+
+		TestTrue(FString::Printf(TEXT("%s reported on lines %s"), InWhat, *FString::JoinBy(InExpectedLines, TEXT(", "), [](const int32 InLine) { return LexToString(InLine); })), Lines == InExpectedLines);
+	}
+
+	void TestErrorLines(const FGBATestsAttributeMetaDataImporter& InImporter, const TArray<int32>& InExpectedLines)
+	{
+		TestLines(TEXT("Errors"), InImporter.GetResult().Errors, InExpectedLines);
+	}
+
+	void TestWarningLines(const FGBATestsAttributeMetaDataImporter& InImporter, const TArray<int32>& InExpectedLines)
+	{
+		TestLines(TEXT("Warnings"), InImporter.GetResult().Warnings, InExpectedLines);
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeMetaDataImporterSpec)
+
+void FGBATestsAttributeMetaDataImporterSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TempFilename = FPaths::AutomationTransientDir() / TEXT("BlueprintAttributesTests") / TEXT("AttributeMetaDataImporter.csv");
+	});
+
+	Describe(TEXT("ImportString()"), [this]()
+	{
+		It(TEXT("should import the same rows as UDataTable::CreateTableFromCSVString()"), [this]()
+		{
+			const FString Csv = TEXT(R"(
+				---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack
+				GBA_Test_Clamping.TestClampedAttributeOnInit_01,"100.000000","0.000000","0.000000","","False"
+				GBA_Test_Clamping.TestClampedAttributeOnInit_02,"2000.000000","-12.500000","0.100000","","True"
+				GBA_Test_Stats.Health,"0.05","1000","123456.789","Some info","False"
+				GBA_Test_Stats.Mana,"123456789012345678.0","-0.000001","0.333333333333333333","","false"
+			)");
+
+			UDataTable* Expected = CreateEmptyDataTable(TEXT("ExpectedDataTable"));
+			Expected->CreateTableFromCSVString(Csv);
+
+			UDataTable* Actual = CreateEmptyDataTable(TEXT("ActualDataTable"));
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestTrue(TEXT("Import succeeded"), Importer.ImportString(Csv, Actual));
+			TestEqual(TEXT("Number of rows"), Importer.GetResult().NumRows, 4);
+
+			TestSameRows(Expected, Actual);
+		});
+
+		It(TEXT("should unescape quoted cells, and handle CRLF line endings and BOM"), [this]()
+		{
+			const FString Csv = TEXT("\xFEFF---,BaseValue,DerivedAttributeInfo,bCanStack\r\nGBA_Test_Stats.Health,\"5\",\"Say \"\"hi\"\", twice\",\"TRUE\"\r\n");
+
+			TMap<FName, FAttributeMetaData> Rows;
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestTrue(TEXT("Import succeeded"), Importer.ImportString(Csv, [&Rows](const FName& InRowName, const FAttributeMetaData& InRow)
+			{
+				Rows.Add(InRowName, InRow);
+			}));
+
+			const FAttributeMetaData* Row = Rows.Find(TEXT("GBA_Test_Stats.Health"));
+			if (!TestNotNull(TEXT("Row"), Row))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("BaseValue"), Row->BaseValue, 5.f);
+			TestEqual(TEXT("DerivedAttributeInfo"), Row->DerivedAttributeInfo, TEXT("Say \"hi\", twice"));
+			TestTrue(TEXT("bCanStack"), Row->bCanStack);
+		});
+
+		It(TEXT("should report errors with line numbers and skip invalid rows"), [this]()
+		{
+			const FString Csv = TEXT(
+				"---,BaseValue,MinValue,MaxValue,Unknown\n"
+				"GBA_Test_Stats.Health,100,0,0,\n"
+				"GBA_Test_Stats.Mana,abc,0,0,\n"
+				"\n"
+				"NoSeparator,1,0,0,\n"
+				"GBA_Test_Stats.Stamina,1,0,0,,extra\n"
+				"GBA_Test_Stats.Health,50,0,0,\n"
+				"GBA_Test_Stats.Armor,\"unterminated,0,0,\n"
+			);
+
+			TMap<FName, FAttributeMetaData> Rows;
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestFalse(TEXT("Import failed"), Importer.ImportString(Csv, [&Rows](const FName& InRowName, const FAttributeMetaData& InRow)
+			{
+				Rows.Add(InRowName, InRow);
+			}));
+
+			// Invalid number, bad row name, too many cells, unterminated quote
+			TestErrorLines(Importer, { 3, 5, 6, 8 });
+			// Unknown column, duplicate row
+			TestWarningLines(Importer, { 1, 7 });
+			TestEqual(TEXT("Number of rows"), Importer.GetResult().NumRows, 2);
+			TestEqual(TEXT("Duplicate row overrides the previous one"), Rows.FindRef(TEXT("GBA_Test_Stats.Health")).BaseValue, 50.f);
+		});
+
+		It(TEXT("should succeed with warnings only"), [this]()
+		{
+			const FString Csv = TEXT(
+				"---,BaseValue,Unknown,BaseValue\n"
+				"GBA_Test_Stats.Health,100,,\n"
+				"GBA_Test_Stats.Health,50,,\n"
+			);
+
+			TMap<FName, FAttributeMetaData> Rows;
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestTrue(TEXT("Import succeeded"), Importer.ImportString(Csv, [&Rows](const FName& InRowName, const FAttributeMetaData& InRow)
+			{
+				Rows.Add(InRowName, InRow);
+			}));
+
+			// Unknown column, duplicate column, duplicate row
+			TestErrorLines(Importer, {});
+			TestWarningLines(Importer, { 1, 1, 3 });
+			TestEqual(TEXT("Duplicate row overrides the previous one"), Rows.FindRef(TEXT("GBA_Test_Stats.Health")).BaseValue, 50.f);
+		});
+
+		It(TEXT("should count lines spanned by multiline quoted cells"), [this]()
+		{
+			const FString Csv = TEXT(
+				"---,BaseValue,DerivedAttributeInfo\n"
+				"GBA_Test_Stats.Health,1,\"first\nsecond\"\n"
+				"GBA_Test_Stats.Mana,nope,\n"
+			);
+
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			Importer.ImportString(Csv, [](const FName&, const FAttributeMetaData&) {});
+			TestErrorLines(Importer, { 4 });
+		});
+
+		It(TEXT("should validate row names against loaded attribute sets"), [this]()
+		{
+			if (!FGBATestsFixtureRegistry::Get().GetClass(FixtureClampAttributeSetLoadPath, UAttributeSet::StaticClass()))
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), FixtureClampAttributeSetLoadPath));
+				return;
+			}
+
+			FGBATestsAttributeMetaDataImporter Importer;
+			Importer.AddLoadedAttributeSets();
+			TestTrue(TEXT("Has known attributes"), Importer.GetNumKnownAttributes() > 0);
+
+			const FString Csv = TEXT(
+				"---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack\n"
+				"GBA_Test_Clamping.TestClampedAttributeOnInit_02,\"2000.000000\",\"0.000000\",\"0.000000\",\"\",\"False\"\n"
+				"GBA_Test_Clamping.DoesNotExist,\"1.000000\",\"0.000000\",\"0.000000\",\"\",\"False\"\n"
+				"GBA_Does_Not_Exist.TestClampedAttributeOnInit_02,\"1.000000\",\"0.000000\",\"0.000000\",\"\",\"False\"\n"
+			);
+
+			UDataTable* DataTable = CreateEmptyDataTable(TEXT("ValidatedDataTable"));
+			TestFalse(TEXT("Import failed"), Importer.ImportString(Csv, DataTable));
+			TestErrorLines(Importer, { 3, 4 });
+			TestEqual(TEXT("Number of rows"), DataTable->GetRowMap().Num(), 1);
+			TestNotNull(TEXT("Valid row"), DataTable->FindRow<FAttributeMetaData>(TEXT("GBA_Test_Clamping.TestClampedAttributeOnInit_02"), TEXT(""), false));
+		});
+	});
+
+	Describe(TEXT("ImportFile()"), [this]()
+	{
+		It(TEXT("should stream files larger than a chunk, with lines straddling chunks"), [this]()
+		{
+			// Second row is longer than a chunk on its own, and forces the read buffer to grow
+			const FString LongInfo = FString::ChrN(FGBATestsAttributeMetaDataImporter::ChunkSize + 17, TEXT('x'));
+
+			FString Csv = TEXT("---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack\n");
+			Csv += FString::Printf(TEXT("GBA_Test_Stats.Long,\"1.5\",\"0\",\"0\",\"%s\",\"False\"\n"), *LongInfo);
+			for (int32 Index = 0; Index < 5000; ++Index)
+			{
+				Csv += FString::Printf(TEXT("GBA_Test_Stats.Attribute_%d,\"%d.250000\",\"0.000000\",\"%d.000000\",\"\",\"False\"\n"), Index, Index, Index * 2);
+			}
+
+			if (!FFileHelper::SaveStringToFile(Csv, *TempFilename, FFileHelper::EEncodingOptions::ForceUTF8))
+			{
+				AddError(FString::Printf(TEXT("Unable to write %s"), *TempFilename));
+				return;
+			}
+
+			UDataTable* Expected = CreateEmptyDataTable(TEXT("ExpectedDataTable"));
+			Expected->CreateTableFromCSVString(Csv);
+
+			UDataTable* Actual = CreateEmptyDataTable(TEXT("ActualDataTable"));
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestTrue(TEXT("Import succeeded"), Importer.ImportFile(TempFilename, Actual));
+			TestEqual(TEXT("Number of rows"), Importer.GetResult().NumRows, 5001);
+			TestEqual(TEXT("Number of lines"), Importer.GetResult().NumLines, 5002);
+
+			TestSameRows(Expected, Actual);
+		});
+
+		It(TEXT("should report missing files"), [this]()
+		{
+			FGBATestsAttributeMetaDataImporter Importer(false);
+			TestFalse(TEXT("Import failed"), Importer.ImportFile(TempFilename + TEXT(".missing"), [](const FName&, const FAttributeMetaData&) {}));
+			TestTrue(TEXT("Has errors"), Importer.GetResult().HasErrors());
+		});
+	});
+
+	AfterEach([this]()
+	{
+		IFileManager::Get().Delete(*TempFilename, false, true, true);
+	});
+}
@@ -0,0 +1,158 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBATestsAttributeMetaDataImporter.h"
+#include "GBATestsBaselineStore.h"
+#include "GBATestsBenchmark.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeMetaDataImporterBenchmarkSpec, "BlueprintAttributes.Perf.GBATestsAttributeMetaDataImporter", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	static constexpr int32 NumAttributesPerSet = 100;
+	static constexpr int32 NumWarmupPasses = 1;
+	static constexpr int32 NumPasses = 3;
+
+	/** Above that, UDataTable::CreateTableFromCSVString() takes minutes and several GB, only the importer is measured */
+	static constexpr int32 MaxNumRowsForDataTableCsv = 100000;
+
+	FString Filename;
+
+	/** Balance team style table: NumRows rows, spread over NumRows / 100 attribute sets */
+	bool Generate(const int32 InNumRows)
+	{
+		Filename = FPaths::AutomationTransientDir() / TEXT("BlueprintAttributesTests") / FString::Printf(TEXT("AttributeMetaData_%d.csv"), InNumRows);
+
+		FString Csv;
+		Csv.Reserve(InNumRows * 96);
+		Csv += TEXT("---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack\n");
+
+		for (int32 Index = 0; Index < InNumRows; ++Index)
+		{
+			Csv += FString::Printf(
+				TEXT("GBA_Generated_%d.Attribute_%d,\"%d.%06d\",\"0.000000\",\"%d.000000\",\"\",\"%s\"\n"),
+				Index / NumAttributesPerSet,
+				Index % NumAttributesPerSet,
+				Index % 5000,
+				static_cast<int32>((static_cast<int64>(Index) * 7919) % 1000000),
+				(Index % 5000) * 2,
+				Index % 2 ? TEXT("True") : TEXT("False")
+			);
+		}
+
+		return FFileHelper::SaveStringToFile(Csv, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	static void AddKnownAttributes(FGBATestsAttributeMetaDataImporter& InImporter, const int32 InNumRows)
+	{
+		for (int32 Index = 0; Index < InNumRows; ++Index)
+		{
+			InImporter.AddKnownAttribute(
+				FString::Printf(TEXT("GBA_Generated_%d"), Index / NumAttributesPerSet),
+				FString::Printf(TEXT("Attribute_%d"), Index % NumAttributesPerSet)
+			);
+		}
+	}
+
+	static UDataTable* CreateEmptyDataTable(const TCHAR* InName)
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage(), FName(InName));
+		DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+		return DataTable;
+	}
+
+	void Benchmark(const int32 InNumRows)
+	{
+		if (!Generate(InNumRows))
+		{
+			AddError(FString::Printf(TEXT("Unable to write %s"), *Filename));
+			return;
+		}
+
+		AddInfo(FString::Printf(TEXT("%d rows, %.1f MB"), InNumRows, IFileManager::Get().FileSize(*Filename) / (1024.0 * 1024.0)));
+
+		FGBATestsAttributeMetaDataImporter Importer;
+		AddKnownAttributes(Importer, InNumRows);
+
+		int32 NumImportedRows = 0;
+		const FGBATestsBenchmarkStats StreamStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, InNumRows, [this, &Importer, &NumImportedRows]()
+		{
+			NumImportedRows = 0;
+			Importer.ImportFile(Filename, [&NumImportedRows](const FName&, const FAttributeMetaData&)
+			{
+				++NumImportedRows;
+			});
+		});
+
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributeMetaDataImporter::ImportFile (validated, rows only): %s"), *StreamStats.ToString()));
+		FGBATestsBaselineStore::Get().Check(*this, FString::Printf(TEXT("ImportFile.Rows.%d"), InNumRows), StreamStats);
+		TestEqual(TEXT("Imported rows"), NumImportedRows, InNumRows);
+		TestFalse(TEXT("No import errors"), Importer.GetResult().HasErrors());
+
+		UDataTable* StreamedDataTable = CreateEmptyDataTable(TEXT("StreamedDataTable"));
+		const FGBATestsBenchmarkStats StreamDataTableStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, InNumRows, [this, &Importer, StreamedDataTable]()
+		{
+			Importer.ImportFile(Filename, StreamedDataTable);
+		});
+
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributeMetaDataImporter::ImportFile (validated, into DataTable): %s"), *StreamDataTableStats.ToString()));
+		FGBATestsBaselineStore::Get().Check(*this, FString::Printf(TEXT("ImportFile.DataTable.%d"), InNumRows), StreamDataTableStats);
+		TestEqual(TEXT("DataTable rows"), StreamedDataTable->GetRowMap().Num(), InNumRows);
+
+		if (InNumRows <= MaxNumRowsForDataTableCsv)
+		{
+			UDataTable* CsvDataTable = CreateEmptyDataTable(TEXT("CsvDataTable"));
+			const FGBATestsBenchmarkStats CsvStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, InNumRows, [this, CsvDataTable]()
+			{
+				FString Csv;
+				FFileHelper::LoadFileToString(Csv, *Filename);
+				CsvDataTable->CreateTableFromCSVString(Csv);
+			});
+
+			AddInfo(FString::Printf(TEXT("UDataTable::CreateTableFromCSVString (not validated): %s"), *CsvStats.ToString()));
+			AddInfo(FString::Printf(TEXT("Median speedup (into DataTable): %.2fx"), StreamDataTableStats.Median > 0.0 ? CsvStats.Median / StreamDataTableStats.Median : 0.0));
+			TestEqual(TEXT("Both import the same number of rows"), StreamedDataTable->GetRowMap().Num(), CsvDataTable->GetRowMap().Num());
+			if (StreamDataTableStats.Median > CsvStats.Median)
+			{
+				// Timing only, reported rather than asserted as it depends on the machine load
+				AddInfo(TEXT("Importer median is slower than UDataTable::CreateTableFromCSVString()"));
+			}
+
+			CsvDataTable->EmptyTable();
+		}
+
+		StreamedDataTable->EmptyTable();
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeMetaDataImporterBenchmarkSpec)
+
+void FGBATestsAttributeMetaDataImporterBenchmarkSpec::Define()
+{
+	It(TEXT("imports 10k rows"), [this]()
+	{
+		Benchmark(10000);
+	});
+
+	It(TEXT("imports 100k rows"), [this]()
+	{
+		Benchmark(100000);
+	});
+
+	It(TEXT("imports 1M rows"), [this]()
+	{
+		Benchmark(1000000);
+	});
+
+	AfterEach([this]()
+	{
+		IFileManager::Get().Delete(*Filename, false, true, true);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
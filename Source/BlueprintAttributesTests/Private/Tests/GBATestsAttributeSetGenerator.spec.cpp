@@ -0,0 +1,123 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "GameplayEffect.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Engine/DataTable.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+#include "Utils/GBAUtils.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeSetGeneratorSpec, "BlueprintAttributes.GBATestsAttributeSetGenerator", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumAttributes = 500;
+	static constexpr int32 NumModifiers = 20;
+
+	FGBATestsAttributeSetGeneratorParams Params;
+	FGBATestsGeneratedAttributeSet Generated;
+
+END_DEFINE_SPEC(FGBATestsAttributeSetGeneratorSpec)
+
+void FGBATestsAttributeSetGeneratorSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Params = FGBATestsAttributeSetGeneratorParams();
+		Params.NumAttributes = NumAttributes;
+		Params.ClampedRatio = 0.5f;
+		Params.DataTableClampedRatio = 0.25f;
+		Params.BaseValue = 42.f;
+		Params.NumModifiers = NumModifiers;
+		Params.ModifierMagnitude = -5.f;
+
+		Generated = FGBATestsAttributeSetGenerator::Generate(TEXT("GBA_Test_Generated"), Params);
+	});
+
+	Describe(TEXT("Generate()"), [this]()
+	{
+		It(TEXT("should create a valid Blueprint attribute set class with the requested attributes"), [this]()
+		{
+			if (!TestNotNull(TEXT("Class"), Generated.Class))
+			{
+				return;
+			}
+
+			TestTrue(TEXT("Blueprint attribute set"), Generated.Class->IsChildOf(UGBAAttributeSetBlueprintBase::StaticClass()));
+			TestTrue(TEXT("Valid attribute class"), FGBAUtils::IsValidAttributeClass(Generated.Class));
+			TestEqual(TEXT("Set name"), FGBAUtils::GetAttributeClassName(Generated.Class), TEXT("GBA_Test_Generated"));
+
+			int32 NumValid = 0;
+			int32 NumClamped = 0;
+			for (TFieldIterator<FStructProperty> It(Generated.Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				NumValid += FGBAUtils::IsValidProperty(*It) ? 1 : 0;
+				NumClamped += It->Struct->IsChildOf(FGBAGameplayClampedAttributeData::StaticStruct()) ? 1 : 0;
+			}
+
+			TestEqual(TEXT("Valid attributes"), NumValid, NumAttributes);
+			TestEqual(TEXT("Clamped attributes"), NumClamped, NumAttributes / 2);
+			TestNotNull(TEXT("First attribute"), FindFProperty<FProperty>(Generated.Class, FGBATestsAttributeSetGenerator::GetAttributeName(0)));
+			TestNotNull(TEXT("Last attribute"), FindFProperty<FProperty>(Generated.Class, FGBATestsAttributeSetGenerator::GetAttributeName(NumAttributes - 1)));
+		});
+
+		It(TEXT("should create a matching meta data DataTable"), [this]()
+		{
+			if (!TestNotNull(TEXT("DataTable"), Generated.DataTable))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("Rows"), Generated.DataTable->GetRowMap().Num(), NumAttributes);
+
+			int32 NumClampedRows = 0;
+			Generated.DataTable->ForeachRow<FAttributeMetaData>(TEXT(""), [&NumClampedRows](const FName&, const FAttributeMetaData& InRow)
+			{
+				NumClampedRows += InRow.MaxValue != 0.f ? 1 : 0;
+			});
+			TestEqual(TEXT("Rows with a clamping range"), NumClampedRows, NumAttributes / 4);
+
+			// Initializes as UAbilitySystemComponent::InitStats() would
+			UGBAAttributeSetBlueprintBase* AttributeSet = NewObject<UGBAAttributeSetBlueprintBase>(GetTransientPackage(), Generated.Class);
+			AttributeSet->InitFromMetaDataTable(Generated.DataTable);
+
+			bool bFound = false;
+			const FGameplayAttribute Attribute(FindFProperty<FProperty>(Generated.Class, FGBATestsAttributeSetGenerator::GetAttributeName(NumAttributes - 1)));
+			TestEqual(TEXT("Initialized from DataTable"), AttributeSet->GetAttributeValue(Attribute, bFound), 42.f);
+			TestTrue(TEXT("Attribute found"), bFound);
+		});
+
+		It(TEXT("should create a Gameplay Effect with modifiers on generated attributes"), [this]()
+		{
+			if (!TestNotNull(TEXT("Effect"), Generated.Effect))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("Modifiers"), Generated.Effect->Modifiers.Num(), NumModifiers);
+			for (const FGameplayModifierInfo& Modifier : Generated.Effect->Modifiers)
+			{
+				TestTrue(FString::Printf(TEXT("%s belongs to the generated class"), *Modifier.Attribute.GetName()), Modifier.Attribute.GetAttributeSetClass() == Generated.Class);
+			}
+		});
+
+		It(TEXT("should not collide with a class of the same name pending GC"), [this]()
+		{
+			const UClass* OtherClass = FGBATestsAttributeSetGenerator::CreateAttributeSetClass(TEXT("GBA_Test_Generated"), Params);
+			TestTrue(TEXT("New class"), OtherClass && OtherClass != Generated.Class);
+			FGBATestsAttributeSetGenerator::Destroy(const_cast<UClass*>(OtherClass));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		FGBATestsAttributeSetGenerator::Destroy(Generated.Class);
+		Generated = FGBATestsGeneratedAttributeSet();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
@@ -0,0 +1,144 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBATestsAttributeClassInfo.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "GBATestsBaselineStore.h"
+#include "GBATestsBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+#include "Utils/GBAUtils.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+/**
+ * Startup cost of large Blueprint attribute sets: class declaration (as loading does), link, CDO creation and
+ * attribute validation, against what the first instance pays for class level meta data (FGBATestsAttributeClassInfo).
+ *
+ * Each pass generates a new class, as every step only happens once per class.
+ */
+BEGIN_DEFINE_SPEC(FGBATestsAttributeSetStartupBenchmarkSpec, "BlueprintAttributes.Perf.GBAAttributeSetStartup", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	static constexpr int32 NumPasses = 5;
+	static constexpr float ClampedRatio = 0.25f;
+
+	enum class EStep : uint8
+	{
+		Declare,
+		Link,
+		DefaultObject,
+		Validate,
+		FirstInstance,
+		NextInstance,
+		Num
+	};
+
+	static constexpr const TCHAR* StepNames[] = { TEXT("Declare"), TEXT("Link"), TEXT("DefaultObject"), TEXT("Validate"), TEXT("FirstInstance"), TEXT("NextInstance") };
+
+	TArray<UObject*> GeneratedObjects;
+
+	static double Time(const TFunctionRef<void()> InStep)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		InStep();
+		return FGBATestsBenchmark::CyclesToNanoseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	void Benchmark(const int32 InNumAttributes)
+	{
+		FGBATestsAttributeSetGeneratorParams Params;
+		Params.NumAttributes = InNumAttributes;
+		Params.ClampedRatio = ClampedRatio;
+
+		TArray<TArray<double>> Samples;
+		Samples.SetNum(static_cast<int32>(EStep::Num));
+		TArray<double> StartupSamples;
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			UClass* Class = nullptr;
+			Samples[static_cast<int32>(EStep::Declare)].Add(Time([&Class, &Params, Pass]()
+			{
+				Class = FGBATestsAttributeSetGenerator::DeclareAttributeSetClass(FString::Printf(TEXT("GBA_Test_Startup_%d_%d"), Params.NumAttributes, Pass), Params);
+			}));
+			GeneratedObjects.Add(Class);
+
+			Samples[static_cast<int32>(EStep::Link)].Add(Time([Class]()
+			{
+				FGBATestsAttributeSetGenerator::LinkAttributeSetClass(Class);
+			}));
+
+			Samples[static_cast<int32>(EStep::DefaultObject)].Add(Time([Class]()
+			{
+				Class->GetDefaultObject();
+			}));
+
+			int32 NumValidProperties = 0;
+			Samples[static_cast<int32>(EStep::Validate)].Add(Time([Class, &NumValidProperties]()
+			{
+				if (FGBAUtils::IsValidAttributeClass(Class))
+				{
+					for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+					{
+						NumValidProperties += FGBAUtils::IsValidProperty(*It) ? 1 : 0;
+					}
+				}
+			}));
+
+			TestEqual(TEXT("Valid attributes"), NumValidProperties, InNumAttributes);
+			TestNull(TEXT("Class meta data isn't built on load"), FGBATestsAttributeClassInfo::Find(Class));
+
+			// What UGBATestsBakedAttributeInit::InitAttributeSet() does for every instance
+			auto Instantiate = [Class]()
+			{
+				const UAttributeSet* AttributeSet = NewObject<UAttributeSet>(GetTransientPackage(), Class);
+				FGBATestsAttributeClassInfo::FindOrAdd(AttributeSet->GetClass());
+			};
+
+			Samples[static_cast<int32>(EStep::FirstInstance)].Add(Time(Instantiate));
+			Samples[static_cast<int32>(EStep::NextInstance)].Add(Time(Instantiate));
+
+			TestNotNull(TEXT("Class meta data is built on first instance"), FGBATestsAttributeClassInfo::Find(Class));
+
+			double StartupNanoseconds = 0.0;
+			for (const EStep Step : { EStep::Declare, EStep::Link, EStep::DefaultObject, EStep::Validate })
+			{
+				StartupNanoseconds += Samples[static_cast<int32>(Step)].Last();
+			}
+			StartupSamples.Add(StartupNanoseconds);
+		}
+
+		for (int32 Step = 0; Step < static_cast<int32>(EStep::Num); ++Step)
+		{
+			AddInfo(FString::Printf(TEXT("%d attributes, %s: %s"), InNumAttributes, StepNames[Step], *FGBATestsBenchmarkStats::Compute(Samples[Step]).ToString()));
+		}
+
+		const FGBATestsBenchmarkStats StartupStats = FGBATestsBenchmarkStats::Compute(StartupSamples);
+		AddInfo(FString::Printf(TEXT("%d attributes, class startup (declare to validate): %s"), InNumAttributes, *StartupStats.ToString()));
+		FGBATestsBaselineStore::Get().Check(*this, FString::Printf(TEXT("Startup.%d"), InNumAttributes), StartupStats);
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeSetStartupBenchmarkSpec)
+
+void FGBATestsAttributeSetStartupBenchmarkSpec::Define()
+{
+	for (const int32 NumAttributes : { 100, 500, 1000, 2000 })
+	{
+		It(FString::Printf(TEXT("loads, links and instantiates a set of %d attributes"), NumAttributes), [this, NumAttributes]()
+		{
+			Benchmark(NumAttributes);
+		});
+	}
+
+	AfterEach([this]()
+	{
+		for (UObject* Object : GeneratedObjects)
+		{
+			FGBATestsAttributeSetGenerator::Destroy(Object);
+		}
+		GeneratedObjects.Reset();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
@@ -0,0 +1,128 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsBaselineStore.h"
+#include "GBATestsBenchmark.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsBaselineStoreSpec, "BlueprintAttributes.GBATestsBaselineStore", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* SpecName = TEXT("BlueprintAttributes.Perf.Some");
+	static constexpr const TCHAR* MetricName = TEXT("Some.Metric");
+
+	FString Filename;
+
+	static FGBATestsBenchmarkStats MakeStats(const double InMedian, const double InP99)
+	{
+		FGBATestsBenchmarkStats Stats;
+		Stats.NumSamples = 1;
+		Stats.Median = InMedian;
+		Stats.P99 = InP99;
+		return Stats;
+	}
+
+	TUniquePtr<FGBATestsBaselineStore> MakeStore() const
+	{
+		return MakeUnique<FGBATestsBaselineStore>(Filename, TEXT("TestProfile"));
+	}
+
+	EGBATestsBaselineResult Compare(const FGBATestsBaselineStore& InStore, const double InMedian, const double InP99)
+	{
+		FString Message;
+		const EGBATestsBaselineResult Result = InStore.Compare(SpecName, MetricName, MakeStats(InMedian, InP99), Message);
+		AddInfo(Message);
+		return Result;
+	}
+
+END_DEFINE_SPEC(FGBATestsBaselineStoreSpec)
+
+void FGBATestsBaselineStoreSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Filename = FPaths::AutomationTransientDir() / TEXT("BlueprintAttributesTests") / TEXT("Baselines") / TEXT("TestProfile.json");
+		IFileManager::Get().Delete(*Filename, false, true, true);
+	});
+
+	It(TEXT("should report missing baselines"), [this]()
+	{
+		const TUniquePtr<FGBATestsBaselineStore> Store = MakeStore();
+		TestFalse(TEXT("Load without file"), Store->Load());
+		TestTrue(TEXT("Missing"), Compare(*Store, 100.0, 200.0) == EGBATestsBaselineResult::Missing);
+	});
+
+	It(TEXT("should round trip baselines through JSON"), [this]()
+	{
+		const TUniquePtr<FGBATestsBaselineStore> Store = MakeStore();
+		Store->Set(SpecName, MetricName, MakeStats(100.0, 200.0));
+		TestTrue(TEXT("Save"), Store->Save());
+
+		const TUniquePtr<FGBATestsBaselineStore> Loaded = MakeStore();
+		TestTrue(TEXT("Load"), Loaded->Load());
+
+		const FGBATestsBaselineMetric* Baseline = Loaded->Find(SpecName, MetricName);
+		if (!TestNotNull(TEXT("Baseline"), Baseline))
+		{
+			return;
+		}
+
+		TestEqual(TEXT("Median"), Baseline->Median, 100.0);
+		TestEqual(TEXT("P99"), Baseline->P99, 200.0);
+		TestNull(TEXT("Other spec"), Loaded->Find(TEXT("BlueprintAttributes.Perf.Other"), MetricName));
+	});
+
+	It(TEXT("should pass within tolerance and fail beyond it"), [this]()
+	{
+		const TUniquePtr<FGBATestsBaselineStore> Store = MakeStore();
+		Store->Tolerance.Median = 0.2;
+		Store->Tolerance.P99 = 0.5;
+		Store->Set(SpecName, MetricName, MakeStats(100.0, 200.0));
+
+		TestTrue(TEXT("Faster"), Compare(*Store, 50.0, 100.0) == EGBATestsBaselineResult::Passed);
+		TestTrue(TEXT("Median within tolerance"), Compare(*Store, 119.0, 200.0) == EGBATestsBaselineResult::Passed);
+		TestTrue(TEXT("Median beyond tolerance"), Compare(*Store, 121.0, 200.0) == EGBATestsBaselineResult::Regressed);
+		TestTrue(TEXT("P99 within tolerance"), Compare(*Store, 100.0, 299.0) == EGBATestsBaselineResult::Passed);
+		TestTrue(TEXT("P99 beyond tolerance"), Compare(*Store, 100.0, 301.0) == EGBATestsBaselineResult::Regressed);
+	});
+
+	It(TEXT("should ignore files with another version"), [this]()
+	{
+		const FString Json = FString::Printf(
+			TEXT("{\"Version\": %d, \"Specs\": {\"%s\": {\"%s\": {\"Median\": 100, \"P99\": 200}}}}"),
+			FGBATestsBaselineStore::Version + 1,
+			SpecName,
+			MetricName
+		);
+		FFileHelper::SaveStringToFile(Json, *Filename);
+
+		const TUniquePtr<FGBATestsBaselineStore> Store = MakeStore();
+		AddExpectedError(TEXT("expected"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("Load"), Store->Load());
+		TestNull(TEXT("Baseline"), Store->Find(SpecName, MetricName));
+	});
+
+	It(TEXT("should only record baselines when updates are opted in"), [this]()
+	{
+		const TUniquePtr<FGBATestsBaselineStore> Store = MakeStore();
+		Store->Check(*this, MetricName, MakeStats(100.0, 200.0));
+		TestNull(TEXT("Not recorded"), Store->Find(GetTestFullName(), MetricName));
+		TestFalse(TEXT("Not saved"), IFileManager::Get().FileExists(*Filename));
+
+		Store->bUpdate = true;
+		TestTrue(TEXT("Updated"), Store->Check(*this, MetricName, MakeStats(100.0, 200.0)) == EGBATestsBaselineResult::Updated);
+		TestNotNull(TEXT("Recorded"), Store->Find(GetTestFullName(), MetricName));
+		TestTrue(TEXT("Saved"), IFileManager::Get().FileExists(*Filename));
+	});
+
+	AfterEach([this]()
+	{
+		IFileManager::Get().Delete(*Filename, false, true, true);
+	});
+}
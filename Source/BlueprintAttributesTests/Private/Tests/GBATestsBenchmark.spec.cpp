@@ -0,0 +1,80 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsBenchmarkSpec, "BlueprintAttributes.GBATestsBenchmark", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+END_DEFINE_SPEC(FGBATestsBenchmarkSpec)
+
+void FGBATestsBenchmarkSpec::Define()
+{
+	Describe(TEXT("RunAdaptive()"), [this]()
+	{
+		It(TEXT("should calibrate operations per sample to the minimum sample duration"), [this]()
+		{
+			FGBATestsBenchmarkParams Params;
+			Params.NumWarmupSamples = 0;
+			Params.NumSamples = 5;
+			Params.MinSampleNanoseconds = 50000.0;
+			Params.bCountAllocations = false;
+
+			int64 NumOps = 0;
+			const FGBATestsBenchmarkResult Result = FGBATestsBenchmark::RunAdaptive(Params, [&NumOps]()
+			{
+				++NumOps;
+				FGBATestsBenchmark::DoNotOptimize(NumOps);
+			});
+
+			TestEqual(TEXT("Samples"), Result.Stats.NumSamples, Params.NumSamples);
+			TestTrue(TEXT("Several operations per sample"), Result.OpsPerSample > 1);
+			TestTrue(TEXT("Sample duration"), Result.Stats.Median * Result.OpsPerSample >= Params.MinSampleNanoseconds * 0.5);
+			TestTrue(TEXT("Timed operations"), NumOps >= static_cast<int64>(Result.OpsPerSample) * Params.NumSamples);
+			TestTrue(TEXT("Allocations not counted"), Result.AllocsPerOp < 0.0);
+		});
+
+		It(TEXT("should cap operations per sample"), [this]()
+		{
+			FGBATestsBenchmarkParams Params;
+			Params.NumSamples = 3;
+			Params.MinSampleNanoseconds = 1e12;
+			Params.MaxOpsPerSample = 64;
+			Params.bCountAllocations = false;
+
+			const FGBATestsBenchmarkResult Result = FGBATestsBenchmark::RunAdaptive(Params, []()
+			{
+				FGBATestsBenchmark::DoNotOptimize(FPlatformTime::Cycles64());
+			});
+
+			TestEqual(TEXT("Operations per sample"), Result.OpsPerSample, Params.MaxOpsPerSample);
+		});
+
+		It(TEXT("should count allocations per operation"), [this]()
+		{
+			if (!FGBATestsScopedAllocationCounter::IsSupported())
+			{
+				AddInfo(TEXT("Allocations can't be observed on this platform"));
+				return;
+			}
+
+			FGBATestsBenchmarkParams Params;
+			Params.NumSamples = 3;
+			Params.MinSampleNanoseconds = 10000.0;
+
+			const FGBATestsBenchmarkResult Result = FGBATestsBenchmark::RunAdaptive(Params, []()
+			{
+				void* Allocation = FMemory::Malloc(64);
+				FGBATestsBenchmark::DoNotOptimize(Allocation);
+				FMemory::Free(Allocation);
+			});
+
+			TestEqual(TEXT("Allocations per operation"), Result.AllocsPerOp, 1.0);
+			TestEqual(TEXT("Bytes per operation"), Result.BytesPerOp, 64.0);
+		});
+	});
+}
@@ -0,0 +1,252 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemTestAttributeSet.h"
+#include "GBATestsEventRecorder.h"
+#include "GBATestsStorageSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsEventRecorderSpec, "BlueprintAttributes.GBATestsEventRecorder", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	FGBATestsEventRecorder Recorder;
+	FGameplayAttribute HealthAttribute;
+	FGameplayAttribute ManaAttribute;
+
+	static FGBATestStorage_PostAttributeChangePayload MakePostAttributeChange(const FGameplayAttribute& InAttribute, const float InOldValue, const float InNewValue)
+	{
+		FGBATestStorage_PostAttributeChangePayload Payload;
+		Payload.Attribute = InAttribute;
+		Payload.OldValue = InOldValue;
+		Payload.NewValue = InNewValue;
+		return Payload;
+	}
+
+	static FGBATestStorage_PreAttributeChangePayload MakePreAttributeChange(const FGameplayAttribute& InAttribute, const float InValue)
+	{
+		FGBATestStorage_PreAttributeChangePayload Payload;
+		Payload.Attribute = InAttribute;
+		Payload.Value = InValue;
+		return Payload;
+	}
+
+	/** Kinds of every event visited with InFilter, in order */
+	TArray<EGBATestsEventKind> GetKinds(const FGBATestsEventFilter& InFilter = FGBATestsEventFilter()) const
+	{
+		TArray<EGBATestsEventKind> Kinds;
+		Recorder.ForEachEvent(InFilter, [&Kinds](const EGBATestsEventKind InKind, const FGBATestsEventHeader&, const FTestStorageBlueprintData&)
+		{
+			Kinds.Add(InKind);
+			return true;
+		});
+		return Kinds;
+	}
+
+END_DEFINE_SPEC(FGBATestsEventRecorderSpec)
+
+void FGBATestsEventRecorderSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Recorder.Initialize(8);
+		HealthAttribute = FGameplayAttribute(FindFProperty<FProperty>(UAbilitySystemTestAttributeSet::StaticClass(), TEXT("Health")));
+		ManaAttribute = FGameplayAttribute(FindFProperty<FProperty>(UAbilitySystemTestAttributeSet::StaticClass(), TEXT("Mana")));
+	});
+
+	It(TEXT("should visit events of every kind in recording order"), [this]()
+	{
+		Recorder.Record(TEXT("PreAttributeChange_Health"), MakePreAttributeChange(HealthAttribute, 10.f));
+		Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+		Recorder.Record(TEXT("PreAttributeChange_Mana"), MakePreAttributeChange(ManaAttribute, 5.f));
+		Recorder.Record(TEXT("PostAttributeBaseChange_Mana"), FGBATestStorage_PostAttributeBaseChangePayload());
+
+		const TArray<EGBATestsEventKind> Expected = {
+			EGBATestsEventKind::PreAttributeChange,
+			EGBATestsEventKind::PostAttributeChange,
+			EGBATestsEventKind::PreAttributeChange,
+			EGBATestsEventKind::PostAttributeBaseChange
+		};
+		TestTrue(TEXT("Kinds in recording order"), GetKinds() == Expected);
+		TestEqual(TEXT("Num"), Recorder.Num(), 4);
+
+		uint64 LastSequence = 0;
+		bool bFirst = true;
+		bool bSorted = true;
+		Recorder.ForEachEvent(FGBATestsEventFilter(), [&LastSequence, &bFirst, &bSorted](EGBATestsEventKind, const FGBATestsEventHeader& InHeader, const FTestStorageBlueprintData&)
+		{
+			bSorted &= bFirst || InHeader.Sequence > LastSequence;
+			bFirst = false;
+			LastSequence = InHeader.Sequence;
+			return true;
+		});
+		TestTrue(TEXT("Sequences are increasing"), bSorted);
+	});
+
+	It(TEXT("should pass payloads in place"), [this]()
+	{
+		Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+
+		Recorder.ForEachEvent(FGBATestsEventFilter(), [this](const EGBATestsEventKind InKind, const FGBATestsEventHeader& InHeader, const FTestStorageBlueprintData& InPayload)
+		{
+			TestTrue(TEXT("Kind"), InKind == EGBATestsEventKind::PostAttributeChange);
+			TestTrue(TEXT("Key"), InHeader.Key == FName(TEXT("PostAttributeChange_Health")));
+			TestTrue(TEXT("Cycles"), InHeader.Cycles > 0);
+
+			const FGBATestStorage_PostAttributeChangePayload& Payload = static_cast<const FGBATestStorage_PostAttributeChangePayload&>(InPayload);
+			TestTrue(TEXT("Attribute"), Payload.Attribute == HealthAttribute);
+			TestEqual(TEXT("NewValue"), Payload.NewValue, 10.f);
+			return true;
+		});
+	});
+
+	It(TEXT("should find the last payload recorded with a key"), [this]()
+	{
+		Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+		Recorder.Record(TEXT("PostAttributeChange_Mana"), MakePostAttributeChange(ManaAttribute, 0.f, 5.f));
+		Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 10.f, 20.f));
+
+		FGBATestStorage_PostAttributeChangePayload Payload;
+		TestTrue(TEXT("Found Health"), Recorder.FindLast(TEXT("PostAttributeChange_Health"), Payload));
+		TestEqual(TEXT("Health OldValue"), Payload.OldValue, 10.f);
+		TestEqual(TEXT("Health NewValue"), Payload.NewValue, 20.f);
+
+		FGBATestStorage_PreAttributeChangePayload OtherKind;
+		TestFalse(TEXT("Keys are per kind"), Recorder.FindLast(TEXT("PostAttributeChange_Health"), OtherKind));
+	});
+
+	It(TEXT("should overwrite oldest events when full"), [this]()
+	{
+		TestEqual(TEXT("Capacity is rounded up to a power of two"), Recorder.GetRing<FGBATestStorage_PostAttributeChangePayload>().GetCapacity(), 8);
+
+		for (int32 Index = 0; Index < 11; ++Index)
+		{
+			Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, Index));
+		}
+
+		TestEqual(TEXT("Num"), Recorder.Num(), 8);
+		TestTrue(TEXT("Dropped"), Recorder.GetNumDropped() == 3);
+
+		TArray<float> Values;
+		Recorder.GetRing<FGBATestStorage_PostAttributeChangePayload>().ForEach([&Values](const TGBATestsEventRecord<FGBATestStorage_PostAttributeChangePayload>& InRecord)
+		{
+			Values.Add(InRecord.Payload.NewValue);
+			return true;
+		});
+
+		TestTrue(TEXT("Oldest to newest"), Values == TArray<float>({ 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f }));
+
+		Recorder.Reset();
+		TestEqual(TEXT("Num after reset"), Recorder.Num(), 0);
+		TestTrue(TEXT("Dropped after reset"), Recorder.GetNumDropped() == 0);
+	});
+
+	It(TEXT("should filter by kind and attribute"), [this]()
+	{
+		Recorder.Record(TEXT("PreAttributeChange_Health"), MakePreAttributeChange(HealthAttribute, 10.f));
+		Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+		Recorder.Record(TEXT("PreAttributeChange_Mana"), MakePreAttributeChange(ManaAttribute, 5.f));
+		Recorder.Record(TEXT("PostAttributeChange_Mana"), MakePostAttributeChange(ManaAttribute, 0.f, 5.f));
+
+		FGBATestsEventFilter PostFilter;
+		PostFilter.Kind(EGBATestsEventKind::PostAttributeChange);
+		TestEqual(TEXT("Post events"), Recorder.Num(PostFilter), 2);
+
+		FGBATestsEventFilter ManaFilter;
+		ManaFilter.Attribute = ManaAttribute;
+		TestTrue(TEXT("Mana events"), GetKinds(ManaFilter) == TArray<EGBATestsEventKind>({ EGBATestsEventKind::PreAttributeChange, EGBATestsEventKind::PostAttributeChange }));
+
+		FGBATestsEventFilter PostManaFilter = PostFilter;
+		PostManaFilter.Attribute = ManaAttribute;
+		TestEqual(TEXT("Post Mana events"), Recorder.Num(PostManaFilter), 1);
+
+		int32 NumVisited = 0;
+		Recorder.ForEachEvent(FGBATestsEventFilter(), [&NumVisited](EGBATestsEventKind, const FGBATestsEventHeader&, const FTestStorageBlueprintData&)
+		{
+			return ++NumVisited < 2;
+		});
+		TestEqual(TEXT("Visitor stops"), NumVisited, 2);
+	});
+
+	It(TEXT("should record from multiple threads"), [this]()
+	{
+		constexpr int32 NumEvents = 4000;
+		Recorder.Initialize(NumEvents);
+
+		ParallelFor(NumEvents, [this](const int32 Index)
+		{
+			if (Index % 2)
+			{
+				Recorder.Record(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, Index));
+			}
+			else
+			{
+				Recorder.Record(TEXT("PreAttributeChange_Mana"), MakePreAttributeChange(ManaAttribute, Index));
+			}
+		});
+
+		TestEqual(TEXT("Num"), Recorder.Num(), NumEvents);
+		TestTrue(TEXT("Nothing dropped"), Recorder.GetNumDropped() == 0);
+
+		TSet<uint64> Sequences;
+		uint64 LastSequence = 0;
+		bool bSorted = true;
+		Recorder.ForEachEvent(FGBATestsEventFilter(), [&Sequences, &LastSequence, &bSorted](EGBATestsEventKind, const FGBATestsEventHeader& InHeader, const FTestStorageBlueprintData&)
+		{
+			bSorted &= Sequences.IsEmpty() || InHeader.Sequence > LastSequence;
+			LastSequence = InHeader.Sequence;
+			Sequences.Add(InHeader.Sequence);
+			return true;
+		});
+
+		TestEqual(TEXT("Unique sequences"), Sequences.Num(), NumEvents);
+		TestTrue(TEXT("Merged in sequence order"), bSorted);
+	});
+
+	Describe(TEXT("UGBATestsStorageSubsystem"), [this]()
+	{
+		It(TEXT("should still return the last payload set with a key"), [this]()
+		{
+			UGBATestsStorageSubsystem& Storage = *GEngine->GetEngineSubsystem<UGBATestsStorageSubsystem>();
+			Storage.ResetStore();
+
+			Storage.SetPostAttributeChangePayload(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+			Storage.SetPostAttributeChangePayload(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 10.f, 30.f));
+
+			const FGBATestStorage_PostAttributeChangePayload Payload = Storage.GetValueAsPostAttributeChangePayload(TEXT("PostAttributeChange_Health"));
+			TestTrue(TEXT("Attribute"), Payload.Attribute == HealthAttribute);
+			TestEqual(TEXT("NewValue"), Payload.NewValue, 30.f);
+			TestEqual(TEXT("Both sets are recorded"), Storage.GetRecorder().Num(), 2);
+
+			const FGBATestStorage_PostAttributeChangePayload Missing = Storage.GetValueAsPostAttributeChangePayload(TEXT("PostAttributeChange_Mana"));
+			TestFalse(TEXT("Unknown key returns a default payload"), Missing.Attribute.IsValid());
+
+			Storage.ResetStore();
+			TestEqual(TEXT("Reset"), Storage.GetRecorder().Num(), 0);
+			TestFalse(TEXT("Reset keys"), Storage.GetValueAsPostAttributeChangePayload(TEXT("PostAttributeChange_Health")).Attribute.IsValid());
+		});
+
+		It(TEXT("should keep keys readable once their events are overwritten"), [this]()
+		{
+			UGBATestsStorageSubsystem& Storage = *GEngine->GetEngineSubsystem<UGBATestsStorageSubsystem>();
+			Storage.ResetStore();
+
+			Storage.SetPostAttributeChangePayload(TEXT("PostAttributeChange_Health"), MakePostAttributeChange(HealthAttribute, 0.f, 10.f));
+
+			const int32 Capacity = Storage.GetRecorder().GetRing<FGBATestStorage_PostAttributeChangePayload>().GetCapacity();
+			for (int32 Index = 0; Index < Capacity; ++Index)
+			{
+				Storage.SetPostAttributeChangePayload(TEXT("PostAttributeChange_Mana"), MakePostAttributeChange(ManaAttribute, 0.f, Index));
+			}
+
+			TestTrue(TEXT("Health event overwritten"), Storage.GetRecorder().GetNumDropped() > 0);
+			TestEqual(TEXT("NewValue"), Storage.GetValueAsPostAttributeChangePayload(TEXT("PostAttributeChange_Health")).NewValue, 10.f);
+
+			Storage.ResetStore();
+		});
+	});
+}
@@ -0,0 +1,108 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "GBATestsBenchmark.h"
+#include "GBATestsFixtureRegistry.h"
+#include "GameplayEffect.h"
+#include "Engine/DataTable.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsFixtureRegistrySpec, "BlueprintAttributes.GBATestsFixtureRegistry", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+	static constexpr const TCHAR* FixtureDataTableLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats");
+
+	static constexpr int32 NumLookupsPerPass = 1000;
+
+END_DEFINE_SPEC(FGBATestsFixtureRegistrySpec)
+
+void FGBATestsFixtureRegistrySpec::Define()
+{
+	Describe(TEXT("Preload()"), [this]()
+	{
+		It(TEXT("should preload every fixture asset"), [this]()
+		{
+			FGBATestsFixtureRegistry& Registry = FGBATestsFixtureRegistry::Get();
+			Registry.Preload();
+
+			TestTrue(TEXT("Is preloaded"), Registry.IsPreloaded());
+			TestTrue(TEXT("Preloaded fixtures"), Registry.GetStats().NumPreloaded > 0);
+			AddInfo(Registry.GetStats().ToString());
+		});
+	});
+
+	Describe(TEXT("GetClass()"), [this]()
+	{
+		It(TEXT("should return the same classes as StaticLoadClass()"), [this]()
+		{
+			const UClass* AttributeSetClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
+			TestNotNull(TEXT("Attribute set class"), AttributeSetClass);
+			TestTrue(TEXT("Same attribute set class"), AttributeSetClass == StaticLoadClass(UAttributeSet::StaticClass(), nullptr, FixtureAttributeSetLoadPath));
+
+			const UClass* EffectClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureEffectLoadPath, UGameplayEffect::StaticClass());
+			TestNotNull(TEXT("Effect class"), EffectClass);
+			TestTrue(TEXT("Same effect class"), EffectClass == StaticLoadClass(UGameplayEffect::StaticClass(), nullptr, FixtureEffectLoadPath));
+		});
+
+		It(TEXT("should return nullptr for classes not matching the base class"), [this]()
+		{
+			TestNull(TEXT("Attribute set as effect"), FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UGameplayEffect::StaticClass()));
+		});
+
+		It(TEXT("should count cached lookups"), [this]()
+		{
+			FGBATestsFixtureRegistry& Registry = FGBATestsFixtureRegistry::Get();
+			Registry.GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
+
+			const int32 NumHits = Registry.GetStats().NumHits;
+			const int32 NumLoaded = Registry.GetStats().NumLoaded;
+			Registry.GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
+
+			TestEqual(TEXT("Hits"), Registry.GetStats().NumHits, NumHits + 1);
+			TestEqual(TEXT("Loads"), Registry.GetStats().NumLoaded, NumLoaded);
+		});
+
+		It(TEXT("should report cached lookup times against StaticLoadClass()"), [this]()
+		{
+			FGBATestsFixtureRegistry& Registry = FGBATestsFixtureRegistry::Get();
+			const FString LoadPath = FixtureAttributeSetLoadPath;
+			Registry.GetClass(LoadPath, UAttributeSet::StaticClass());
+
+			const FGBATestsBenchmarkStats RegistryStats = FGBATestsBenchmark::Run(1, 10, NumLookupsPerPass, [&Registry, &LoadPath]()
+			{
+				for (int32 Index = 0; Index < NumLookupsPerPass; ++Index)
+				{
+					Registry.GetClass(LoadPath, UAttributeSet::StaticClass());
+				}
+			});
+
+			const FGBATestsBenchmarkStats StaticLoadStats = FGBATestsBenchmark::Run(1, 10, NumLookupsPerPass, [&LoadPath]()
+			{
+				for (int32 Index = 0; Index < NumLookupsPerPass; ++Index)
+				{
+					StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *LoadPath);
+				}
+			});
+
+			AddInfo(FString::Printf(TEXT("FGBATestsFixtureRegistry::GetClass: %s"), *RegistryStats.ToString()));
+			AddInfo(FString::Printf(TEXT("StaticLoadClass: %s"), *StaticLoadStats.ToString()));
+			AddInfo(FString::Printf(TEXT("Median speedup: %.2fx"), RegistryStats.Median > 0.0 ? StaticLoadStats.Median / RegistryStats.Median : 0.0));
+		});
+	});
+
+	Describe(TEXT("Get()"), [this]()
+	{
+		It(TEXT("should accept package names of single asset packages"), [this]()
+		{
+			const UDataTable* DataTable = FGBATestsFixtureRegistry::Get().Get<UDataTable>(FixtureDataTableLoadPath);
+			TestNotNull(TEXT("DataTable"), DataTable);
+			TestTrue(TEXT("Same DataTable"), DataTable == StaticLoadObject(UDataTable::StaticClass(), nullptr, FixtureDataTableLoadPath));
+		});
+	});
+}
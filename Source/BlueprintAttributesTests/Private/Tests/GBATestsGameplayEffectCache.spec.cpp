@@ -0,0 +1,83 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsGameplayEffectCache.h"
+#include "GBATestsNativeHealthSet.h"
+#include "GameplayEffect.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsGameplayEffectCacheSpec, "BlueprintAttributes.GBATestsGameplayEffectCache", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Not FGBATestsGameplayEffectCache::Get(), to start each test empty */
+	TUniquePtr<FGBATestsGameplayEffectCache> Cache;
+
+END_DEFINE_SPEC(FGBATestsGameplayEffectCacheSpec)
+
+void FGBATestsGameplayEffectCacheSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Cache = MakeUnique<FGBATestsGameplayEffectCache>();
+	});
+
+	Describe(TEXT("FindOrAdd()"), [this]()
+	{
+		It(TEXT("should share effects by modifier signature"), [this]()
+		{
+			const FGameplayAttribute Health = UGBATestsNativeHealthSet::GetHealthAttribute();
+
+			const UGameplayEffect* Damage = Cache->FindOrAdd({ Health, EGameplayModOp::Additive });
+			TestNotNull(TEXT("Effect"), Damage);
+			TestTrue(TEXT("Same signature"), Cache->FindOrAdd({ Health, EGameplayModOp::Additive }) == Damage);
+			TestEqual(TEXT("Cached effects"), Cache->Num(), 1);
+
+			TestTrue(TEXT("Other attribute"), Cache->FindOrAdd({ UGBATestsNativeHealthSet::GetMaxHealthAttribute(), EGameplayModOp::Additive }) != Damage);
+			TestTrue(TEXT("Other op"), Cache->FindOrAdd({ Health, EGameplayModOp::Override }) != Damage);
+			TestTrue(TEXT("Other duration policy"), Cache->FindOrAdd({ Health, EGameplayModOp::Additive, EGameplayEffectDurationType::Infinite }) != Damage);
+			TestTrue(
+				TEXT("Other period"),
+				Cache->FindOrAdd({ Health, EGameplayModOp::Additive, EGameplayEffectDurationType::Infinite, 1.f }) != Cache->FindOrAdd({ Health, EGameplayModOp::Additive, EGameplayEffectDurationType::Infinite })
+			);
+			TestEqual(TEXT("Cached effects"), Cache->Num(), 5);
+		});
+
+		It(TEXT("should build effects with set by caller magnitudes"), [this]()
+		{
+			FGBATestsGameplayEffectSignature Signature(UGBATestsNativeHealthSet::GetHealthAttribute(), EGameplayModOp::Additive, EGameplayEffectDurationType::Infinite, 2.f);
+			Signature.Modifiers.Add({ UGBATestsNativeHealthSet::GetMaxHealthAttribute(), EGameplayModOp::Multiplicitive });
+
+			const UGameplayEffect* Effect = Cache->FindOrAdd(Signature);
+			if (!TestNotNull(TEXT("Effect"), Effect))
+			{
+				return;
+			}
+
+			TestTrue(TEXT("Duration policy"), Effect->DurationPolicy == EGameplayEffectDurationType::Infinite);
+			TestEqual(TEXT("Period"), Effect->Period.Value, 2.f);
+			if (!TestEqual(TEXT("Modifiers"), Effect->Modifiers.Num(), 2))
+			{
+				return;
+			}
+
+			for (int32 Index = 0; Index < Effect->Modifiers.Num(); ++Index)
+			{
+				const FGameplayModifierInfo& Modifier = Effect->Modifiers[Index];
+				TestTrue(FString::Printf(TEXT("Modifier %d attribute"), Index), Modifier.Attribute == Signature.Modifiers[Index].Attribute);
+				TestTrue(FString::Printf(TEXT("Modifier %d op"), Index), Modifier.ModifierOp == Signature.Modifiers[Index].Op);
+				TestTrue(FString::Printf(TEXT("Modifier %d set by caller"), Index), Modifier.ModifierMagnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::SetByCaller);
+				TestTrue(FString::Printf(TEXT("Modifier %d magnitude name"), Index), Modifier.ModifierMagnitude.GetSetByCallerFloat().DataName == FGBATestsGameplayEffectCache::GetMagnitudeName(Index));
+			}
+
+			TestTrue(TEXT("Distinct magnitude names"), FGBATestsGameplayEffectCache::GetMagnitudeName(0) != FGBATestsGameplayEffectCache::GetMagnitudeName(1));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		Cache.Reset();
+	});
+}
@@ -0,0 +1,134 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsLatencyHistogram.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsLatencyHistogramSpec, "BlueprintAttributes.GBATestsLatencyHistogram", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Relative error guaranteed by the bucketing */
+	static constexpr double MaxRelativeError = 1.0 / FGBATestsLatencyHistogram::SubBucketHalfCount;
+
+	void TestPercentile(const FString& InWhat, const uint64 InActual, const uint64 InExpected)
+	{
+		const double Error = FMath::Abs(static_cast<double>(InActual) - static_cast<double>(InExpected)) / FMath::Max<double>(InExpected, 1.0);
+		TestTrue(FString::Printf(TEXT("%s: %llu within %.2f%% of %llu"), *InWhat, InActual, MaxRelativeError * 100.0, InExpected), Error <= MaxRelativeError);
+	}
+
+END_DEFINE_SPEC(FGBATestsLatencyHistogramSpec)
+
+void FGBATestsLatencyHistogramSpec::Define()
+{
+	Describe(TEXT("GetBucketIndex()"), [this]()
+	{
+		It(TEXT("should be monotonic and bucket values within their highest equivalent value"), [this]()
+		{
+			int32 LastIndex = 0;
+			for (uint64 Value = 1; Value < MAX_uint64 / 3; Value = Value * 3 / 2 + 1)
+			{
+				const int32 Index = FGBATestsLatencyHistogram::GetBucketIndex(Value);
+				if (!TestTrue(FString::Printf(TEXT("%llu bucket index %d in range"), Value, Index), Index >= LastIndex && Index < FGBATestsLatencyHistogram::NumBuckets))
+				{
+					return;
+				}
+
+				TestTrue(FString::Printf(TEXT("%llu <= highest equivalent value"), Value), Value <= FGBATestsLatencyHistogram::GetHighestEquivalentValue(Index));
+				LastIndex = Index;
+			}
+
+			TestTrue(TEXT("Largest value has a bucket"), FGBATestsLatencyHistogram::GetBucketIndex(MAX_uint64) == FGBATestsLatencyHistogram::NumBuckets - 1);
+			TestTrue(TEXT("Largest bucket doesn't overflow"), FGBATestsLatencyHistogram::GetHighestEquivalentValue(FGBATestsLatencyHistogram::NumBuckets - 1) == MAX_uint64);
+		});
+	});
+
+	Describe(TEXT("GetPercentile()"), [this]()
+	{
+		It(TEXT("should be exact for small values"), [this]()
+		{
+			FGBATestsLatencyHistogram Histogram;
+			for (uint64 Value = 1; Value <= 100; ++Value)
+			{
+				Histogram.Record(Value);
+			}
+
+			TestTrue(TEXT("P50"), Histogram.GetPercentile(50.0) == 50);
+			TestTrue(TEXT("P99"), Histogram.GetPercentile(99.0) == 99);
+			TestTrue(TEXT("P100"), Histogram.GetPercentile(100.0) == 100);
+			TestTrue(TEXT("Min"), Histogram.GetMin() == 1);
+			TestTrue(TEXT("Max"), Histogram.GetMax() == 100);
+			TestEqual(TEXT("Mean"), Histogram.GetMean(), 50.5);
+		});
+
+		It(TEXT("should stay within relative error for large values"), [this]()
+		{
+			FGBATestsLatencyHistogram Histogram;
+			for (uint64 Value = 1; Value <= 100000; ++Value)
+			{
+				Histogram.Record(Value * 1000);
+			}
+
+			TestPercentile(TEXT("P50"), Histogram.GetPercentile(50.0), 50000000);
+			TestPercentile(TEXT("P90"), Histogram.GetPercentile(90.0), 90000000);
+			TestPercentile(TEXT("P99"), Histogram.GetPercentile(99.0), 99000000);
+			TestPercentile(TEXT("P99.9"), Histogram.GetPercentile(99.9), 99900000);
+			TestTrue(TEXT("P100 is the recorded max"), Histogram.GetPercentile(100.0) == 100000000);
+		});
+
+		It(TEXT("should report tail latencies"), [this]()
+		{
+			FGBATestsLatencyHistogram Histogram;
+			for (int32 Index = 0; Index < 990; ++Index)
+			{
+				Histogram.Record(1000);
+			}
+			for (int32 Index = 0; Index < 10; ++Index)
+			{
+				Histogram.Record(1000000);
+			}
+
+			TestPercentile(TEXT("P99"), Histogram.GetPercentile(99.0), 1000);
+			TestPercentile(TEXT("P99.9"), Histogram.GetPercentile(99.9), 1000000);
+		});
+
+		It(TEXT("should be 0 when empty"), [this]()
+		{
+			const FGBATestsLatencyHistogram Histogram;
+			TestTrue(TEXT("P99"), Histogram.GetPercentile(99.0) == 0);
+			TestTrue(TEXT("Min"), Histogram.GetMin() == 0);
+			TestEqual(TEXT("Mean"), Histogram.GetMean(), 0.0);
+		});
+	});
+
+	Describe(TEXT("Add() and Reset()"), [this]()
+	{
+		It(TEXT("should merge and drop recorded values"), [this]()
+		{
+			FGBATestsLatencyHistogram Low;
+			FGBATestsLatencyHistogram High;
+			for (uint64 Value = 1; Value <= 50; ++Value)
+			{
+				Low.Record(Value);
+				High.Record(Value + 50);
+			}
+
+			FGBATestsLatencyHistogram Total;
+			Total.Add(Low);
+			Total.Add(High);
+			TestTrue(TEXT("Total count"), Total.GetTotalCount() == 100);
+			TestTrue(TEXT("Total P50"), Total.GetPercentile(50.0) == 50);
+			TestTrue(TEXT("Total Min"), Total.GetMin() == 1);
+			TestTrue(TEXT("Total Max"), Total.GetMax() == 100);
+
+			Total.Reset();
+			TestTrue(TEXT("Reset count"), Total.GetTotalCount() == 0);
+			TestTrue(TEXT("Reset Max"), Total.GetMax() == 0);
+
+			Total.Record(7);
+			TestTrue(TEXT("Recorded after reset"), Total.GetPercentile(50.0) == 7);
+		});
+	});
+}
@@ -0,0 +1,338 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBATestsAllocationCounter.h"
+#include "GBATestsAttributeDebugData.h"
+#include "GBATestsAttributeSetGenerator.h"
+#include "AttributeSet/GBAAttributeSetSpecBase.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+GBA_BEGIN_DEFINE_SPEC_WITH_BASE(FGBAAttributeDebugDataSpec, FGBAAttributeSetSpecBase, "BlueprintAttributes.GBAAttributeDebugData", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr const TCHAR* FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GBA_Test_Stats.GBA_Test_Stats_C");
+	static constexpr const TCHAR* FixtureGameplayEffectLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/GE_Test_Stats_Init.GE_Test_Stats_Init_C");
+
+	/** Returns the debug set collected for the fixture class, or nullptr */
+	const FGBATestsAttributeDebugSet* FindFixtureSet(const FGBATestsAttributeDebugData& InData) const
+	{
+		return InData.Sets.FindByPredicate([this](const FGBATestsAttributeDebugSet& Set)
+		{
+			return Set.Class.Get() == TestAttributeSetClass;
+		});
+	}
+
+	/** Returns the entry values for the given attribute name, or nullptr */
+	const FGBATestsAttributeDebugEntry* FindEntry(const FGBATestsAttributeDebugData& InData, const FString& InAttributeName) const
+	{
+		const FGBATestsAttributeDebugSet* Set = FindFixtureSet(InData);
+		if (!Set)
+		{
+			return nullptr;
+		}
+
+		for (int32 Index = 0; Index < Set->NumEntries; ++Index)
+		{
+			const FString* Name = InData.GetAttributeName(*Set, Index);
+			if (Name && *Name == InAttributeName)
+			{
+				return &InData.Entries[Set->FirstEntry + Index];
+			}
+		}
+
+		return nullptr;
+	}
+
+GBA_END_DEFINE_SPEC(FGBAAttributeDebugDataSpec)
+
+void FGBAAttributeDebugDataSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		// Setup tests
+		AcquireWorld();
+
+		UClass* ActorClass = LoadFixtureClass(UObject::StaticClass(), FixtureCharacterLoadPath);
+		if (!IsValid(ActorClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureCharacterLoadPath));
+			return;
+		}
+
+		TestActor = Cast<ACharacter>(World->SpawnActor(ActorClass, nullptr, nullptr, FActorSpawnParameters()));
+		if (!TestActor)
+		{
+			AddError(FString::Printf(TEXT("Unable to setup test actor from %s"), *GetNameSafe(ActorClass)));
+			return;
+		}
+
+		TestASC = TestActor->FindComponentByClass<UAbilitySystemComponent>();
+		if (!TestASC)
+		{
+			AddError(FString::Printf(TEXT("Unable to get ASC from test actor %s"), *GetNameSafe(TestActor)));
+			return;
+		}
+
+		// Make sure BeginPlay is invoked (this is where fixture char is granting attributes)
+		TestActor->DispatchBeginPlay();
+
+		TestAttributeSetClass = LoadFixtureClass(UAttributeSet::StaticClass(), FixtureAttributeSetLoadPath);
+		if (!IsValid(TestAttributeSetClass))
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s"), FixtureAttributeSetLoadPath));
+		}
+	});
+
+	Describe(TEXT("FGBATestsAttributeDebugData::Collect()"), [this]()
+	{
+		It(TEXT("gathers every attribute of the granted Blueprint Attribute Set"), [this]()
+		{
+			FGBATestsAttributeDebugData Data;
+			Data.Collect(TestASC);
+
+			const FGBATestsAttributeDebugSet* Set = FindFixtureSet(Data);
+			if (!Set)
+			{
+				AddError(TEXT("No debug set collected for GBA_Test_Stats"));
+				return;
+			}
+
+			TestEqual(TEXT("Collected entries for GBA_Test_Stats"), Set->NumEntries, 7);
+
+			const TArray<FString> Attributes = { TEXT("Vitality"), TEXT("Endurance"), TEXT("Strength"), TEXT("Dexterity"), TEXT("Intelligence"), TEXT("Faith"), TEXT("Luck") };
+			for (const FString& Attribute : Attributes)
+			{
+				TestNotNull(FString::Printf(TEXT("Entry for %s"), *Attribute), FindEntry(Data, Attribute));
+			}
+		});
+
+		It(TEXT("reflects values after Gameplay Effect application"), [this]()
+		{
+			ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+			FGBATestsAttributeDebugData Data;
+			Data.Collect(TestASC);
+
+			const FGBATestsAttributeDebugEntry* Entry = FindEntry(Data, TEXT("Vitality"));
+			if (!Entry)
+			{
+				AddError(TEXT("No debug entry for Vitality"));
+				return;
+			}
+
+			TestEqual(TEXT("Vitality Base value"), Entry->BaseValue, 10.f);
+			TestEqual(TEXT("Vitality Current value"), Entry->CurrentValue, 10.f);
+			TestEqual(TEXT("Vitality has no active modifiers (instant effect)"), static_cast<int32>(Entry->ModifierCount), 0);
+		});
+
+		It(TEXT("counts active modifiers of infinite effects"), [this]()
+		{
+			UGameplayEffect* BuffEffect = NewObject<UGameplayEffect>(GetTransientPackage(), TEXT("DebugDataBuffEffect"));
+			FProperty* Property = FindFieldChecked<FProperty>(TestAttributeSetClass, TEXT("Strength"));
+			AddModifier(BuffEffect, Property, EGameplayModOp::Additive, FScalableFloat(5.f));
+			AddModifier(BuffEffect, Property, EGameplayModOp::Additive, FScalableFloat(5.f));
+			BuffEffect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+			TestASC->ApplyGameplayEffectToSelf(BuffEffect, 1.f, FGameplayEffectContextHandle());
+
+			FGBATestsAttributeDebugData Data;
+			Data.Collect(TestASC);
+
+			const FGBATestsAttributeDebugEntry* Entry = FindEntry(Data, TEXT("Strength"));
+			if (!Entry)
+			{
+				AddError(TEXT("No debug entry for Strength"));
+				return;
+			}
+
+			TestEqual(TEXT("Strength modifier count"), static_cast<int32>(Entry->ModifierCount), 2);
+			TestEqual(TEXT("Strength Base value"), Entry->BaseValue, 0.f);
+			TestEqual(TEXT("Strength Current value"), Entry->CurrentValue, 10.f);
+		});
+
+		It(TEXT("does not allocate once warmed up"), [this]()
+		{
+			if (!FGBATestsScopedAllocationCounter::IsSupported())
+			{
+				AddWarning(TEXT("Allocations can't be observed on this platform"));
+				return;
+			}
+
+			ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+			FGBATestsAttributeDebugData Data;
+			const uint64 NumAllocations = CountAllocations(2, 16, [this, &Data]()
+			{
+				Data.Collect(TestASC);
+			});
+
+			TestTrue(TEXT("Collected sets"), !Data.Sets.IsEmpty());
+			AddInfo(FString::Printf(TEXT("%llu allocations over 16 warmed up Collect()"), NumAllocations));
+			TestTrue(TEXT("No allocations once warmed up"), NumAllocations == 0);
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeDebugData::Serialize()"), [this]()
+	{
+		It(TEXT("round trips collected data"), [this]()
+		{
+			ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+			FGBATestsAttributeDebugData Source;
+			Source.Collect(TestASC);
+
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			Source.Serialize(Writer);
+
+			AddInfo(FString::Printf(TEXT("Serialized %d sets / %d entries in %d bytes"), Source.Sets.Num(), Source.Entries.Num(), Bytes.Num()));
+
+			FGBATestsAttributeDebugData Result;
+			FMemoryReader Reader(Bytes);
+			Result.Serialize(Reader);
+
+			if (!TestEqual(TEXT("Same number of sets"), Result.Sets.Num(), Source.Sets.Num())
+				|| !TestEqual(TEXT("Same number of entries"), Result.Entries.Num(), Source.Entries.Num()))
+			{
+				return;
+			}
+
+			for (int32 Index = 0; Index < Source.Sets.Num(); ++Index)
+			{
+				TestTrue(TEXT("Set class resolved"), Result.Sets[Index].Class == Source.Sets[Index].Class);
+				TestEqual(TEXT("Set entries"), Result.Sets[Index].NumEntries, Source.Sets[Index].NumEntries);
+			}
+
+			for (int32 Index = 0; Index < Source.Entries.Num(); ++Index)
+			{
+				const FGBATestsAttributeDebugEntry& Expected = Source.Entries[Index];
+				const FGBATestsAttributeDebugEntry& Actual = Result.Entries[Index];
+				TestEqual(TEXT("Entry BaseValue"), Actual.BaseValue, Expected.BaseValue);
+				TestEqual(TEXT("Entry CurrentValue"), Actual.CurrentValue, Expected.CurrentValue);
+				TestEqual(TEXT("Entry ModifierCount"), static_cast<int32>(Actual.ModifierCount), static_cast<int32>(Expected.ModifierCount));
+				TestTrue(TEXT("Entry bHasClampRange"), Actual.bHasClampRange == Expected.bHasClampRange);
+			}
+		});
+
+		It(TEXT("rejects a set count larger than the archive"), [this]()
+		{
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			uint32 NumSets = 0x0FFFFFFF;
+			Writer.SerializeIntPacked(NumSets);
+
+			FGBATestsAttributeDebugData Result;
+			FMemoryReader Reader(Bytes);
+			Result.Serialize(Reader);
+
+			TestTrue(TEXT("Archive flagged"), Reader.IsError());
+			TestTrue(TEXT("No sets"), Result.Sets.IsEmpty());
+			TestTrue(TEXT("Nothing allocated for sets"), Result.Sets.Max() == 0);
+		});
+
+		It(TEXT("rejects an entry count larger than the archive"), [this]()
+		{
+			// One set claiming every fixture attribute, followed by a single entry
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			uint32 NumSets = 1;
+			Writer.SerializeIntPacked(NumSets);
+			FSoftClassPath ClassPath(TestAttributeSetClass.Get());
+			Writer << ClassPath;
+			uint32 NumEntries = 7;
+			Writer.SerializeIntPacked(NumEntries);
+
+			uint8 Flags = 0;
+			float Value = 1.f;
+			uint16 ModifierCount = 0;
+			Writer << Flags;
+			Writer << Value;
+			Writer << Value;
+			Writer << ModifierCount;
+
+			FGBATestsAttributeDebugData Result;
+			FMemoryReader Reader(Bytes);
+			Result.Serialize(Reader);
+
+			TestTrue(TEXT("Archive flagged"), Reader.IsError());
+			TestTrue(TEXT("No sets"), Result.Sets.IsEmpty());
+			TestTrue(TEXT("No entries"), Result.Entries.IsEmpty());
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeDebugLayout"), [this]()
+	{
+		It(TEXT("drops layouts of collected classes"), [this]()
+		{
+			UClass* GeneratedClass = FGBATestsAttributeSetGenerator::CreateAttributeSetClass(TEXT("GBA_Test_DebugLayout"), FGBATestsAttributeSetGeneratorParams());
+			TestNotNull(TEXT("Layout"), FGBATestsAttributeDebugLayout::FindOrAdd(GeneratedClass));
+
+			const int32 NumLayouts = FGBATestsAttributeDebugLayout::GetNum();
+			FGBATestsAttributeSetGenerator::Destroy(GeneratedClass);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+			TestEqual(TEXT("Layouts after GC"), FGBATestsAttributeDebugLayout::GetNum(), NumLayouts - 1);
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeDebugData::FormatEntry()"), [this]()
+	{
+		It(TEXT("formats name, values and modifier count"), [this]()
+		{
+			ApplyGameplayEffect(TestASC, FixtureGameplayEffectLoadPath);
+
+			FGBATestsAttributeDebugData Data;
+			Data.Collect(TestASC);
+
+			const FGBATestsAttributeDebugSet* Set = FindFixtureSet(Data);
+			if (!Set)
+			{
+				AddError(TEXT("No debug set collected for GBA_Test_Stats"));
+				return;
+			}
+
+			for (int32 Index = 0; Index < Set->NumEntries; ++Index)
+			{
+				const FString* Name = Data.GetAttributeName(*Set, Index);
+				if (!Name || *Name != TEXT("Vitality"))
+				{
+					continue;
+				}
+
+				TStringBuilder<256> Builder;
+				Data.FormatEntry(*Set, Index, Builder);
+				TestEqual(TEXT("Formatted entry"), FString(Builder.ToString()), TEXT("Vitality Base: 10.00 Current: 10.00 Mods: 0"));
+			}
+		});
+
+		It(TEXT("formats fixed point values"), [this]()
+		{
+			auto TestFixed = [this](const float InValue, const TCHAR* InExpected)
+			{
+				TStringBuilder<64> Builder;
+				FGBATestsAttributeDebugData::AppendFixed(Builder, InValue);
+				TestEqual(FString::Printf(TEXT("AppendFixed(%f)"), InValue), FString(Builder.ToString()), InExpected);
+			};
+
+			TestFixed(0.f, TEXT("0.00"));
+			TestFixed(10.f, TEXT("10.00"));
+			TestFixed(-1.5f, TEXT("-1.50"));
+			TestFixed(1234.567f, TEXT("1234.57"));
+			TestFixed(-10000.f, TEXT("-10000.00"));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		// Destroys spawned actors and resets the world for next test
+		ReleaseWorld();
+	});
+}
@@ -1,6 +1,7 @@
 ﻿// Copyright 2022-2024 Mickael Daniel. All Rights Reserved.
 
 #include "AttributeSet.h"
+#include "GBATestsFixtureRegistry.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Utils/GBABlueprintLibrary.h"
@@ -28,7 +29,7 @@ void FGBABlueprintLibrary::Define()
 		BeforeEach([this]()
 		{
 			// Grab fixture Attribute Set class for further use later on
-			TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			TestAttributeSetClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
 			if (!IsValid(TestAttributeSetClass))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), *FixtureAttributeSetLoadPath));
@@ -1,6 +1,7 @@
 // Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
 
 #include "AttributeSet.h"
+#include "GBATestsFixtureRegistry.h"
 #include "GameplayEffectExecutionCalculation.h"
 #include "GameplayEffectTypes.h"
 #include "Misc/AutomationTest.h"
@@ -24,7 +25,7 @@ void FGBAExecutionCalculationSpec::Define()
 	{
 		BeforeEach([this]()
 		{
-			TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			TestAttributeSetClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
 			if (!IsValid(TestAttributeSetClass))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), *FixtureAttributeSetLoadPath));
@@ -156,7 +157,7 @@ void FGBAExecutionCalculationSpec::Define()
 	{
 		BeforeEach([this]()
 		{
-			TestAttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			TestAttributeSetClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
 			if (!IsValid(TestAttributeSetClass))
 			{
 				AddError(FString::Printf(TEXT("Unable to load %s"), *FixtureAttributeSetLoadPath));
@@ -1,6 +1,7 @@
 ﻿// Copyright 2022-2024 Mickael Daniel. All Rights Reserved.
 
 #include "AttributeSet.h"
+#include "GBATestsFixtureRegistry.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/EngineVersionComparison.h"
 
@@ -17,7 +18,7 @@ BEGIN_DEFINE_SPEC(FGBASandbox, "BlueprintAttributes.GBASandbox", EAutomationTest
 	bool CheckStuff()
 	{
 		// Grab fixture Attribute Set class for further use later on
-		const TSubclassOf<UAttributeSet> AttributeSetClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+		const TSubclassOf<UAttributeSet> AttributeSetClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureAttributeSetLoadPath, UAttributeSet::StaticClass());
 		if (!IsValid(AttributeSetClass))
 		{
 			AddError(FString::Printf(TEXT("Unable to load %s"), *FixtureAttributeSetLoadPath));
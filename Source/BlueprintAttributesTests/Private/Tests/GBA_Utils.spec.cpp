@@ -1,6 +1,7 @@
 ﻿// Copyright 2022-2024 Mickael Daniel. All Rights Reserved.
 
 #include "AttributeSet.h"
+#include "GBATestsFixtureRegistry.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Utils/GBAUtils.h"
@@ -34,7 +35,7 @@ void FGBAUtilsSpec::Define()
 
 		It(TEXT("should strip out _C from the end of a class name (BP Loaded class)"), [this]()
 		{
-			const UClass* LoadedClass = StaticLoadClass(UObject::StaticClass(), nullptr, *FixtureLoadPath);
+			const UClass* LoadedClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureLoadPath, UObject::StaticClass());
 			AddInfo(FString::Printf(TEXT("Test with %s loaded BP class"), *GetNameSafe(LoadedClass)));
 
 			if (!LoadedClass)
@@ -87,7 +88,7 @@ void FGBAUtilsSpec::Define()
 
 		It(TEXT("should return true for BP Attribute Sets"), [this]()
 		{
-			const UClass* LoadedClass = StaticLoadClass(UObject::StaticClass(), nullptr, *FixtureLoadPath);
+			const UClass* LoadedClass = FGBATestsFixtureRegistry::Get().GetClass(FixtureLoadPath, UObject::StaticClass());
 			AddInfo(FString::Printf(TEXT("Test with %s loaded BP class"), *GetNameSafe(LoadedClass)));
 
 			if (!LoadedClass)
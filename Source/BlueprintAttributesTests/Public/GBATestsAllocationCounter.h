@@ -0,0 +1,53 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts heap allocations made through FMemory on the calling thread, while in scope.
+ *
+ * The first live counter wraps GMalloc in a forwarding proxy, the last one to go out of scope restores it. Every
+ * Malloc() and every Realloc() to a non zero size counts as one allocation.
+ *
+ * Platforms inlining a fixed allocator class (FMEMORY_INLINE_GMalloc) bypass GMalloc, in which case IsSupported()
+ * returns false and counts stay at 0.
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsScopedAllocationCounter
+{
+public:
+	FGBATestsScopedAllocationCounter();
+	~FGBATestsScopedAllocationCounter();
+
+	UE_NONCOPYABLE(FGBATestsScopedAllocationCounter)
+
+	/** Allocations made on this thread since construction (or last Reset()) */
+	uint64 GetNum() const;
+
+	/** Requested bytes of those allocations */
+	uint64 GetNumBytes() const;
+
+	/**
+	 * Net heap growth on this thread: allocator sizes of allocations minus those of frees. Unlike GetNumBytes(), this
+	 * is what stays allocated (the footprint of objects created in scope), and can be negative.
+	 *
+	 * Always 0 when the allocator can't tell allocation sizes, see IsRetainedSizeSupported().
+	 */
+	int64 GetNumRetainedBytes() const;
+
+	void Reset();
+
+	/** Whether allocations can be observed on this platform */
+	static bool IsSupported();
+
+	/**
+	 * Whether GetNumRetainedBytes() can be observed on this platform, which needs GetAllocationSize() support from the
+	 * allocator (not the case of the ANSI allocator, or of some platform mallocs). Probed once.
+	 */
+	static bool IsRetainedSizeSupported();
+
+private:
+	uint64 StartNum = 0;
+	uint64 StartNumBytes = 0;
+	int64 StartNumRetainedBytes = 0;
+};
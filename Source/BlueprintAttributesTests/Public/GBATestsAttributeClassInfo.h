@@ -0,0 +1,56 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Class level attribute meta data: attribute indices, DataTable row names, clamped attributes and layout hash.
+ *
+ * Built lazily the first time a class is instantiated or initialized (FindOrAdd()), never on class load, so that
+ * boot only pays for the attribute sets actually used. Cached per class until the class is reinstanced (Blueprint
+ * compilation, live coding), garbage collected or removed (eg. FGBATestsAttributeSetGenerator::Destroy()).
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsAttributeClassInfo
+{
+	/** Name DataTable rows are looked up with (without the trailing _C for Blueprint attribute sets) */
+	FString SetName;
+
+	bool bIsBlueprintAttributeSet = false;
+
+	/** Attribute properties, as UGBATestsBakedAttributeInit::GetAttributeProperties() returns them */
+	TArray<FProperty*> Properties;
+
+	/** "SetName.AttributeName" FAttributeMetaData row names, parallel to Properties */
+	TArray<FName> RowNames;
+
+	/** Indices into Properties of FGBAGameplayClampedAttributeData attributes */
+	TArray<int32> ClampedIndices;
+
+	/** See UGBATestsBakedAttributeInit::GetAttributeProperties() */
+	uint32 LayoutHash = 0;
+
+	/** Index into Properties of the attribute named InAttributeName, INDEX_NONE if not found */
+	int32 FindIndex(const FName& InAttributeName) const;
+
+	/** Returns the cached info for InClass, building it on first call (game thread only) */
+	static const FGBATestsAttributeClassInfo* FindOrAdd(const UClass* InClass);
+
+	/** Returns the cached info for InClass, without building it */
+	static const FGBATestsAttributeClassInfo* Find(const UClass* InClass);
+
+	static int32 GetNum();
+
+	/** Drops the cached info of InClass, previously returned pointers to it are left dangling */
+	static void Remove(const UClass* InClass);
+
+	/** Drops every cached info, previously returned pointers are left dangling */
+	static void Reset();
+
+	/** Starts / stops invalidation on reinstancing and garbage collection (module startup and shutdown) */
+	static void Initialize();
+	static void Shutdown();
+
+private:
+	TMap<FName, int32> IndexByName;
+};
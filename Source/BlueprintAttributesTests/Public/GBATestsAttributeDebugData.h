@@ -0,0 +1,100 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Per class description of the attributes a Blueprint Attribute Set exposes.
+ *
+ * Built once per class and cached, so that debug rendering never has to iterate properties or
+ * build attribute / class name strings every frame.
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsAttributeDebugLayout
+{
+	/** Display name of the set (without the trailing _C) */
+	FString SetName;
+
+	/** Attributes of the set, in property order */
+	TArray<FGameplayAttribute> Attributes;
+
+	/** Attribute names, parallel to Attributes */
+	TArray<FString> AttributeNames;
+
+	/** Returns the cached layout for the given attribute set class (game thread only) */
+	static const FGBATestsAttributeDebugLayout* FindOrAdd(const UClass* InClass);
+
+	static int32 GetNum();
+
+	/** Starts / stops dropping layouts of collected or reinstanced classes (module startup and shutdown) */
+	static void Initialize();
+	static void Shutdown();
+};
+
+/** Values of a single attribute, as gathered for one debug frame */
+struct FGBATestsAttributeDebugEntry
+{
+	float BaseValue = 0.f;
+	float CurrentValue = 0.f;
+	float MinValue = 0.f;
+	float MaxValue = 0.f;
+
+	/** Number of active (non inhibited) effect modifiers targeting this attribute */
+	uint16 ModifierCount = 0;
+
+	/** Whether Min / Max values are known (attribute has metadata from a DataTable) */
+	bool bHasClampRange = false;
+};
+
+/** Range of entries belonging to one spawned attribute set */
+struct FGBATestsAttributeDebugSet
+{
+	TWeakObjectPtr<const UClass> Class;
+	int32 FirstEntry = 0;
+	int32 NumEntries = 0;
+};
+
+/**
+ * Snapshot of every Blueprint Attribute Set values of an Ability System Component.
+ *
+ * Names are never stored in the snapshot: they're resolved through FGBATestsAttributeDebugLayout on
+ * both ends, which keeps Collect() allocation free once warmed up (arrays are reset, not freed) and
+ * the serialized form down to a class path per set, plus a handful of numbers per attribute.
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsAttributeDebugData
+{
+	TArray<FGBATestsAttributeDebugSet> Sets;
+	TArray<FGBATestsAttributeDebugEntry> Entries;
+
+	/** Gathers values for every UGBAAttributeSetBlueprintBase spawned on the ASC */
+	void Collect(const UAbilitySystemComponent* InASC);
+
+	void Reset();
+
+	/**
+	 * Compact (server -> client) serialization. When loading, counts are checked against the bytes left in the archive
+	 * before anything is allocated: malformed or truncated data flags Ar with an error and leaves the snapshot empty.
+	 */
+	void Serialize(FArchive& Ar);
+
+	/** Returns the attribute name for the entry within the given set, or nullptr if the set class cannot be resolved */
+	const FString* GetAttributeName(const FGBATestsAttributeDebugSet& InSet, int32 InEntryIndex) const;
+
+	/** Appends a "Name Base Current [Min, Max] Mods" line for the entry to the builder (no heap allocation) */
+	void FormatEntry(const FGBATestsAttributeDebugSet& InSet, int32 InEntryIndex, FStringBuilderBase& OutBuilder) const;
+
+	/** Appends a value with two decimals to the builder, without going through Printf */
+	static void AppendFixed(FStringBuilderBase& OutBuilder, float InValue);
+
+	/** Appends an unsigned integer to the builder, without going through Printf */
+	static void AppendInteger(FStringBuilderBase& OutBuilder, uint64 InValue);
+
+private:
+	/** Reused between frames, so that counting modifiers per attribute doesn't reallocate */
+	TMap<FGameplayAttribute, uint16> ModifierCounts;
+};
@@ -0,0 +1,123 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/FunctionFwd.h"
+
+class UDataTable;
+struct FAttributeMetaData;
+
+/** An import error or warning, reported against the (1-based) line it was found on */
+struct FGBATestsAttributeMetaDataImportError
+{
+	int32 Line = 0;
+	FString Message;
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Line %d: %s"), Line, *Message);
+	}
+};
+
+struct FGBATestsAttributeMetaDataImportResult
+{
+	/** Number of rows successfully parsed (and handed over to the caller) */
+	int32 NumRows = 0;
+
+	/** Number of lines read, including the header */
+	int32 NumLines = 0;
+
+	/** Rejected rows and unreadable input, any of them fails the import */
+	TArray<FGBATestsAttributeMetaDataImportError> Errors;
+
+	/** Input that was imported anyway (ignored columns, rows overriding a previous one) */
+	TArray<FGBATestsAttributeMetaDataImportError> Warnings;
+
+	bool HasErrors() const { return !Errors.IsEmpty(); }
+	bool HasWarnings() const { return !Warnings.IsEmpty(); }
+};
+
+/**
+ * Streaming importer for FAttributeMetaData CSV tables, in the format UDataTable::CreateTableFromCSVString() expects:
+ *
+ *     ---,BaseValue,MinValue,MaxValue,DerivedAttributeInfo,bCanStack
+ *     GBA_Stats.Health,"100.000000","0.000000","0.000000","","False"
+ *
+ * Files are read in fixed size chunks and parsed line by line in place (no whole file FString, no per line or per
+ * cell arrays). Numeric columns are parsed straight into the row struct, and row names are validated against known
+ * attributes (SetName.AttributeName) in the same pass. Invalid rows are skipped and reported with their line number,
+ * ignored columns and duplicate rows are reported as warnings.
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsAttributeMetaDataImporter
+{
+public:
+	/** Called for each valid row */
+	using FOnRow = TFunctionRef<void(const FName& InRowName, const FAttributeMetaData& InRow)>;
+
+	/** Size of the chunks files are read with. Lines longer than that grow the read buffer. */
+	static constexpr int32 ChunkSize = 64 * 1024;
+
+	/** @param bInValidateRowNames Whether row names need to match an attribute registered with AddKnownAttribute() */
+	explicit FGBATestsAttributeMetaDataImporter(bool bInValidateRowNames = true);
+
+	void AddKnownAttribute(const FString& InSetName, const FString& InAttributeName);
+
+	/** Registers every valid attribute (FGBAUtils::IsValidProperty()) of every loaded attribute set class */
+	void AddLoadedAttributeSets();
+
+	int32 GetNumKnownAttributes() const { return KnownRowNames.Num(); }
+
+	bool ImportString(FStringView InCsv, FOnRow InOnRow);
+	bool ImportFile(const FString& InFilename, FOnRow InOnRow);
+
+	/** Empties InDataTable (which must have a FAttributeMetaData row struct) and fills it with valid rows */
+	bool ImportString(FStringView InCsv, UDataTable* InDataTable);
+	bool ImportFile(const FString& InFilename, UDataTable* InDataTable);
+
+	/** Result of the last import */
+	const FGBATestsAttributeMetaDataImportResult& GetResult() const { return Result; }
+
+private:
+	enum class EColumn : uint8
+	{
+		BaseValue,
+		MinValue,
+		MaxValue,
+		DerivedAttributeInfo,
+		bCanStack,
+		Ignored,
+	};
+
+	void Reset();
+	void AddError(int32 InLine, FString&& InMessage);
+	void AddWarning(int32 InLine, FString&& InMessage);
+	static bool CheckDataTable(const UDataTable* InDataTable);
+
+	/** Parses complete lines of [InBegin, InEnd), returns where the first incomplete one starts (InEnd if bInFinal) */
+	template <typename CharType>
+	const CharType* ParseLines(const CharType* InBegin, const CharType* InEnd, bool bInFinal, FOnRow InOnRow);
+
+	template <typename CharType>
+	void ParseLine(const CharType* InBegin, const CharType* InEnd, FOnRow InOnRow);
+
+	template <typename CharType>
+	void ParseHeader(const CharType* InBegin, const CharType* InEnd);
+
+	template <typename CharType>
+	void ParseRow(const CharType* InBegin, const CharType* InEnd, FOnRow InOnRow);
+
+	template <typename CharType>
+	bool ValidateRowName(TStringView<CharType> InRowName, const FName& InName);
+
+	bool bValidateRowNames = true;
+	TSet<FName> KnownRowNames;
+	TSet<FName> KnownSetNames;
+
+	/** Per import state */
+	TArray<EColumn> Columns;
+	bool bHasHeader = false;
+	int32 LineNumber = 0;
+	TSet<FName> SeenRowNames;
+	FGBATestsAttributeMetaDataImportResult Result;
+};
@@ -0,0 +1,88 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+
+class UDataTable;
+class UGameplayEffect;
+
+/** Layout of a generated attribute set class, and of its generated DataTable and Gameplay Effect */
+struct FGBATestsAttributeSetGeneratorParams
+{
+	int32 NumAttributes = 8;
+
+	/** Share (0-1) of attributes declared as FGBAGameplayClampedAttributeData, the rest are FGameplayAttributeData */
+	float ClampedRatio = 0.f;
+
+	/** Share (0-1) of DataTable rows with a [0, MaxValue] clamping range, the rest have none */
+	float DataTableClampedRatio = 0.f;
+
+	/** DataTable BaseValue of every attribute */
+	float BaseValue = 10.f;
+
+	/** DataTable MaxValue of rows with a clamping range */
+	float MaxValue = 100.f;
+
+	/** Modifiers of the generated Gameplay Effect (none is generated if 0), spread over attributes */
+	int32 NumModifiers = 0;
+
+	EGameplayModOp::Type ModifierOp = EGameplayModOp::Additive;
+	float ModifierMagnitude = 1.f;
+};
+
+/** Everything FGBATestsAttributeSetGenerator::Generate() creates, sharing the class package */
+struct FGBATestsGeneratedAttributeSet
+{
+	UClass* Class = nullptr;
+	UDataTable* DataTable = nullptr;
+
+	/** Instant effect, only generated with NumModifiers > 0 */
+	UGameplayEffect* Effect = nullptr;
+};
+
+/**
+ * Builds transient UGBAAttributeSetBlueprintBase classes with any number of attributes, along with matching
+ * FAttributeMetaData DataTables and Gameplay Effects, for specs that need larger sets than the checked-in fixtures.
+ *
+ * Classes are linked at runtime as Blueprint generated classes without a Blueprint (as in cooked builds), so this
+ * works without the editor. Attributes are named Attribute_0000, Attribute_0001, ...
+ *
+ *     FGBATestsAttributeSetGeneratorParams Params;
+ *     Params.NumAttributes = 500;
+ *     Params.ClampedRatio = 0.5f;
+ *     Params.NumModifiers = 20;
+ *     const FGBATestsGeneratedAttributeSet Generated = FGBATestsAttributeSetGenerator::Generate(TEXT("GBA_Test_500"), Params);
+ *     ...
+ *     FGBATestsAttributeSetGenerator::Destroy(Generated.Class);
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsAttributeSetGenerator
+{
+public:
+	/** Creates a class, its DataTable and, if InParams.NumModifiers > 0, a Gameplay Effect */
+	static FGBATestsGeneratedAttributeSet Generate(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams);
+
+	/**
+	 * Creates, links and builds the CDO of a new attribute set class named InName (_C suffixed). If a package of that
+	 * name still exists, a numbered suffix is appended.
+	 */
+	static UClass* CreateAttributeSetClass(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams);
+
+	/** Steps of CreateAttributeSetClass(): declares the class and its properties, as loading it would */
+	static UClass* DeclareAttributeSetClass(const FString& InName, const FGBATestsAttributeSetGeneratorParams& InParams);
+
+	/** Steps of CreateAttributeSetClass(): binds and links a declared class, without creating its CDO */
+	static void LinkAttributeSetClass(UClass* InClass);
+
+	/** Creates a FAttributeMetaData DataTable with a row for each InClass attribute, going through the CSV importer */
+	static UDataTable* CreateMetaDataTable(const UClass* InClass, const FGBATestsAttributeSetGeneratorParams& InParams = FGBATestsAttributeSetGeneratorParams());
+
+	/** Creates an instant Gameplay Effect with InParams.NumModifiers modifiers, cycling over InClass attributes */
+	static UGameplayEffect* CreateGameplayEffect(const UClass* InClass, const FGBATestsAttributeSetGeneratorParams& InParams);
+
+	static FName GetAttributeName(int32 InIndex);
+
+	/** Marks a generated object (class, DataTable or Gameplay Effect) and its package for destruction on next GC */
+	static void Destroy(UObject* InObject);
+};
@@ -0,0 +1,116 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GBATestsBakedAttributeInit.generated.h"
+
+class UAbilitySystemComponent;
+class UAttributeSet;
+class UDataTable;
+
+/** How an attribute set was initialized by UGBATestsBakedAttributeInit */
+enum class EGBATestsBakedAttributeInitPath : uint8
+{
+	/** Values were written straight from baked data */
+	Baked,
+
+	/** Baked data was missing, stale or not sufficient, the DataTable was used instead */
+	DataTable,
+
+	/** Neither baked data nor DataTable could be used */
+	Failed,
+};
+
+/** A single baked attribute init value, resolved against the attribute set layout */
+struct FGBATestsBakedAttributeValue
+{
+	/** Index into the attribute set class attribute properties (see UGBATestsBakedAttributeInit::GetAttributeProperties()) */
+	int32 AttributeIndex = INDEX_NONE;
+
+	float BaseValue = 0.f;
+	float MinValue = 0.f;
+	float MaxValue = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FGBATestsBakedAttributeValue& InValue)
+	{
+		Ar << InValue.AttributeIndex;
+		Ar << InValue.BaseValue;
+		Ar << InValue.MinValue;
+		Ar << InValue.MaxValue;
+		return Ar;
+	}
+};
+
+/**
+ * Pre-resolved FAttributeMetaData init values for an (attribute set class, DataTable) pair.
+ *
+ * Baked from the DataTable on cook, edit and save: row names are resolved to attribute property indices once, and
+ * stored in binary form alongside a hash of the attribute set layout. At runtime, values are written straight into
+ * the attribute set, with no DataTable load nor row lookups. If the layout hash doesn't match the loaded class
+ * anymore, initialization falls back to UAttributeSet::InitFromMetaDataTable() with the source DataTable.
+ *
+ * UGBAAttributeSetBlueprintBase classes with clamped attributes or DataTable clamping ranges always use the
+ * DataTable, as their init keeps track of per attribute meta data used later on for clamping.
+ */
+UCLASS(BlueprintType)
+class BLUEPRINTATTRIBUTESTESTS_API UGBATestsBakedAttributeInit : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Baked Attribute Init")
+	TSubclassOf<UAttributeSet> AttributeSetClass;
+
+	/** Source of baked values, only loaded at runtime when baked data can't be used */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Baked Attribute Init")
+	TSoftObjectPtr<UDataTable> DataTable;
+
+	/** Resolves DataTable rows against AttributeSetClass layout. Returns false if nothing could be baked. */
+	bool Bake();
+
+	/** Whether baked data exists and matches InAttributeSetClass current layout */
+	bool IsLayoutUpToDate(const UClass* InAttributeSetClass) const;
+
+	/** Same as UAttributeSet::InitFromMetaDataTable() with DataTable, from baked data whenever possible */
+	EGBATestsBakedAttributeInitPath InitAttributeSet(UAttributeSet* InAttributeSet) const;
+
+	/** Same as UAbilitySystemComponent::InitStats() with AttributeSetClass and DataTable */
+	EGBATestsBakedAttributeInitPath InitStats(UAbilitySystemComponent* InASC) const;
+
+	const TArray<FGBATestsBakedAttributeValue>& GetBakedValues() const { return BakedValues; }
+	uint32 GetLayoutHash() const { return LayoutHash; }
+	bool RequiresDataTable() const { return bRequiresDataTable; }
+
+	/**
+	 * Attribute properties (FGameplayAttributeData or numeric) of a class, in field iteration order, as
+	 * UAttributeSet::InitFromMetaDataTable() visits them. Returns a hash of their names, types and offsets.
+	 */
+	static uint32 GetAttributeProperties(const UClass* InAttributeSetClass, TArray<FProperty*>& OutProperties);
+
+	//~ Begin UObject interface
+	virtual void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	virtual void BeginCacheForCookedPlatformData(const ITargetPlatform* TargetPlatform) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject interface
+
+private:
+	/** Bumped whenever the binary layout of baked data changes */
+	static constexpr int32 BakedDataVersion = 1;
+
+	TArray<FGBATestsBakedAttributeValue> BakedValues;
+	uint32 LayoutHash = 0;
+	bool bRequiresDataTable = false;
+
+#if WITH_EDITORONLY_DATA
+	/** Resolved row names, for reference */
+	UPROPERTY(VisibleAnywhere, Category = "Baked Attribute Init")
+	TArray<FName> BakedRowNames;
+#endif
+
+	EGBATestsBakedAttributeInitPath InitFromDataTable(UAttributeSet* InAttributeSet, const TCHAR* InReason) const;
+};
@@ -0,0 +1,100 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+struct FGBATestsBenchmarkStats;
+
+/** Recorded timings of a benchmark metric, in nanoseconds per operation */
+struct FGBATestsBaselineMetric
+{
+	double Median = 0.0;
+	double P99 = 0.0;
+};
+
+/** Allowed slowdown over the baseline before a metric is considered regressed (0.2 = 20% slower) */
+struct FGBATestsBaselineTolerance
+{
+	double Median = 0.2;
+
+	/** Tail latencies are noisier, hence the looser default */
+	double P99 = 0.5;
+};
+
+enum class EGBATestsBaselineResult : uint8
+{
+	/** Within tolerance of the baseline */
+	Passed,
+
+	/** Slower than the baseline beyond tolerance */
+	Regressed,
+
+	/** No baseline recorded for this metric (and machine profile) yet */
+	Missing,
+
+	/** Baseline was (re)recorded, updates were opted in */
+	Updated,
+};
+
+/**
+ * Performance baselines of benchmark specs, for a single machine profile.
+ *
+ * Stored as versioned JSON under Saved/BlueprintAttributesTests/Baselines/<MachineProfile>.json, keyed by spec
+ * name then metric name. Benchmark specs Check() their stats against it: a metric whose median or p99 regressed
+ * beyond tolerance fails the test. Baselines are only written when explicitly opted in.
+ *
+ * Command line options (for the store returned by Get()):
+ * - -GBAUpdateBaselines records current stats as the new baselines instead of comparing
+ * - -GBABaselineProfile=<Name> overrides the machine profile (defaults to GetDefaultMachineProfile())
+ * - -GBABaselineTolerance=<Ratio> and -GBABaselineP99Tolerance=<Ratio> override the default tolerance
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsBaselineStore
+{
+public:
+	/** Bumped whenever the JSON layout changes. Files with another version are ignored (and rewritten on update). */
+	static constexpr int32 Version = 1;
+
+	/** Store of this machine, configured from the command line and loaded on first use */
+	static FGBATestsBaselineStore& Get();
+
+	/** Platform, build configuration, CPU and core count, usable as a file name */
+	static FString GetDefaultMachineProfile();
+
+	FGBATestsBaselineStore(const FString& InFilename, const FString& InMachineProfile);
+
+	/** Reads baselines from Filename, dropping current ones. Returns false if the file is missing or unusable. */
+	bool Load();
+
+	/** Writes baselines to Filename */
+	bool Save() const;
+
+	const FGBATestsBaselineMetric* Find(const FString& InSpecName, const FString& InMetricName) const;
+
+	void Set(const FString& InSpecName, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats);
+
+	/** Compares InStats against the baseline with Tolerance, OutMessage describes the outcome */
+	EGBATestsBaselineResult Compare(const FString& InSpecName, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats, FString& OutMessage) const;
+
+	/**
+	 * Compares InStats against InTest baseline (keyed by its full name), or records and saves it when updates are
+	 * opted in. Regressions are reported as errors on InTest, anything else as info.
+	 */
+	EGBATestsBaselineResult Check(FAutomationTestBase& InTest, const FString& InMetricName, const FGBATestsBenchmarkStats& InStats);
+
+	const FString& GetFilename() const { return Filename; }
+	const FString& GetMachineProfile() const { return MachineProfile; }
+
+	FGBATestsBaselineTolerance Tolerance;
+
+	/** Whether Check() records baselines instead of comparing */
+	bool bUpdate = false;
+
+private:
+	FString Filename;
+	FString MachineProfile;
+
+	/** Metrics by spec name, then metric name */
+	TMap<FString, TMap<FString, FGBATestsBaselineMetric>> Specs;
+};
@@ -0,0 +1,98 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/FunctionFwd.h"
+
+/** Summary statistics over a set of benchmark samples, all expressed in nanoseconds per operation */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsBenchmarkStats
+{
+	int32 NumSamples = 0;
+
+	double Min = 0.0;
+	double Median = 0.0;
+	double P99 = 0.0;
+	double Mean = 0.0;
+	double StdDev = 0.0;
+
+	/** Computes stats from raw samples (taken by value, as they need sorting) */
+	static FGBATestsBenchmarkStats Compute(TArray<double> InSamples);
+
+	/** Returns the nearest-rank percentile (0-100) of already sorted samples */
+	static double Percentile(const TArray<double>& InSortedSamples, double InPercentile);
+
+	/** Human readable one-liner, eg. "min 12.1 ns | median 13.0 ns | p99 20.4 ns | stddev 1.2 ns (20 samples)" */
+	FString ToString() const;
+};
+
+/** How FGBATestsBenchmark::RunAdaptive() samples an operation */
+struct FGBATestsBenchmarkParams
+{
+	/** Untimed samples, once the number of operations per sample is calibrated */
+	int32 NumWarmupSamples = 2;
+
+	int32 NumSamples = 30;
+
+	/** Operations per sample are doubled until a sample takes at least this long, to stay well above timer resolution */
+	double MinSampleNanoseconds = 100000.0;
+
+	int32 MaxOpsPerSample = 1 << 20;
+
+	/** Counts allocations of one more (untimed) sample, where supported (see FGBATestsScopedAllocationCounter) */
+	bool bCountAllocations = true;
+};
+
+/** Outcome of FGBATestsBenchmark::RunAdaptive() */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsBenchmarkResult
+{
+	/** Nanoseconds per operation */
+	FGBATestsBenchmarkStats Stats;
+
+	int32 OpsPerSample = 0;
+
+	/** Heap allocations and requested bytes per operation, -1 when not counted */
+	double AllocsPerOp = -1.0;
+	double BytesPerOp = -1.0;
+
+	/** Columns of ToCsvRow(), after the ones callers prepend */
+	static constexpr const TCHAR* CsvHeader = TEXT("Samples,OpsPerSample,MinNsPerOp,P50NsPerOp,P99NsPerOp,StdDevNsPerOp,AllocsPerOp,BytesPerOp");
+
+	FString ToCsvRow() const;
+};
+
+/** Minimal timing harness used by benchmark specs */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsBenchmark
+{
+	/**
+	 * Runs InBody InNumPasses times (after InNumWarmupPasses untimed ones).
+	 *
+	 * Each pass is expected to perform InOpsPerPass operations, and one sample (ns/op) is recorded per pass.
+	 */
+	static FGBATestsBenchmarkStats Run(int32 InNumWarmupPasses, int32 InNumPasses, int64 InOpsPerPass, TFunctionRef<void()> InBody);
+
+	/**
+	 * Times InOp, a single operation: the number of operations per sample is first calibrated so that a sample takes
+	 * at least InParams.MinSampleNanoseconds, which makes it fit operations from a few nanoseconds to milliseconds.
+	 */
+	static FGBATestsBenchmarkResult RunAdaptive(const FGBATestsBenchmarkParams& InParams, TFunctionRef<void()> InOp);
+
+	/** Keeps the compiler from optimizing away the computation of InValue, eg. a result unused by benchmarked code */
+	template <typename T>
+	static FORCEINLINE void DoNotOptimize(const T& InValue)
+	{
+#if PLATFORM_COMPILER_CLANG || defined(__GNUC__)
+		asm volatile("" : : "r,m"(InValue) : "memory");
+#else
+		Escape(&InValue);
+#endif
+	}
+
+	/** Publishes InPointer through a volatile global, as an opaque use of what it points to */
+	static void Escape(const void* InPointer);
+
+	static double CyclesToNanoseconds(uint64 InCycles)
+	{
+		return FPlatformTime::ToMilliseconds64(InCycles) * 1000000.0;
+	}
+};
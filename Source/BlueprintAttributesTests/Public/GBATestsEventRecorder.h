@@ -0,0 +1,284 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GBATestsStorageTypes.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/FunctionFwd.h"
+#include <atomic>
+#include <type_traits>
+
+/** Attribute set callbacks recorded by FGBATestsEventRecorder */
+enum class EGBATestsEventKind : uint8
+{
+	PreGameplayEffectExecute,
+	PostGameplayEffectExecute,
+	PreAttributeChange,
+	PostAttributeChange,
+	PreAttributeBaseChange,
+	PostAttributeBaseChange,
+
+	Num
+};
+
+/** Common data of every recorded event */
+struct FGBATestsEventHeader
+{
+	/** Global order of the event, across all kinds */
+	uint64 Sequence = 0;
+
+	/** GFrameCounter when recorded */
+	uint64 Frame = 0;
+
+	/** FPlatformTime::Cycles64() when recorded */
+	uint64 Cycles = 0;
+
+	/** Storage key the event was recorded with (eg. PostAttributeChange_Vitality) */
+	FName Key;
+};
+
+template <typename PayloadType>
+struct TGBATestsEventRecord
+{
+	FGBATestsEventHeader Header;
+	PayloadType Payload;
+};
+
+/** Which events to visit. Every kind and every attribute by default. */
+struct FGBATestsEventFilter
+{
+	uint32 KindMask = MAX_uint32;
+
+	/** Only visits events for this attribute, if valid */
+	FGameplayAttribute Attribute;
+
+	FGBATestsEventFilter& Kind(const EGBATestsEventKind InKind)
+	{
+		KindMask = KindMask == MAX_uint32 ? 0 : KindMask;
+		KindMask |= 1u << static_cast<uint32>(InKind);
+		return *this;
+	}
+
+	bool MatchesKind(const EGBATestsEventKind InKind) const
+	{
+		return (KindMask & (1u << static_cast<uint32>(InKind))) != 0;
+	}
+
+	bool MatchesAttribute(const FGameplayAttribute& InAttribute) const
+	{
+		return !Attribute.IsValid() || Attribute == InAttribute;
+	}
+};
+
+/**
+ * Fixed capacity ring of records for a single event kind.
+ *
+ * Slots are allocated once and reused (payload assignment reuses tag containers allocations), oldest records are
+ * overwritten when full. Producers from any thread serialize on a write lock held for a single slot assignment,
+ * readers visit records in place under a read lock.
+ */
+template <typename PayloadType>
+class TGBATestsEventRing
+{
+public:
+	using FRecord = TGBATestsEventRecord<PayloadType>;
+
+	/** Preallocates InCapacity slots (rounded up to a power of two) and drops every record */
+	void Initialize(const int32 InCapacity)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Records.Reset();
+		Records.SetNum(InCapacity > 0 ? FMath::RoundUpToPowerOfTwo(InCapacity) : 0);
+		NumWritten = 0;
+	}
+
+	/** Drops every record, keeping slots (and their payloads allocations) around */
+	void Reset()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		NumWritten = 0;
+	}
+
+	/** Sequence is taken under the lock, so that records of a ring are always sorted by sequence */
+	void Append(std::atomic<uint64>& InOutSequence, const FName& InKey, const PayloadType& InPayload)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (Records.IsEmpty())
+		{
+			return;
+		}
+
+		FRecord& Record = Records[NumWritten & (Records.Num() - 1)];
+		Record.Header.Sequence = InOutSequence.fetch_add(1, std::memory_order_relaxed);
+		Record.Header.Frame = GFrameCounter;
+		Record.Header.Cycles = FPlatformTime::Cycles64();
+		Record.Header.Key = InKey;
+		Record.Payload = InPayload;
+		++NumWritten;
+	}
+
+	/** Visits records from oldest to newest, in place. InVisitor returns false to stop. */
+	template <typename VisitorType>
+	void ForEach(VisitorType&& InVisitor) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		for (uint64 Index = GetFirstIndex(); Index < NumWritten; ++Index)
+		{
+			if (!InVisitor(Records[Index & (Records.Num() - 1)]))
+			{
+				return;
+			}
+		}
+	}
+
+	/**
+	 * Copies the newest payload recorded with InKey. Returns false if none is held anymore (overwritten records are
+	 * gone). Scans the ring from newest to oldest under the read lock, a miss visits every slot.
+	 */
+	bool FindLast(const FName& InKey, PayloadType& OutPayload) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		for (uint64 Index = NumWritten; Index > GetFirstIndex(); --Index)
+		{
+			const FRecord& Record = Records[(Index - 1) & (Records.Num() - 1)];
+			if (Record.Header.Key == InKey)
+			{
+				OutPayload = Record.Payload;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int32 Num() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return static_cast<int32>(NumWritten - GetFirstIndex());
+	}
+
+	int32 GetCapacity() const { return Records.Num(); }
+
+	/** Number of records overwritten since last reset */
+	uint64 GetNumDropped() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return GetFirstIndex();
+	}
+
+private:
+	friend class FGBATestsEventRecorder;
+
+	uint64 GetFirstIndex() const
+	{
+		return NumWritten > static_cast<uint64>(Records.Num()) ? NumWritten - Records.Num() : 0;
+	}
+
+	TArray<FRecord> Records;
+	uint64 NumWritten = 0;
+	mutable FRWLock Lock;
+};
+
+/**
+ * Records every attribute set callback (the six FGBATestStorage_* payload types), in order, with their frame and
+ * timestamp. Each kind has its own preallocated ring, and a global sequence number orders events across kinds.
+ *
+ * Recording doesn't allocate once slots have been used (payloads are assigned in place), and events are visited
+ * in place: per kind with GetRing<PayloadType>().ForEach(), or across kinds with ForEachEvent().
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsEventRecorder
+{
+public:
+	static constexpr int32 DefaultCapacity = 4096;
+
+	/** Preallocates InCapacity records per event kind, dropping recorded events */
+	void Initialize(int32 InCapacity = DefaultCapacity);
+
+	/** Drops recorded events, keeping preallocated slots */
+	void Reset();
+
+	template <typename PayloadType>
+	void Record(const FName& InKey, const PayloadType& InPayload)
+	{
+		GetRing<PayloadType>().Append(NextSequence, InKey, InPayload);
+	}
+
+	template <typename PayloadType>
+	TGBATestsEventRing<PayloadType>& GetRing()
+	{
+		return const_cast<TGBATestsEventRing<PayloadType>&>(static_cast<const FGBATestsEventRecorder*>(this)->GetRing<PayloadType>());
+	}
+
+	template <typename PayloadType>
+	const TGBATestsEventRing<PayloadType>& GetRing() const
+	{
+		if constexpr (std::is_same_v<PayloadType, FGBATestStorage_PreGameplayEffectExecutePayload>)
+		{
+			return PreGameplayEffectExecute;
+		}
+		else if constexpr (std::is_same_v<PayloadType, FGBATestStorage_PostGameplayEffectExecutePayload>)
+		{
+			return PostGameplayEffectExecute;
+		}
+		else if constexpr (std::is_same_v<PayloadType, FGBATestStorage_PreAttributeChangePayload>)
+		{
+			return PreAttributeChange;
+		}
+		else if constexpr (std::is_same_v<PayloadType, FGBATestStorage_PostAttributeChangePayload>)
+		{
+			return PostAttributeChange;
+		}
+		else if constexpr (std::is_same_v<PayloadType, FGBATestStorage_PreAttributeBaseChangePayload>)
+		{
+			return PreAttributeBaseChange;
+		}
+		else
+		{
+			static_assert(std::is_same_v<PayloadType, FGBATestStorage_PostAttributeBaseChangePayload>, "Unsupported event payload type");
+			return PostAttributeBaseChange;
+		}
+	}
+
+	/** Copies the newest payload of this type recorded with InKey, still held by its ring (linear scan) */
+	template <typename PayloadType>
+	bool FindLast(const FName& InKey, PayloadType& OutPayload) const
+	{
+		return GetRing<PayloadType>().FindLast(InKey, OutPayload);
+	}
+
+	/**
+	 * Visits events matching InFilter across kinds, in recording order and in place. Payload is the
+	 * FGBATestStorage_* struct matching the kind. InVisitor returns false to stop.
+	 *
+	 * Every ring's read lock is held while InVisitor runs: recording from it (eg. setting a storage payload) deadlocks.
+	 */
+	void ForEachEvent(const FGBATestsEventFilter& InFilter, TFunctionRef<bool(EGBATestsEventKind InKind, const FGBATestsEventHeader& InHeader, const FTestStorageBlueprintData& InPayload)> InVisitor) const;
+
+	/** Number of held events (matching InFilter) */
+	int32 Num(const FGBATestsEventFilter& InFilter = FGBATestsEventFilter()) const;
+
+	/** Number of events overwritten since last reset, across kinds */
+	uint64 GetNumDropped() const;
+
+	static const TCHAR* LexToString(EGBATestsEventKind InKind);
+
+private:
+	/** Type erased read position into a ring, for ForEachEvent() merge */
+	struct FCursor;
+
+	template <typename PayloadType>
+	static FCursor MakeCursor(EGBATestsEventKind InKind, const TGBATestsEventRing<PayloadType>& InRing);
+
+	/** Calls InFunc(Kind, Ring) for each kind */
+	template <typename FuncType>
+	void ForEachRing(FuncType&& InFunc) const;
+
+	TGBATestsEventRing<FGBATestStorage_PreGameplayEffectExecutePayload> PreGameplayEffectExecute;
+	TGBATestsEventRing<FGBATestStorage_PostGameplayEffectExecutePayload> PostGameplayEffectExecute;
+	TGBATestsEventRing<FGBATestStorage_PreAttributeChangePayload> PreAttributeChange;
+	TGBATestsEventRing<FGBATestStorage_PostAttributeChangePayload> PostAttributeChange;
+	TGBATestsEventRing<FGBATestStorage_PreAttributeBaseChangePayload> PreAttributeBaseChange;
+	TGBATestsEventRing<FGBATestStorage_PostAttributeBaseChangePayload> PostAttributeBaseChange;
+
+	std::atomic<uint64> NextSequence { 0 };
+};
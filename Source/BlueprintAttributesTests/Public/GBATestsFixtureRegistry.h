@@ -0,0 +1,96 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FStreamableManager;
+
+/**
+ * Cache of fixture assets for the specs.
+ *
+ * Every asset under FixturesRoot is preloaded once, in parallel through a streamable manager, before the first
+ * fixture is handed out (or when automation tests start). Later lookups return cached hard references, instead of
+ * going through StaticLoadClass() / StaticLoadObject() each time. Paths that weren't preloaded are loaded on demand
+ * and cached as well.
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsFixtureRegistry : public FGCObject
+{
+public:
+	static constexpr const TCHAR* FixturesRoot = TEXT("/BlueprintAttributesTests/Fixtures");
+
+	/** Lookups and load times since the registry was created */
+	struct FStats
+	{
+		int32 NumPreloaded = 0;
+		double PreloadSeconds = 0.0;
+
+		/** Lookups answered from the cache */
+		int32 NumHits = 0;
+
+		/** Lookups of objects already in memory, but not cached yet */
+		int32 NumResolved = 0;
+
+		/** Lookups that had to load synchronously */
+		int32 NumLoaded = 0;
+		double LoadSeconds = 0.0;
+
+		/** Time spent in lookups, hits included */
+		double LookupSeconds = 0.0;
+
+		FString ToString() const;
+	};
+
+	static FGBATestsFixtureRegistry& Get();
+
+	/** Destroys the registry (on module shutdown), releasing its references */
+	static void Shutdown();
+
+	FGBATestsFixtureRegistry();
+	virtual ~FGBATestsFixtureRegistry() override;
+
+	/** Preloads every fixture asset, if not done already. Blocks until loaded. */
+	void Preload();
+
+	/**
+	 * Fixture at InPath, or nullptr. Accepts what StaticLoadObject() does: object paths (including _C class paths)
+	 * and package names of single asset packages (eg. /BlueprintAttributesTests/Fixtures/Some_Spec/DT_Test_Stats).
+	 */
+	UObject* GetObject(const FString& InPath);
+
+	/** Fixture class at InPath if it is a InBaseClass child, or nullptr */
+	UClass* GetClass(const FString& InPath, const UClass* InBaseClass);
+
+	template <typename T>
+	T* Get(const FString& InPath)
+	{
+		return Cast<T>(GetObject(InPath));
+	}
+
+	bool IsPreloaded() const { return bPreloaded; }
+	const FStats& GetStats() const { return Stats; }
+
+	//~ Begin FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject interface
+
+private:
+	TUniquePtr<FStreamableManager> StreamableManager;
+
+	TMap<FSoftObjectPath, UObject*> Cache;
+
+	/** Keeps cached and preloaded assets loaded */
+	TArray<TObjectPtr<UObject>> ReferencedObjects;
+
+	/** Object path for InPath, with the asset name appended to bare package names */
+	static FSoftObjectPath ToObjectPath(const FString& InPath);
+
+	bool bPreloaded = false;
+	FStats Stats;
+
+	FDelegateHandle BeforeAllTestsHandle;
+	FDelegateHandle AfterAllTestsHandle;
+};
@@ -0,0 +1,91 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GameplayEffectTypes.h"
+#include "UObject/GCObject.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/** What a cached Gameplay Effect is built from. Magnitudes aren't part of it, they are set by caller on each spec. */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsGameplayEffectSignature
+{
+	struct FModifier
+	{
+		FGameplayAttribute Attribute;
+		EGameplayModOp::Type Op = EGameplayModOp::Additive;
+
+		bool operator==(const FModifier& Other) const
+		{
+			return Attribute == Other.Attribute && Op == Other.Op;
+		}
+	};
+
+	TArray<FModifier, TInlineAllocator<2>> Modifiers;
+
+	EGameplayEffectDurationType DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	/** Seconds between executions, 0 for non periodic effects */
+	float Period = 0.f;
+
+	FGBATestsGameplayEffectSignature() = default;
+
+	/** Single modifier signature */
+	FGBATestsGameplayEffectSignature(const FGameplayAttribute& InAttribute, EGameplayModOp::Type InOp, EGameplayEffectDurationType InDurationPolicy = EGameplayEffectDurationType::Instant, float InPeriod = 0.f);
+
+	bool operator==(const FGBATestsGameplayEffectSignature& Other) const
+	{
+		return Modifiers == Other.Modifiers && DurationPolicy == Other.DurationPolicy && Period == Other.Period;
+	}
+
+	friend uint32 GetTypeHash(const FGBATestsGameplayEffectSignature& InSignature);
+
+	FString ToString() const;
+};
+
+/**
+ * Shared, immutable Gameplay Effects built at runtime, one per modifier signature (attributes, ops, duration policy
+ * and period), for one-off damage, overrides or buffs that would otherwise create a new UGameplayEffect each time.
+ *
+ * Every modifier magnitude is a set by caller magnitude named GetMagnitudeName(ModifierIndex), which Apply() sets on
+ * a spec built on the stack: applying cached effects creates no UObject. Effects live in the transient package and
+ * are kept alive until Reset() (or module shutdown). Game thread only.
+ *
+ *     FGBATestsGameplayEffectCache::Get().Apply(ASC, { HealthAttribute, EGameplayModOp::Additive }, { -Damage });
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsGameplayEffectCache : public FGCObject
+{
+public:
+	static FGBATestsGameplayEffectCache& Get();
+
+	/** Destroys the cache (on module shutdown), releasing its effects */
+	static void Shutdown();
+
+	/** Set by caller name of the magnitude of the modifier at InModifierIndex */
+	static FName GetMagnitudeName(int32 InModifierIndex);
+
+	/** Effect for InSignature, built on first request */
+	const UGameplayEffect* FindOrAdd(const FGBATestsGameplayEffectSignature& InSignature);
+
+	/**
+	 * Applies the InSignature effect to InASC, with InMagnitudes for its modifiers (in order) and, for effects with a
+	 * duration, InDuration seconds.
+	 */
+	FActiveGameplayEffectHandle Apply(UAbilitySystemComponent* InASC, const FGBATestsGameplayEffectSignature& InSignature, TConstArrayView<float> InMagnitudes, float InDuration = 0.f, float InLevel = 1.f);
+
+	int32 Num() const { return Effects.Num(); }
+
+	/** Forgets every effect, which is collected on next GC unless referenced elsewhere (eg. by an active effect) */
+	void Reset();
+
+	//~ Begin FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject interface
+
+private:
+	TMap<FGBATestsGameplayEffectSignature, TObjectPtr<UGameplayEffect>> Effects;
+};
@@ -0,0 +1,25 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GBATestsNativeHealthSet.h"
+#include "GBATestsInstrumentedHealthSet.generated.h"
+
+/**
+ * UGBATestsNativeHealthSet with GBATests trace and "stat BlueprintAttributes" scopes around its callbacks, for specs
+ * checking how the native side of the pipeline shows up in Insights and stats.
+ *
+ * Kept apart from UGBATestsNativeHealthSet, which benchmarks use as an uninstrumented baseline against Blueprint sets.
+ */
+UCLASS()
+class BLUEPRINTATTRIBUTESTESTS_API UGBATestsInstrumentedHealthSet : public UGBATestsNativeHealthSet
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UAttributeSet interface
+	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
+	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
+	//~ End UAttributeSet interface
+};
@@ -0,0 +1,53 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * HDR style histogram of latencies (any unit, usually nanoseconds), over the whole uint64 range.
+ *
+ * Values are bucketed log-linearly: below SubBucketCount each value has its own bucket, above that each power of
+ * two range is split in SubBucketCount / 2 buckets. Percentiles are within 1 / (SubBucketCount / 2) of the recorded
+ * values (under 1%), whatever their magnitude.
+ *
+ * Buckets are allocated once on construction, Record() doesn't allocate.
+ */
+class BLUEPRINTATTRIBUTESTESTS_API FGBATestsLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 8;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 SubBucketHalfCount = SubBucketCount / 2;
+	static constexpr int32 NumBuckets = SubBucketCount + (64 - SubBucketBits) * SubBucketHalfCount;
+
+	FGBATestsLatencyHistogram();
+
+	void Record(uint64 InValue);
+
+	/** Adds InOther recorded values to this one */
+	void Add(const FGBATestsLatencyHistogram& InOther);
+
+	/** Drops recorded values, keeping buckets */
+	void Reset();
+
+	/** Highest value equivalent (same bucket) to the InPercentile (0-100) of recorded values, 0 if empty */
+	uint64 GetPercentile(double InPercentile) const;
+
+	uint64 GetTotalCount() const { return TotalCount; }
+	uint64 GetMin() const { return TotalCount > 0 ? Min : 0; }
+	uint64 GetMax() const { return Max; }
+	double GetMean() const { return TotalCount > 0 ? Sum / TotalCount : 0.0; }
+
+	static int32 GetBucketIndex(uint64 InValue);
+
+	/** Largest value bucketed in InIndex */
+	static uint64 GetHighestEquivalentValue(int32 InIndex);
+
+private:
+	TArray<uint64> Counts;
+	uint64 TotalCount = 0;
+	uint64 Min = MAX_uint64;
+	uint64 Max = 0;
+	double Sum = 0.0;
+};
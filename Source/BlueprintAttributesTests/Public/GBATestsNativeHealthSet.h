@@ -0,0 +1,46 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GBATestsNativeHealthSet.generated.h"
+
+#define GBA_TESTS_ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
+	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(ClassName, PropertyName) \
+	GAMEPLAYATTRIBUTE_VALUE_GETTER(PropertyName) \
+	GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
+	GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
+
+/**
+ * Native counterpart of the GBA_Test_HealthSet fixture (AttributeBasedClamping), used as a baseline by benchmarks.
+ *
+ * Same attributes and default values, with Health clamped between MinHealth and MaxHealth the way a native set
+ * usually does it (in PreAttributeChange() for current value, and PostGameplayEffectExecute() for base value).
+ */
+UCLASS()
+class BLUEPRINTATTRIBUTESTESTS_API UGBATestsNativeHealthSet : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	UGBATestsNativeHealthSet();
+
+	UPROPERTY(BlueprintReadOnly, Category = "Health")
+	FGameplayAttributeData Health;
+	GBA_TESTS_ATTRIBUTE_ACCESSORS(UGBATestsNativeHealthSet, Health)
+
+	UPROPERTY(BlueprintReadOnly, Category = "Health")
+	FGameplayAttributeData MinHealth;
+	GBA_TESTS_ATTRIBUTE_ACCESSORS(UGBATestsNativeHealthSet, MinHealth)
+
+	UPROPERTY(BlueprintReadOnly, Category = "Health")
+	FGameplayAttributeData MaxHealth;
+	GBA_TESTS_ATTRIBUTE_ACCESSORS(UGBATestsNativeHealthSet, MaxHealth)
+
+	//~ Begin UAttributeSet interface
+	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
+	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
+	//~ End UAttributeSet interface
+};
@@ -0,0 +1,92 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+class UGameplayEffect;
+
+/** Stat updates are compiled out of Shipping builds, whatever STATS and CSV_PROFILER are */
+#define GBA_TESTS_STATS_ENABLED ((STATS || CSV_PROFILER) && !UE_BUILD_SHIPPING)
+
+/** "stat BlueprintAttributes" */
+DECLARE_STATS_GROUP(TEXT("BlueprintAttributes"), STATGROUP_BlueprintAttributes, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Effect Apply"), STAT_GBA_EffectApply, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PostGameplayEffectExecute (instrumented native set)"), STAT_GBA_GameplayEffectExecute, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PreAttributeChange (instrumented native set)"), STAT_GBA_AttributeChange, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Storage Record"), STAT_GBA_StorageRecord, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Clamp"), STAT_GBA_Clamp, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Init (Baked)"), STAT_GBA_InitBaked, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Init (DataTable)"), STAT_GBA_InitDataTable, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Attribute Writes"), STAT_GBA_AttributeWrites, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Gameplay Effect Executions"), STAT_GBA_GameplayEffectExecutions, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Blueprint Attribute Sets"), STAT_GBA_NumAttributeSets, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Blueprint Attribute Sets Memory"), STAT_GBA_AttributeSetsMemory, STATGROUP_BlueprintAttributes, BLUEPRINTATTRIBUTESTESTS_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(BLUEPRINTATTRIBUTESTESTS_API, BlueprintAttributes);
+
+/**
+ * In-game numbers for Blueprint attribute sets: "stat BlueprintAttributes" cycle stats and counters, and CSV
+ * profiler custom stats (-csvprofile) in the BlueprintAttributes category, including time spent per attribute
+ * set class.
+ *
+ * Stats sit where this module does the work: effect application (enclosing Blueprint event dispatch by the runtime
+ * plugin), init, payload records to the tests storage and UGBATestsInstrumentedHealthSet callbacks. Counters are
+ * updated on paths every attribute set goes through, Blueprint or native: attribute writes per modifier of applied
+ * effects and per baked init value, Gameplay Effect executions per instant effect applied (see CountEffectApplication()).
+ *
+ * Live UGBAAttributeSetBlueprintBase instances and their memory are sampled once per second, only while stats
+ * are collected or a CSV capture is running.
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsStats
+{
+	/** Accumulates the scope duration into the CSV stat of InClass, when capturing */
+	class FCsvScope
+	{
+	public:
+		explicit FCsvScope(const UClass* InClass);
+		~FCsvScope();
+
+		UE_NONCOPYABLE(FCsvScope);
+
+	private:
+		FName StatName;
+		uint64 StartCycles = 0;
+	};
+
+	/** Starts / stops live instances sampling (module startup and shutdown) */
+	static void Initialize();
+	static void Shutdown();
+
+	/**
+	 * Counts an effect applied through this module (FGBATestsGameplayEffectCache::Apply(), spec helpers): a write per
+	 * modifier and, for instant effects, an execution. Executions of periodic effects are not counted.
+	 */
+	static void CountEffectApplication(const UGameplayEffect& InEffect);
+
+	/** Counts live UGBAAttributeSetBlueprintBase instances (CDOs excluded) and their property memory, and reports them */
+	static void SampleAttributeSets(int32& OutNum, int64& OutBytes);
+};
+
+#if GBA_TESTS_STATS_ENABLED
+
+/** Cycle stat and per class CSV timing of a scope */
+#define GBA_TESTS_STAT_SCOPE(Stat, Class) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	FGBATestsStats::FCsvScope PREPROCESSOR_JOIN(GBATestsCsvScope_, __LINE__)(Class)
+
+/** Per frame counter, in both stats and CSV */
+#define GBA_TESTS_STAT_INC(Stat, CsvStat) \
+	INC_DWORD_STAT(Stat); \
+	CSV_CUSTOM_STAT(BlueprintAttributes, CsvStat, 1, ECsvCustomStatOp::Accumulate)
+
+#else
+
+#define GBA_TESTS_STAT_SCOPE(Stat, Class)
+#define GBA_TESTS_STAT_INC(Stat, CsvStat)
+
+#endif
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GBATestsEventRecorder.h"
 #include "GBATestsStorageTypes.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "GBATestsStorageSubsystem.generated.h"
@@ -10,6 +11,9 @@
 /**
  * Test oriented world subsystem to store arbitrary value, and be able to check execution of
  * things and assert expected values.
+ *
+ * GetValueAs*Payload() return the last payload set with that key. Every Set*Payload() call is also appended to an
+ * FGBATestsEventRecorder, which keeps the order and timing of recent events.
  */
 UCLASS(DisplayName = "Tests Storage")
 class BLUEPRINTATTRIBUTESTESTS_API UGBATestsStorageSubsystem : public UEngineSubsystem
@@ -65,6 +69,10 @@ public:
 	UFUNCTION(BlueprintPure, Category="Blueprint Attributes Tests")
 	FGBATestStorage_PostAttributeBaseChangePayload GetValueAsPostAttributeBaseChangePayload(const FName Key) const;
 
+	/** Every payload set since last reset, in order */
+	FGBATestsEventRecorder& GetRecorder() { return Recorder; }
+	const FGBATestsEventRecorder& GetRecorder() const { return Recorder; }
+
 private:
 	// TODO: Store only FTestStorageBlueprintData types (but has to resort to static const_cast shenanigans)
 	TMap<FName, FGBATestStorage_PreGameplayEffectExecutePayload> StorePreGameplayEffectExecutePayload;
@@ -73,4 +81,6 @@ private:
 	TMap<FName, FGBATestStorage_PostAttributeChangePayload> StorePostAttributeChangePayload;
 	TMap<FName, FGBATestStorage_PreAttributeBaseChangePayload> StorePreAttributeBaseChangePayload;
 	TMap<FName, FGBATestStorage_PostAttributeBaseChangePayload> StorePostAttributeBaseChangePayload;
+
+	FGBATestsEventRecorder Recorder;
 };
@@ -0,0 +1,112 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+#if UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED
+#define GBA_TESTS_TRACE_ENABLED 1
+#else
+#define GBA_TESTS_TRACE_ENABLED 0
+#endif
+
+struct FGameplayAttribute;
+
+/** Steps of the attribute change pipeline traced on the GBATests channel */
+enum class EGBATestsTraceEvent : uint8
+{
+	/**
+	 * Gameplay Effect application by this module (FGBATestsGameplayEffectCache::Apply(), spec helpers), enclosing
+	 * every attribute set callback it triggers, Blueprint events included
+	 */
+	EffectApply,
+
+	/** UGBATestsInstrumentedHealthSet::PostGameplayEffectExecute() */
+	GameplayEffectExecute,
+
+	/** UGBATestsInstrumentedHealthSet::PreAttributeChange() */
+	AttributeChange,
+
+	/** Clamping against other attributes (eg. Health between MinHealth and MaxHealth) */
+	AttributeClamp,
+
+	/** Attribute set init from a FAttributeMetaData DataTable */
+	DataTableInit,
+
+	/** FAttributeMetaData row lookup for an attribute */
+	MetaDataLookup,
+
+	/**
+	 * Payload appends to the tests storage, made by fixture attribute sets from their Blueprint events. These only time
+	 * the record, the events themselves are dispatched by the runtime plugin (and enclosed by EffectApply).
+	 */
+	RecordPreGameplayEffectExecute,
+	RecordPostGameplayEffectExecute,
+	RecordPreAttributeChange,
+	RecordPostAttributeChange,
+	RecordPreAttributeBaseChange,
+	RecordPostAttributeBaseChange,
+
+	Num
+};
+
+#if GBA_TESTS_TRACE_ENABLED
+
+/** Enable with -trace=cpu,GBATests (or "Trace.Enable GBATests" at runtime) */
+UE_TRACE_CHANNEL_EXTERN(GBATestsChannel, BLUEPRINTATTRIBUTESTESTS_API);
+
+/**
+ * Unreal Insights CPU events for the attribute change pipeline, named after the event, attribute set class and
+ * attribute (eg. "GBA GameplayEffectExecute UGBATestsInstrumentedHealthSet.Health").
+ *
+ * Event names are registered with the trace once per (event, class, attribute) and cached, when the channel is off
+ * scopes only check the channel.
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsTrace
+{
+	class FScope
+	{
+	public:
+		FScope(EGBATestsTraceEvent InEvent, const FGameplayAttribute& InAttribute);
+		FScope(EGBATestsTraceEvent InEvent, const UClass* InClass, FName InAttributeName = NAME_None);
+		~FScope();
+
+		UE_NONCOPYABLE(FScope);
+
+	private:
+		EGBATestsTraceEvent Event;
+		bool bEnabled = false;
+	};
+
+	static bool IsEnabled()
+	{
+		return UE_TRACE_CHANNELEXPR_IS_ENABLED(GBATestsChannel);
+	}
+
+	/** Number of scopes emitted per event since the last reset, while the channel was enabled */
+	static uint64 GetNumEmitted(EGBATestsTraceEvent InEvent);
+
+	/** Number of InEvent scopes emitted while an InEnclosingEvent scope was open on the same thread */
+	static uint64 GetNumEmittedWithin(EGBATestsTraceEvent InEvent, EGBATestsTraceEvent InEnclosingEvent);
+
+	static void ResetNumEmitted();
+
+	static const TCHAR* LexToString(EGBATestsTraceEvent InEvent);
+
+private:
+	/** Trace event type registered for (InEvent, InClassName, InAttributeName), created on first use */
+	static uint32 GetEventSpecId(EGBATestsTraceEvent InEvent, FName InClassName, FName InAttributeName);
+
+	static void BeginEvent(EGBATestsTraceEvent InEvent, FName InClassName, FName InAttributeName);
+	static void EndEvent(EGBATestsTraceEvent InEvent);
+};
+
+#define GBA_TESTS_TRACE_SCOPE(Event, ...) FGBATestsTrace::FScope PREPROCESSOR_JOIN(GBATestsTraceScope_, __LINE__)(EGBATestsTraceEvent::Event, ##__VA_ARGS__)
+
+#else
+
+#define GBA_TESTS_TRACE_SCOPE(Event, ...)
+
+#endif
@@ -0,0 +1,31 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAbilitySystemComponent;
+class UWorld;
+
+/**
+ * Fast-forwards a test world for ability system timers only.
+ *
+ * Instead of ticking the whole world in fixed steps, time jumps straight to the next pending period or duration
+ * timer of the given ASCs' active effects, and only the world timer manager is ticked. World time is advanced
+ * along, as effect durations are checked against it.
+ *
+ * Like FGBAAttributeSetSpecBase::TickWorld(), each step bumps GFrameCounter (the timer manager ticks at most once
+ * per frame). It isn't rewound after each advance: a frame counter going back to one the timer manager already
+ * ticked would have it skip a later tick. Restore it once the world is torn down instead.
+ */
+struct BLUEPRINTATTRIBUTESTESTS_API FGBATestsVirtualClock
+{
+	/**
+	 * Advances InWorld by InSeconds, stepping from one active effect timer of InASCs to the next. Other timers
+	 * still fire, but are not stepped on (looping ones catch up). Returns the number of steps taken.
+	 */
+	static int32 Advance(UWorld* InWorld, float InSeconds, TArrayView<const UAbilitySystemComponent* const> InASCs);
+
+	/** Time until the next period or duration timer of InASCs' active effects, or -1 if there is none */
+	static float GetTimeUntilNextEvent(const UWorld* InWorld, TArrayView<const UAbilitySystemComponent* const> InASCs);
+};
@@ -16,12 +16,17 @@ public class BlueprintAttributesTestsEditor : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry",
+				"BlueprintAttributes",
 				"BlueprintAttributesEditor",
 				"BlueprintAttributesTests",
 				"BlueprintGraph",
 				"CoreUObject",
+				"EditorSubsystem",
 				"Engine",
 				"GameplayAbilities",
+				"Json",
+				"JsonUtilities",
 				"Slate",
 				"SlateCore",
 				"UnrealEd"
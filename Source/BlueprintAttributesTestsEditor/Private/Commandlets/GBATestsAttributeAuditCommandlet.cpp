@@ -0,0 +1,70 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "Commandlets/GBATestsAttributeAuditCommandlet.h"
+
+#include "GBATestsAttributeAudit.h"
+#include "GBATestsLog.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+UGBATestsAttributeAuditCommandlet::UGBATestsAttributeAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UGBATestsAttributeAuditCommandlet::Main(const FString& Params)
+{
+	FGBATestsAttributeAudit::FOptions Options;
+
+	FString PathsParam;
+	if (FParse::Value(*Params, TEXT("Paths="), PathsParam))
+	{
+		TArray<FString> Paths;
+		PathsParam.ParseIntoArray(Paths, TEXT("+"));
+
+		Options.Paths.Reset();
+		for (const FString& Path : Paths)
+		{
+			Options.Paths.Add(FName(*Path));
+		}
+	}
+
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FString ReportFilename = FGBATestsAttributeAudit::GetDefaultReportFilename();
+	FParse::Value(*Params, TEXT("Report="), ReportFilename);
+
+	const bool bDanglingOnly = FParse::Param(*Params, TEXT("DanglingOnly"));
+
+	// Candidates are computed from the asset registry only, make sure it is complete
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FGBATestsAttributeAudit Audit;
+	Audit.GatherCandidates(Options);
+	GBA_TESTS_LOG(Display, TEXT("UGBATestsAttributeAuditCommandlet - %d candidate packages"), Audit.GetCandidates().Num())
+
+	Audit.Run(Options);
+
+	if (!Audit.WriteReport(ReportFilename, bDanglingOnly))
+	{
+		GBA_TESTS_LOG(Error, TEXT("UGBATestsAttributeAuditCommandlet - Failed to write report %s"), *ReportFilename)
+		return 1;
+	}
+
+	const int32 NumDangling = Audit.GetNumDangling();
+	GBA_TESTS_LOG(
+		Display,
+		TEXT("UGBATestsAttributeAuditCommandlet - %d references, %d dangling, in %.1f s. Report: %s"),
+		Audit.GetEntries().Num(),
+		NumDangling,
+		FPlatformTime::Seconds() - StartTime,
+		*ReportFilename
+	)
+
+	return NumDangling > 0 ? 1 : 0;
+}
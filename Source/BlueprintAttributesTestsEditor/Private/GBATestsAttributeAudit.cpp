@@ -0,0 +1,481 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeAudit.h"
+
+#include "AttributeSet.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectCalculation.h"
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsAttributeReferenceSubsystem.h"
+#include "GBATestsLog.h"
+#include "Algo/Count.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DataTable.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Subsystems/GBAEditorSubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+#include "Utils/GBAUtils.h"
+
+void FGBATestsAttributeAuditCatalogue::AddAttribute(const FName& InPackage, const FString& InSetName, const FString& InAttributeName)
+{
+	bool bAlreadyInSet = false;
+	AttributesByPackage.FindOrAdd(InPackage).Add(InAttributeName, &bAlreadyInSet);
+	AttributesBySetName.FindOrAdd(InSetName).Add(InAttributeName);
+
+	NumAttributes += bAlreadyInSet ? 0 : 1;
+}
+
+void FGBATestsAttributeAuditCatalogue::AddAttributeSet(const UClass* InClass)
+{
+	if (!FGBAUtils::IsValidAttributeClass(InClass))
+	{
+		return;
+	}
+
+	const FName Package = InClass->GetOutermost()->GetFName();
+	const FString SetName = FGBAUtils::GetAttributeClassName(InClass);
+
+	for (TFieldIterator<FProperty> PropertyIt(InClass, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+	{
+		if (FGBAUtils::IsValidProperty(*PropertyIt))
+		{
+			AddAttribute(Package, SetName, PropertyIt->GetName());
+		}
+	}
+}
+
+void FGBATestsAttributeAuditCatalogue::AddLoadedAttributeSets()
+{
+	check(IsInGameThread());
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		AddAttributeSet(*It);
+	}
+}
+
+bool FGBATestsAttributeAuditCatalogue::IsValidForPackage(const FName& InPackage, const FString& InAttributeName) const
+{
+	const TSet<FString>* Attributes = AttributesByPackage.Find(InPackage);
+	return Attributes && Attributes->Contains(InAttributeName);
+}
+
+bool FGBATestsAttributeAuditCatalogue::IsValidForSetName(const FString& InSetName, const FString& InAttributeName) const
+{
+	const TSet<FString>* Attributes = AttributesBySetName.Find(InSetName);
+	return Attributes && Attributes->Contains(InAttributeName);
+}
+
+void FGBATestsAttributeAudit::GatherCandidates(const FOptions& InOptions)
+{
+	Candidates.Reset();
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	const auto IsInAuditedPaths = [&InOptions](const FName& InPackageName)
+	{
+		const FString PackageName = InPackageName.ToString();
+		return InOptions.Paths.ContainsByPredicate([&PackageName](const FName& InPath)
+		{
+			return PackageName.StartsWith(InPath.ToString() + TEXT("/"));
+		});
+	};
+
+	TSet<FName> CandidateSet;
+
+	// Attribute sets (native and Blueprint), whose referencers may store FGameplayAttribute values
+	TSet<FTopLevelAssetPath> AttributeSetClasses;
+	AssetRegistry.GetDerivedClassNames({ UAttributeSet::StaticClass()->GetClassPathName() }, {}, AttributeSetClasses);
+
+	AttributeSetClassPaths.Reset();
+	TSet<FName> AttributeSetPackages;
+	for (const FTopLevelAssetPath& ClassPath : AttributeSetClasses)
+	{
+		AttributeSetPackages.Add(ClassPath.GetPackageName());
+
+		// Same as FGBAUtils::GetAttributeClassName(), without loading the class
+		FString SetName = ClassPath.GetAssetName().ToString();
+		SetName.RemoveFromEnd(TEXT("_C"));
+		AttributeSetClassPaths.Add(MoveTemp(SetName), ClassPath);
+	}
+
+	for (const FName& AttributeSetPackage : AttributeSetPackages)
+	{
+		if (IsInAuditedPaths(AttributeSetPackage))
+		{
+			CandidateSet.Add(AttributeSetPackage);
+		}
+
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(AttributeSetPackage, Referencers);
+		for (const FName& Referencer : Referencers)
+		{
+			if (IsInAuditedPaths(Referencer))
+			{
+				CandidateSet.Add(Referencer);
+			}
+		}
+	}
+
+	// Gameplay effects and calculations may only reference native attribute sets, which packages are not dependencies
+	TSet<FTopLevelAssetPath> EffectClasses;
+	AssetRegistry.GetDerivedClassNames(
+		{ UGameplayEffect::StaticClass()->GetClassPathName(), UGameplayEffectCalculation::StaticClass()->GetClassPathName() },
+		{},
+		EffectClasses
+	);
+
+	for (const FTopLevelAssetPath& ClassPath : EffectClasses)
+	{
+		if (IsInAuditedPaths(ClassPath.GetPackageName()))
+		{
+			CandidateSet.Add(ClassPath.GetPackageName());
+		}
+	}
+
+	// Attribute init DataTables
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
+	Filter.PackagePaths = InOptions.Paths;
+	Filter.bRecursivePaths = true;
+	Filter.TagsAndValues.Add(TEXT("RowStructure"), FAttributeMetaData::StaticStruct()->GetPathName());
+
+	TArray<FAssetData> DataTables;
+	AssetRegistry.GetAssets(Filter, DataTables);
+	for (const FAssetData& DataTable : DataTables)
+	{
+		CandidateSet.Add(DataTable.PackageName);
+	}
+
+	Candidates = CandidateSet.Array();
+	Candidates.Sort(FNameLexicalLess());
+}
+
+void FGBATestsAttributeAudit::Run(const FOptions& InOptions)
+{
+	check(IsInGameThread());
+
+	Entries.Reset();
+	Catalogue = FGBATestsAttributeAuditCatalogue();
+
+	PreloadedPackages.Reset();
+	LoadedPackages.Reset();
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		PreloadedPackages.Add(It->GetFName());
+	}
+
+	const int32 BatchSize = FMath::Max(InOptions.BatchSize, 1);
+	for (int32 BatchStart = 0; BatchStart < Candidates.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Candidates.Num());
+
+		// Issue every load of the batch before waiting, so that IO and serialization overlap
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			RequestPackage(Candidates[Index].ToString());
+		}
+
+		FlushAsyncLoading();
+
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			const UPackage* Package = FindPackage(nullptr, *Candidates[Index].ToString());
+			if (!Package)
+			{
+				GBA_TESTS_LOG(Warning, TEXT("FGBATestsAttributeAudit::Run - Failed to load %s"), *Candidates[Index].ToString())
+				continue;
+			}
+
+			ForEachObjectWithPackage(Package, [this](UObject* Object)
+			{
+				GatherObjectEntries(Object, Entries);
+				return true;
+			}, true, RF_NoFlags);
+		}
+
+		// Attribute sets have to outlive GC for validation, record them before letting the batch go
+		Catalogue.AddLoadedAttributeSets();
+		ReleaseLoadedPackages();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		GBA_TESTS_LOG(Display, TEXT("FGBATestsAttributeAudit::Run - %d / %d packages, %d references"), BatchEnd, Candidates.Num(), Entries.Num())
+	}
+
+	// Native attribute sets referenced by nothing in the audited paths are still valid owners
+	Catalogue.AddLoadedAttributeSets();
+	ResolveDataTableOwners();
+	ReleaseLoadedPackages();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	ParsePinEntries(Entries);
+	Validate(Catalogue, Entries);
+}
+
+void FGBATestsAttributeAudit::ResolveDataTableOwners()
+{
+	TSet<FString> Resolved;
+	for (const FGBATestsAttributeAuditEntry& Entry : Entries)
+	{
+		if (Entry.Source != EGBATestsAttributeAuditSource::DataTableRow || Entry.Owner.IsEmpty() || Catalogue.HasSetName(Entry.Owner))
+		{
+			continue;
+		}
+
+		bool bAlreadyResolved = false;
+		Resolved.Add(Entry.Owner, &bAlreadyResolved);
+		if (bAlreadyResolved)
+		{
+			continue;
+		}
+
+		// Unknown set names are left for Validate() to flag
+		const FTopLevelAssetPath* ClassPath = AttributeSetClassPaths.Find(Entry.Owner);
+		if (!ClassPath)
+		{
+			continue;
+		}
+
+		const bool bWasLoaded = PreloadedPackages.Contains(ClassPath->GetPackageName()) || FindPackage(nullptr, *ClassPath->GetPackageName().ToString());
+		const UClass* Class = LoadObject<UClass>(nullptr, *ClassPath->ToString());
+		if (!Class)
+		{
+			GBA_TESTS_LOG(Warning, TEXT("FGBATestsAttributeAudit::ResolveDataTableOwners - Failed to load %s"), *ClassPath->ToString())
+			continue;
+		}
+
+		if (!bWasLoaded)
+		{
+			LoadedPackages.Add(Class->GetPackage());
+		}
+
+		Catalogue.AddAttributeSet(Class);
+	}
+}
+
+void FGBATestsAttributeAudit::RequestPackage(const FString& InPackageName)
+{
+	LoadPackageAsync(InPackageName, FLoadPackageAsyncDelegate::CreateLambda([this](const FName& InLoadedName, UPackage* InPackage, const EAsyncLoadingResult::Type InResult)
+	{
+		if (InResult == EAsyncLoadingResult::Succeeded && InPackage && !PreloadedPackages.Contains(InLoadedName))
+		{
+			LoadedPackages.Add(InPackage);
+		}
+	}));
+}
+
+void FGBATestsAttributeAudit::ReleaseLoadedPackages()
+{
+	// Loaded assets are RF_Standalone, which keeps them around across GC until cleared. Only packages requested by
+	// the audit: FlushAsyncLoading() also completes loads others started meanwhile.
+	for (const TWeakObjectPtr<UPackage>& WeakPackage : LoadedPackages)
+	{
+		UPackage* Package = WeakPackage.Get();
+		if (!Package || Package->IsDirty())
+		{
+			continue;
+		}
+
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		}, true, RF_NoFlags);
+	}
+
+	LoadedPackages.Reset();
+}
+
+void FGBATestsAttributeAudit::Validate(const FGBATestsAttributeAuditCatalogue& InCatalogue, TArray<FGBATestsAttributeAuditEntry>& InOutEntries)
+{
+	ParallelFor(InOutEntries.Num(), [&InCatalogue, &InOutEntries](const int32 Index)
+	{
+		FGBATestsAttributeAuditEntry& Entry = InOutEntries[Index];
+		if (Entry.AttributeName.IsEmpty() || Entry.Owner.IsEmpty())
+		{
+			Entry.bDangling = true;
+			return;
+		}
+
+		Entry.bDangling = Entry.Source == EGBATestsAttributeAuditSource::DataTableRow
+			? !InCatalogue.IsValidForSetName(Entry.Owner, Entry.AttributeName)
+			: !InCatalogue.IsValidForPackage(FName(*Entry.Owner), Entry.AttributeName);
+	});
+}
+
+void FGBATestsAttributeAudit::ParsePinEntries(TArray<FGBATestsAttributeAuditEntry>& InOutEntries)
+{
+	ParallelFor(InOutEntries.Num(), [&InOutEntries](const int32 Index)
+	{
+		FGBATestsAttributeAuditEntry& Entry = InOutEntries[Index];
+		if (Entry.Source != EGBATestsAttributeAuditSource::K2Pin || Entry.RawValue.IsEmpty())
+		{
+			return;
+		}
+
+		FString PackageName;
+		FString AttributeName;
+		UGBAEditorSubsystem::ParseAttributeFromDefaultValue(Entry.RawValue, PackageName, AttributeName);
+
+		const FName OwnerPackage = UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(PackageName);
+		Entry.Owner = OwnerPackage.IsNone() ? FString() : OwnerPackage.ToString();
+		Entry.AttributeName = MoveTemp(AttributeName);
+		Entry.RawValue.Empty();
+	});
+}
+
+void FGBATestsAttributeAudit::GatherObjectEntries(const UObject* InObject, TArray<FGBATestsAttributeAuditEntry>& OutEntries)
+{
+	if (!InObject)
+	{
+		return;
+	}
+
+	// Skeleton and reinstanced classes hold stale copies of the same data
+	const UClass* ObjectClass = InObject->GetClass();
+	if (FKismetEditorUtilities::IsClassABlueprintSkeleton(ObjectClass) || ObjectClass->HasAnyClassFlags(CLASS_NewerVersionExists))
+	{
+		return;
+	}
+
+	const FName Package = InObject->GetOutermost()->GetFName();
+
+	if (const UDataTable* DataTable = Cast<UDataTable>(InObject))
+	{
+		GatherDataTableEntries(DataTable, OutEntries);
+		return;
+	}
+
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(InObject))
+	{
+		// Pins are only copied here, parsing happens later on in parallel
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+
+		for (const UEdGraph* Graph : Graphs)
+		{
+			if (!Graph)
+			{
+				continue;
+			}
+
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+				{
+					continue;
+				}
+
+				for (const UEdGraphPin* Pin : Node->Pins)
+				{
+					if (!FGBATestsAttributePinParser::IsAttributePin(Pin) || Pin->DefaultValue.IsEmpty())
+					{
+						continue;
+					}
+
+					FGBATestsAttributeAuditEntry& Entry = OutEntries.AddDefaulted_GetRef();
+					Entry.Source = EGBATestsAttributeAuditSource::K2Pin;
+					Entry.Package = Package;
+					Entry.Location = FString::Printf(TEXT("%s > %s > %s"), *Graph->GetName(), *Node->GetName(), *Pin->PinName.ToString());
+					Entry.RawValue = Pin->DefaultValue;
+				}
+			}
+		}
+
+		return;
+	}
+
+	TArray<FGBATestsAttributeReference> References;
+	UGBATestsAttributeReferenceSubsystem::CollectPropertyReferences(InObject, References);
+	for (const FGBATestsAttributeReference& Reference : References)
+	{
+		FGBATestsAttributeAuditEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Source = EGBATestsAttributeAuditSource::Property;
+		Entry.Package = Package;
+		Entry.Location = Reference.Location;
+		Entry.Owner = Reference.OwnerPackage.IsNone() ? FString() : Reference.OwnerPackage.ToString();
+		Entry.AttributeName = Reference.AttributeName.ToString();
+	}
+}
+
+void FGBATestsAttributeAudit::GatherDataTableEntries(const UDataTable* InDataTable, TArray<FGBATestsAttributeAuditEntry>& OutEntries)
+{
+	if (!InDataTable || InDataTable->GetRowStruct() != FAttributeMetaData::StaticStruct())
+	{
+		return;
+	}
+
+	const FName Package = InDataTable->GetOutermost()->GetFName();
+	for (const FName& RowName : InDataTable->GetRowNames())
+	{
+		FString SetName;
+		FString AttributeName;
+		RowName.ToString().Split(TEXT("."), &SetName, &AttributeName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+
+		FGBATestsAttributeAuditEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Source = EGBATestsAttributeAuditSource::DataTableRow;
+		Entry.Package = Package;
+		Entry.Location = FString::Printf(TEXT("%s > %s"), *InDataTable->GetName(), *RowName.ToString());
+		Entry.Owner = MoveTemp(SetName);
+		Entry.AttributeName = MoveTemp(AttributeName);
+	}
+}
+
+bool FGBATestsAttributeAudit::WriteReport(const FString& InFilename, const bool bInDanglingOnly) const
+{
+	TStringBuilder<4096> Report;
+	Report.Appendf(TEXT("# %d candidates, %d references, %d dangling\n"), Candidates.Num(), Entries.Num(), GetNumDangling());
+	Report.Append(TEXT("Status,Source,Package,Location,Owner,Attribute\n"));
+
+	for (const FGBATestsAttributeAuditEntry& Entry : Entries)
+	{
+		if (bInDanglingOnly && !Entry.bDangling)
+		{
+			continue;
+		}
+
+		Report.Appendf(
+			TEXT("%s,%s,%s,\"%s\",%s,%s\n"),
+			Entry.bDangling ? TEXT("Dangling") : TEXT("Ok"),
+			LexToString(Entry.Source),
+			*Entry.Package.ToString(),
+			*Entry.Location.Replace(TEXT("\""), TEXT("'")),
+			*Entry.Owner,
+			*Entry.AttributeName
+		);
+	}
+
+	return FFileHelper::SaveStringToFile(Report.ToView(), *InFilename);
+}
+
+int32 FGBATestsAttributeAudit::GetNumDangling() const
+{
+	return Algo::CountIf(Entries, [](const FGBATestsAttributeAuditEntry& Entry) { return Entry.bDangling; });
+}
+
+FString FGBATestsAttributeAudit::GetDefaultReportFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("BlueprintAttributesTests") / TEXT("AttributeAudit.csv");
+}
+
+const TCHAR* FGBATestsAttributeAudit::LexToString(const EGBATestsAttributeAuditSource InSource)
+{
+	switch (InSource)
+	{
+	case EGBATestsAttributeAuditSource::K2Pin:
+		return TEXT("K2Pin");
+	case EGBATestsAttributeAuditSource::Property:
+		return TEXT("Property");
+	case EGBATestsAttributeAuditSource::DataTableRow:
+		return TEXT("DataTableRow");
+	}
+
+	return TEXT("Unknown");
+}
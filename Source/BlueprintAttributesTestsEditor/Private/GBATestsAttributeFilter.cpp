@@ -0,0 +1,157 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeFilter.h"
+
+#include "Misc/ScopeRWLock.h"
+
+FRWLock FGBATestsAttributeFilter::CacheLock;
+TArray<FString> FGBATestsAttributeFilter::CachedFilters;
+TSharedPtr<const FGBATestsAttributeFilterTrie> FGBATestsAttributeFilter::CachedTrie;
+std::atomic<uint32> FGBATestsAttributeFilter::Generation(0);
+
+FGBATestsAttributeFilterTrie::FGBATestsAttributeFilterTrie(const TArray<FString>& InFilters)
+{
+	Nodes.AddDefaulted();
+
+	for (const FString& Filter : InFilters)
+	{
+		// Empty filters never match (FString::StartsWith() returns false for an empty prefix)
+		if (Filter.IsEmpty())
+		{
+			continue;
+		}
+
+		int32 NodeIndex = 0;
+		for (const TCHAR Char : Filter)
+		{
+			NodeIndex = FindOrAddChild(NodeIndex, FChar::ToLower(Char));
+		}
+
+		Nodes[NodeIndex].bTerminal = true;
+	}
+}
+
+bool FGBATestsAttributeFilterTrie::IsFiltered(const FStringView InAttributeName) const
+{
+	int32 NodeIndex = 0;
+	for (const TCHAR Char : InAttributeName)
+	{
+		NodeIndex = FindChild(NodeIndex, FChar::ToLower(Char));
+		if (NodeIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Any filter ending here is a prefix of the attribute name
+		if (Nodes[NodeIndex].bTerminal)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 FGBATestsAttributeFilterTrie::FindChild(const int32 InNodeIndex, const TCHAR InChar) const
+{
+	int32 ChildIndex = Nodes[InNodeIndex].FirstChild;
+	while (ChildIndex != INDEX_NONE && Nodes[ChildIndex].Char != InChar)
+	{
+		ChildIndex = Nodes[ChildIndex].NextSibling;
+	}
+
+	return ChildIndex;
+}
+
+int32 FGBATestsAttributeFilterTrie::FindOrAddChild(const int32 InNodeIndex, const TCHAR InChar)
+{
+	const int32 ExistingIndex = FindChild(InNodeIndex, InChar);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	const int32 ChildIndex = Nodes.AddDefaulted();
+	FNode& Child = Nodes[ChildIndex];
+	Child.Char = InChar;
+	Child.NextSibling = Nodes[InNodeIndex].FirstChild;
+	Nodes[InNodeIndex].FirstChild = ChildIndex;
+	return ChildIndex;
+}
+
+FGBATestsAttributeFilter::FHandle::FHandle(const TArray<FString>& InFilters)
+	: Filters(InFilters)
+{
+}
+
+bool FGBATestsAttributeFilter::FHandle::IsFiltered(const FStringView InAttributeName)
+{
+	if (Filters.IsEmpty())
+	{
+		return false;
+	}
+
+	const uint32 CurrentGeneration = GetGeneration();
+	if (Generation != CurrentGeneration || !Trie.IsValid())
+	{
+		Trie = MakeShared<const FGBATestsAttributeFilterTrie>(Filters);
+		Generation = CurrentGeneration;
+	}
+
+	return Trie->IsFiltered(InAttributeName);
+}
+
+TSharedRef<const FGBATestsAttributeFilterTrie> FGBATestsAttributeFilter::GetTrie(const TArray<FString>& InFilters)
+{
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		if (CachedTrie.IsValid() && CachedFilters == InFilters)
+		{
+			return CachedTrie.ToSharedRef();
+		}
+	}
+
+	TSharedRef<const FGBATestsAttributeFilterTrie> Trie = MakeShared<const FGBATestsAttributeFilterTrie>(InFilters);
+
+	FWriteScopeLock WriteLock(CacheLock);
+	CachedFilters = InFilters;
+	CachedTrie = Trie;
+	return Trie;
+}
+
+bool FGBATestsAttributeFilter::IsAttributeFiltered(const TArray<FString>& InFilters, const FString& InAttributeName)
+{
+	if (InFilters.IsEmpty())
+	{
+		return false;
+	}
+
+	return GetTrie(InFilters)->IsFiltered(InAttributeName);
+}
+
+void FGBATestsAttributeFilter::FilterAttributes(const TArray<FString>& InFilters, TArray<FString>& InOutAttributeNames)
+{
+	if (InFilters.IsEmpty() || InOutAttributeNames.IsEmpty())
+	{
+		return;
+	}
+
+	const TSharedRef<const FGBATestsAttributeFilterTrie> Trie = GetTrie(InFilters);
+	InOutAttributeNames.RemoveAll([&Trie](const FString& AttributeName)
+	{
+		return Trie->IsFiltered(AttributeName);
+	});
+}
+
+void FGBATestsAttributeFilter::ResetCache()
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	CachedFilters.Empty();
+	CachedTrie.Reset();
+	Generation.fetch_add(1, std::memory_order_release);
+}
+
+uint32 FGBATestsAttributeFilter::GetGeneration()
+{
+	return Generation.load(std::memory_order_acquire);
+}
@@ -0,0 +1,220 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeIndex.h"
+
+#include "GBATestsAttributeFilter.h"
+#include "Algo/StableSort.h"
+#include "Async/Async.h"
+#include "String/Find.h"
+#include "Utils/GBAUtils.h"
+
+TSharedPtr<const FGBATestsAttributeIndex> FGBATestsAttributeIndex::CachedIndex;
+TArray<FString> FGBATestsAttributeIndex::CachedFilters;
+uint32 FGBATestsAttributeIndex::Generation = 0;
+TArray<FGBATestsAttributeIndex::FOnIndexReady> FGBATestsAttributeIndex::PendingRequests;
+bool FGBATestsAttributeIndex::bCachedBuildInFlight = false;
+
+void FGBATestsAttributeIndex::GatherSources(TArray<FGBATestsAttributeIndexSource>& OutSources)
+{
+	check(IsInGameThread());
+
+	TArray<FProperty*> Properties;
+	FGBAUtils::GetAllAttributeProperties(Properties);
+
+	OutSources.Reserve(OutSources.Num() + Properties.Num());
+	for (FProperty* Property : Properties)
+	{
+		if (!Property)
+		{
+			continue;
+		}
+
+		FGBATestsAttributeIndexSource& Source = OutSources.AddDefaulted_GetRef();
+		Source.Attribute = FGameplayAttribute(Property);
+		Source.SetName = FGBAUtils::GetAttributeClassName(Property->GetOwnerClass());
+		Source.AttributeName = Property->GetName();
+	}
+}
+
+TSharedRef<const FGBATestsAttributeIndex> FGBATestsAttributeIndex::Build(TArray<FGBATestsAttributeIndexSource>&& InSources, const TArray<FString>& InFilters)
+{
+	const TSharedRef<FGBATestsAttributeIndex> Index = MakeShared<FGBATestsAttributeIndex>();
+	const TSharedRef<const FGBATestsAttributeFilterTrie> Trie = FGBATestsAttributeFilter::GetTrie(InFilters);
+
+	Index->Entries.Reserve(InSources.Num());
+	for (FGBATestsAttributeIndexSource& Source : InSources)
+	{
+		FString DisplayName = MoveTemp(Source.SetName);
+		DisplayName.AppendChar(TEXT('.'));
+		DisplayName.Append(Source.AttributeName);
+
+		if (Trie->IsFiltered(DisplayName))
+		{
+			continue;
+		}
+
+		const TSharedRef<FGBATestsAttributeIndexEntry> Entry = MakeShared<FGBATestsAttributeIndexEntry>();
+		Entry->Attribute = MoveTemp(Source.Attribute);
+		Entry->SearchText = DisplayName.ToLower();
+		Entry->DisplayName = MoveTemp(DisplayName);
+		Index->Entries.Add(Entry);
+	}
+
+	Index->Entries.Sort([](const FGBATestsAttributeIndexEntryPtr& A, const FGBATestsAttributeIndexEntryPtr& B)
+	{
+		return A->SearchText < B->SearchText;
+	});
+
+	return Index;
+}
+
+void FGBATestsAttributeIndex::BuildAsync(TArray<FGBATestsAttributeIndexSource>&& InSources, const TArray<FString>& InFilters, FOnIndexReady InOnReady)
+{
+	check(IsInGameThread());
+
+	const uint32 StartGeneration = Generation;
+	Async(EAsyncExecution::ThreadPool, [Sources = MoveTemp(InSources), Filters = InFilters, OnReady = MoveTemp(InOnReady), StartGeneration]() mutable
+	{
+		TSharedRef<const FGBATestsAttributeIndex> Index = Build(MoveTemp(Sources), Filters);
+
+		AsyncTask(ENamedThreads::GameThread, [Index = MoveTemp(Index), OnReady = MoveTemp(OnReady), StartGeneration]()
+		{
+			if (StartGeneration == Generation)
+			{
+				OnReady.ExecuteIfBound(Index);
+			}
+		});
+	});
+}
+
+void FGBATestsAttributeIndex::RequestCached(const TArray<FString>& InFilters, FOnIndexReady InOnReady)
+{
+	check(IsInGameThread());
+
+	if (CachedFilters != InFilters)
+	{
+		CachedFilters = InFilters;
+		Invalidate();
+	}
+
+	if (CachedIndex.IsValid())
+	{
+		InOnReady.ExecuteIfBound(CachedIndex.ToSharedRef());
+		return;
+	}
+
+	PendingRequests.Add(MoveTemp(InOnReady));
+	if (!bCachedBuildInFlight)
+	{
+		StartCachedBuild();
+	}
+}
+
+TSharedPtr<const FGBATestsAttributeIndex> FGBATestsAttributeIndex::GetCached()
+{
+	return CachedIndex;
+}
+
+void FGBATestsAttributeIndex::Invalidate()
+{
+	check(IsInGameThread());
+
+	++Generation;
+	CachedIndex.Reset();
+	bCachedBuildInFlight = false;
+
+	// Requests waiting on the discarded build are served by a fresh one
+	if (!PendingRequests.IsEmpty())
+	{
+		StartCachedBuild();
+	}
+}
+
+void FGBATestsAttributeIndex::StartCachedBuild()
+{
+	bCachedBuildInFlight = true;
+
+	TArray<FGBATestsAttributeIndexSource> Sources;
+	GatherSources(Sources);
+
+	BuildAsync(MoveTemp(Sources), CachedFilters, FOnIndexReady::CreateLambda([](const TSharedRef<const FGBATestsAttributeIndex>& InIndex)
+	{
+		CachedIndex = InIndex;
+		bCachedBuildInFlight = false;
+
+		TArray<FOnIndexReady> Requests = MoveTemp(PendingRequests);
+		for (const FOnIndexReady& Request : Requests)
+		{
+			Request.ExecuteIfBound(InIndex);
+		}
+	}));
+}
+
+void FGBATestsAttributeIndex::Search(const FStringView InQuery, const TArray<FGBATestsAttributeIndexEntryPtr>& InCandidates, TArray<FGBATestsAttributeIndexEntryPtr>& OutResults)
+{
+	OutResults.Reset();
+
+	const FString LowerQuery = FString(InQuery.TrimStartAndEnd()).ToLower();
+	if (LowerQuery.IsEmpty())
+	{
+		OutResults = InCandidates;
+		return;
+	}
+
+	TArray<TPair<int32, FGBATestsAttributeIndexEntryPtr>> Scored;
+	for (const FGBATestsAttributeIndexEntryPtr& Candidate : InCandidates)
+	{
+		const int32 Score = ScoreMatch(LowerQuery, Candidate->SearchText);
+		if (Score != INDEX_NONE)
+		{
+			Scored.Emplace(Score, Candidate);
+		}
+	}
+
+	// Stable, so that equally scored entries keep their alphabetical order
+	Algo::StableSortBy(Scored, [](const TPair<int32, FGBATestsAttributeIndexEntryPtr>& Pair) { return Pair.Key; });
+
+	OutResults.Reserve(Scored.Num());
+	for (TPair<int32, FGBATestsAttributeIndexEntryPtr>& Pair : Scored)
+	{
+		OutResults.Add(MoveTemp(Pair.Value));
+	}
+}
+
+int32 FGBATestsAttributeIndex::ScoreMatch(const FStringView InLowerQuery, const FStringView InSearchText)
+{
+	if (InLowerQuery.IsEmpty())
+	{
+		return 0;
+	}
+
+	const int32 SubstringIndex = UE::String::FindFirst(InSearchText, InLowerQuery, ESearchCase::CaseSensitive);
+	if (SubstringIndex != INDEX_NONE)
+	{
+		return SubstringIndex;
+	}
+
+	// Fuzzy: every query character found in order, ranked after any substring match by the number of skipped characters
+	constexpr int32 FuzzyScoreOffset = 1 << 16;
+
+	int32 TextIndex = 0;
+	int32 Gaps = 0;
+	for (const TCHAR QueryChar : InLowerQuery)
+	{
+		const int32 MatchStart = TextIndex;
+		while (TextIndex < InSearchText.Len() && InSearchText[TextIndex] != QueryChar)
+		{
+			++TextIndex;
+		}
+
+		if (TextIndex == InSearchText.Len())
+		{
+			return INDEX_NONE;
+		}
+
+		Gaps += TextIndex - MatchStart;
+		++TextIndex;
+	}
+
+	return FuzzyScoreOffset + Gaps;
+}
@@ -0,0 +1,217 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributePinParser.h"
+
+#include "AttributeSet.h"
+#include "EdGraphSchema_K2.h"
+#include "Async/ParallelFor.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+
+bool FGBATestsAttributePinParser::Parse(FStringView InDefaultValue, FGBATestsAttributePinView& OutView)
+{
+	OutView = FGBATestsAttributePinView();
+
+	FStringView Text = InDefaultValue.TrimStartAndEnd();
+	if (Text.StartsWith(TEXT('(')))
+	{
+		Text.RightChopInline(1);
+	}
+
+	if (Text.EndsWith(TEXT(')')))
+	{
+		Text.LeftChopInline(1);
+	}
+
+	FStringView AttributePath;
+	FStringView AttributeName;
+	FStringView AttributeOwner;
+
+	while (!Text.IsEmpty())
+	{
+		int32 EqualIndex = INDEX_NONE;
+		if (!Text.FindChar(TEXT('='), EqualIndex))
+		{
+			break;
+		}
+
+		const FStringView Key = Text.Left(EqualIndex).TrimStartAndEnd();
+		Text.RightChopInline(EqualIndex + 1);
+
+		const FStringView Value = ReadValue(Text);
+		if (Key.Equals(TEXT("Attribute"), ESearchCase::IgnoreCase))
+		{
+			AttributePath = Value;
+		}
+		else if (Key.Equals(TEXT("AttributeName"), ESearchCase::IgnoreCase))
+		{
+			AttributeName = Value;
+		}
+		else if (Key.Equals(TEXT("AttributeOwner"), ESearchCase::IgnoreCase))
+		{
+			AttributeOwner = Value;
+		}
+	}
+
+	// Field path: /Game/Foo/GBA_Bar.GBA_Bar_C:Health
+	int32 ColonIndex = INDEX_NONE;
+	if (!AttributePath.IsEmpty() && !AttributePath.Equals(TEXT("None"), ESearchCase::IgnoreCase) && AttributePath.FindLastChar(TEXT(':'), ColonIndex))
+	{
+		OutView.PackageName = AttributePath.Left(ColonIndex);
+		OutView.AttributeName = AttributePath.RightChop(ColonIndex + 1);
+	}
+	else
+	{
+		OutView.PackageName = StripObjectReference(AttributeOwner);
+		OutView.AttributeName = AttributeName;
+	}
+
+	if (OutView.PackageName.Equals(TEXT("None"), ESearchCase::IgnoreCase))
+	{
+		OutView.PackageName.Reset();
+	}
+
+	return !OutView.AttributeName.IsEmpty();
+}
+
+bool FGBATestsAttributePinParser::IsAttributePin(const UEdGraphPin* InPin)
+{
+	return InPin
+		&& InPin->Direction == EGPD_Input
+		&& InPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Struct
+		&& InPin->PinType.PinSubCategoryObject == FGameplayAttribute::StaticStruct();
+}
+
+void FGBATestsAttributePinParser::ScanBlueprints(const TConstArrayView<const UBlueprint*> InBlueprints, TArray<FGBATestsAttributePinReference>& OutReferences)
+{
+	check(IsInGameThread());
+
+	TArray<FGBATestsAttributePinReference> Candidates;
+
+	TArray<UEdGraph*> Graphs;
+	for (const UBlueprint* Blueprint : InBlueprints)
+	{
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		Graphs.Reset();
+		Blueprint->GetAllGraphs(Graphs);
+
+		for (const UEdGraph* Graph : Graphs)
+		{
+			if (!Graph)
+			{
+				continue;
+			}
+
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+				{
+					continue;
+				}
+
+				for (const UEdGraphPin* Pin : Node->Pins)
+				{
+					if (IsAttributePin(Pin) && !Pin->DefaultValue.IsEmpty())
+					{
+						FGBATestsAttributePinReference& Candidate = Candidates.AddDefaulted_GetRef();
+						Candidate.Blueprint = Blueprint;
+						Candidate.Node = Node;
+						Candidate.Pin = Pin;
+					}
+				}
+			}
+		}
+	}
+
+	// Parsing only reads pin default strings (no UObject access), safe to spread across workers
+	TArray<bool> Parsed;
+	Parsed.SetNumZeroed(Candidates.Num());
+
+	ParallelFor(Candidates.Num(), [&Candidates, &Parsed](const int32 Index)
+	{
+		FGBATestsAttributePinReference& Candidate = Candidates[Index];
+		Parsed[Index] = Parse(Candidate.Pin->DefaultValue, Candidate.View);
+	});
+
+	OutReferences.Reserve(OutReferences.Num() + Candidates.Num());
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		if (Parsed[Index])
+		{
+			OutReferences.Add(Candidates[Index]);
+		}
+	}
+}
+
+FStringView FGBATestsAttributePinParser::ReadValue(FStringView& InOutText)
+{
+	FStringView Value;
+
+	if (InOutText.StartsWith(TEXT('"')))
+	{
+		// Quoted value, skip over escaped characters
+		int32 Index = 1;
+		while (Index < InOutText.Len() && InOutText[Index] != TEXT('"'))
+		{
+			Index += InOutText[Index] == TEXT('\\') ? 2 : 1;
+		}
+
+		Value = InOutText.Mid(1, Index - 1);
+		InOutText.RightChopInline(Index + 1);
+
+		int32 CommaIndex = INDEX_NONE;
+		if (InOutText.FindChar(TEXT(','), CommaIndex))
+		{
+			InOutText.RightChopInline(CommaIndex + 1);
+		}
+		else
+		{
+			InOutText.Reset();
+		}
+
+		return Value;
+	}
+
+	// Unquoted value, runs until the next top level separator
+	int32 Depth = 0;
+	int32 Index = 0;
+	for (; Index < InOutText.Len(); ++Index)
+	{
+		const TCHAR Char = InOutText[Index];
+		if (Char == TEXT('('))
+		{
+			++Depth;
+		}
+		else if (Char == TEXT(')'))
+		{
+			--Depth;
+		}
+		else if (Char == TEXT(',') && Depth <= 0)
+		{
+			break;
+		}
+	}
+
+	Value = InOutText.Left(Index).TrimStartAndEnd();
+	InOutText.RightChopInline(Index + 1);
+	return Value;
+}
+
+FStringView FGBATestsAttributePinParser::StripObjectReference(FStringView InText)
+{
+	int32 QuoteIndex = INDEX_NONE;
+	if (InText.FindChar(TEXT('\''), QuoteIndex))
+	{
+		InText.RightChopInline(QuoteIndex + 1);
+		if (InText.EndsWith(TEXT('\'')))
+		{
+			InText.LeftChopInline(1);
+		}
+	}
+
+	return InText;
+}
@@ -0,0 +1,417 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeReferenceSubsystem.h"
+
+#include "AttributeSet.h"
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsLog.h"
+#include "JsonObjectConverter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+void UGBATestsAttributeReferenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadCache();
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UGBATestsAttributeReferenceSubsystem::HandlePackageSaved);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddUObject(this, &UGBATestsAttributeReferenceSubsystem::HandleAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddUObject(this, &UGBATestsAttributeReferenceSubsystem::HandleAssetRenamed);
+}
+
+void UGBATestsAttributeReferenceSubsystem::Deinitialize()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	SaveCache();
+
+	Super::Deinitialize();
+}
+
+TArray<FName> UGBATestsAttributeReferenceSubsystem::ResolveReferencingPackages(const FGBATestsAttributeKey& InKey)
+{
+	for (const FName& Candidate : GetUnresolvedCandidates(InKey.OwnerPackage))
+	{
+		const FString PackageName = Candidate.ToString();
+
+		UPackage* Package = FindPackage(nullptr, *PackageName);
+		if (!Package)
+		{
+			GBA_TESTS_LOG(Verbose, TEXT("UGBATestsAttributeReferenceSubsystem::ResolveReferencingPackages - Loading candidate %s"), *PackageName)
+			Package = LoadPackage(nullptr, *PackageName, LOAD_NoWarn | LOAD_Quiet);
+		}
+
+		if (Package)
+		{
+			ScanPackage(Package);
+		}
+	}
+
+	const TSet<FName>* Referencers = ReferencersByAttribute.Find(InKey);
+	return Referencers ? Referencers->Array() : TArray<FName>();
+}
+
+void UGBATestsAttributeReferenceSubsystem::GetReferences(const FGBATestsAttributeKey& InKey, TArray<FGBATestsAttributeReference>& OutReferences) const
+{
+	const TSet<FName>* Referencers = ReferencersByAttribute.Find(InKey);
+	if (!Referencers)
+	{
+		return;
+	}
+
+	for (const FName& Referencer : *Referencers)
+	{
+		const FGBATestsAttributeReferencePackageEntry* Entry = Cache.Packages.Find(Referencer);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		for (const FGBATestsAttributeReference& Reference : Entry->References)
+		{
+			if (Reference.OwnerPackage == InKey.OwnerPackage && Reference.AttributeName == InKey.AttributeName)
+			{
+				OutReferences.Add(Reference);
+			}
+		}
+	}
+}
+
+TArray<FName> UGBATestsAttributeReferenceSubsystem::GetUnresolvedCandidates(const FName& InOwnerPackage) const
+{
+	TArray<FName> Candidates;
+	if (InOwnerPackage.IsNone())
+	{
+		return Candidates;
+	}
+
+	// Attribute set itself (its own graphs commonly reference its attributes), then everything depending on it
+	Candidates.Add(InOwnerPackage);
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.GetReferencers(InOwnerPackage, Candidates);
+
+	return Candidates.FilterByPredicate([this](const FName& Candidate)
+	{
+		return !FPackageName::IsScriptPackage(Candidate.ToString()) && !IsPackageIndexed(Candidate);
+	});
+}
+
+void UGBATestsAttributeReferenceSubsystem::ScanPackage(const UPackage* InPackage)
+{
+	if (!InPackage)
+	{
+		return;
+	}
+
+	const FName PackageName = InPackage->GetFName();
+
+	FGBATestsAttributeReferencePackageEntry Entry;
+	Entry.Timestamp = GetPackageTimestamp(PackageName);
+
+	TArray<UObject*> Objects;
+	GetObjectsWithPackage(InPackage, Objects, true, RF_NoFlags);
+
+	for (const UObject* Object : Objects)
+	{
+		if (!Object)
+		{
+			continue;
+		}
+
+		// Skeleton and reinstanced classes hold stale copies of the same data
+		const UClass* ObjectClass = Object->GetClass();
+		if (FKismetEditorUtilities::IsClassABlueprintSkeleton(ObjectClass) || ObjectClass->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+		{
+			CollectPinReferences(Blueprint, Entry.References);
+			continue;
+		}
+
+		CollectPropertyReferences(Object, Entry.References);
+	}
+
+	for (FGBATestsAttributeReference& Reference : Entry.References)
+	{
+		Reference.ReferencerPackage = PackageName;
+	}
+
+	GBA_TESTS_LOG(Verbose, TEXT("UGBATestsAttributeReferenceSubsystem::ScanPackage - %s: %d references"), *PackageName.ToString(), Entry.References.Num())
+	SetPackageEntry(PackageName, MoveTemp(Entry));
+}
+
+bool UGBATestsAttributeReferenceSubsystem::IsPackageIndexed(const FName& InPackageName) const
+{
+	const FGBATestsAttributeReferencePackageEntry* Entry = Cache.Packages.Find(InPackageName);
+	return Entry && Entry->Timestamp == GetPackageTimestamp(InPackageName);
+}
+
+void UGBATestsAttributeReferenceSubsystem::SaveCache() const
+{
+	FGBATestsAttributeReferenceCache CacheToSave = Cache;
+	CacheToSave.Version = CacheVersion;
+
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(CacheToSave, Json))
+	{
+		GBA_TESTS_LOG(Warning, TEXT("UGBATestsAttributeReferenceSubsystem::SaveCache - Failed to serialize index"))
+		return;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Json, *GetCacheFilename()))
+	{
+		GBA_TESTS_LOG(Warning, TEXT("UGBATestsAttributeReferenceSubsystem::SaveCache - Failed to write %s"), *GetCacheFilename())
+	}
+}
+
+void UGBATestsAttributeReferenceSubsystem::LoadCache()
+{
+	ResetIndex();
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *GetCacheFilename()))
+	{
+		return;
+	}
+
+	FGBATestsAttributeReferenceCache LoadedCache;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &LoadedCache) || LoadedCache.Version != CacheVersion)
+	{
+		GBA_TESTS_LOG(Display, TEXT("UGBATestsAttributeReferenceSubsystem::LoadCache - Discarding outdated or invalid index %s"), *GetCacheFilename())
+		return;
+	}
+
+	Cache = MoveTemp(LoadedCache);
+	RebuildReverseMap();
+}
+
+void UGBATestsAttributeReferenceSubsystem::ResetIndex()
+{
+	Cache = FGBATestsAttributeReferenceCache();
+	Cache.Version = CacheVersion;
+	ReferencersByAttribute.Reset();
+}
+
+FString UGBATestsAttributeReferenceSubsystem::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("BlueprintAttributesTests") / TEXT("AttributeReferenceIndex.json");
+}
+
+void UGBATestsAttributeReferenceSubsystem::CollectPinReferences(const UBlueprint* InBlueprint, TArray<FGBATestsAttributeReference>& OutReferences)
+{
+	if (!InBlueprint)
+	{
+		return;
+	}
+
+	TArray<UEdGraph*> Graphs;
+	InBlueprint->GetAllGraphs(Graphs);
+
+	for (const UEdGraph* Graph : Graphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				if (!FGBATestsAttributePinParser::IsAttributePin(Pin) || Pin->DefaultValue.IsEmpty())
+				{
+					continue;
+				}
+
+				FGBATestsAttributePinView View;
+				if (!FGBATestsAttributePinParser::Parse(Pin->DefaultValue, View))
+				{
+					continue;
+				}
+
+				FGBATestsAttributeReference& Reference = OutReferences.AddDefaulted_GetRef();
+				Reference.OwnerPackage = NormalizeOwnerPackage(FString(View.PackageName));
+				Reference.AttributeName = FName(View.AttributeName);
+				Reference.Type = EGBATestsAttributeReferenceType::K2Pin;
+				Reference.Location = FString::Printf(
+					TEXT("%s > %s > %s"),
+					*Graph->GetName(),
+					*Node->GetNodeTitle(ENodeTitleType::ListView).ToString(),
+					*Pin->PinName.ToString()
+				);
+			}
+		}
+	}
+}
+
+void UGBATestsAttributeReferenceSubsystem::CollectPropertyReferences(const UObject* InObject, TArray<FGBATestsAttributeReference>& OutReferences)
+{
+	if (!InObject)
+	{
+		return;
+	}
+
+	for (FPropertyValueIterator It(FStructProperty::StaticClass(), InObject->GetClass(), InObject); It; ++It)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(It.Key());
+		if (!StructProperty || StructProperty->Struct != FGameplayAttribute::StaticStruct())
+		{
+			continue;
+		}
+
+		// Nothing of interest nested within FGameplayAttribute itself
+		It.SkipRecursiveProperty();
+
+		const FGameplayAttribute* Attribute = static_cast<const FGameplayAttribute*>(It.Value());
+		if (!Attribute || Attribute->GetName().IsEmpty())
+		{
+			continue;
+		}
+
+		// Dangling attributes (property no longer resolves) are kept with a None owner, so that they can be reported
+		const UClass* AttributeSetClass = Attribute->GetAttributeSetClass();
+
+		FGBATestsAttributeReference& Reference = OutReferences.AddDefaulted_GetRef();
+		Reference.OwnerPackage = AttributeSetClass ? AttributeSetClass->GetOutermost()->GetFName() : NAME_None;
+		Reference.AttributeName = FName(*Attribute->GetName());
+		Reference.Type = EGBATestsAttributeReferenceType::Property;
+		Reference.Location = FString::Printf(TEXT("%s > %s"), *InObject->GetName(), *It.GetPropertyPathDebugString());
+	}
+}
+
+FName UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(const FString& InOwnerPath)
+{
+	FString Path = InOwnerPath.TrimQuotes();
+
+	// Exported class reference, eg. /Script/Engine.BlueprintGeneratedClass'/Game/Foo/Bar.Bar_C'
+	int32 QuoteIndex = INDEX_NONE;
+	if (Path.FindChar(TEXT('\''), QuoteIndex))
+	{
+		Path = Path.Mid(QuoteIndex + 1);
+		Path.RemoveFromEnd(TEXT("'"));
+	}
+
+	if (Path.IsEmpty())
+	{
+		return NAME_None;
+	}
+
+	return FName(*FPackageName::ObjectPathToPackageName(Path));
+}
+
+void UGBATestsAttributeReferenceSubsystem::SetPackageEntry(const FName& InPackageName, FGBATestsAttributeReferencePackageEntry&& InEntry)
+{
+	RemovePackageEntry(InPackageName);
+
+	for (const FGBATestsAttributeReference& Reference : InEntry.References)
+	{
+		ReferencersByAttribute.FindOrAdd(FGBATestsAttributeKey(Reference.OwnerPackage, Reference.AttributeName)).Add(InPackageName);
+	}
+
+	Cache.Packages.Add(InPackageName, MoveTemp(InEntry));
+}
+
+void UGBATestsAttributeReferenceSubsystem::RemovePackageEntry(const FName& InPackageName)
+{
+	const FGBATestsAttributeReferencePackageEntry* Existing = Cache.Packages.Find(InPackageName);
+	if (!Existing)
+	{
+		return;
+	}
+
+	for (const FGBATestsAttributeReference& Reference : Existing->References)
+	{
+		const FGBATestsAttributeKey Key(Reference.OwnerPackage, Reference.AttributeName);
+		if (TSet<FName>* Referencers = ReferencersByAttribute.Find(Key))
+		{
+			Referencers->Remove(InPackageName);
+			if (Referencers->IsEmpty())
+			{
+				ReferencersByAttribute.Remove(Key);
+			}
+		}
+	}
+
+	Cache.Packages.Remove(InPackageName);
+}
+
+void UGBATestsAttributeReferenceSubsystem::RebuildReverseMap()
+{
+	ReferencersByAttribute.Reset();
+	for (const TPair<FName, FGBATestsAttributeReferencePackageEntry>& Pair : Cache.Packages)
+	{
+		for (const FGBATestsAttributeReference& Reference : Pair.Value.References)
+		{
+			ReferencersByAttribute.FindOrAdd(FGBATestsAttributeKey(Reference.OwnerPackage, Reference.AttributeName)).Add(Pair.Key);
+		}
+	}
+}
+
+FString UGBATestsAttributeReferenceSubsystem::GetPackageTimestamp(const FName& InPackageName)
+{
+	const FString LongPackageName = InPackageName.ToString();
+
+	for (const FString& Extension : { FPackageName::GetAssetPackageExtension(), FPackageName::GetMapPackageExtension() })
+	{
+		FString Filename;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(LongPackageName, Filename, Extension))
+		{
+			continue;
+		}
+
+		const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*Filename);
+		if (Timestamp != FDateTime::MinValue())
+		{
+			return Timestamp.ToIso8601();
+		}
+	}
+
+	// Transient / never saved packages
+	return FString();
+}
+
+void UGBATestsAttributeReferenceSubsystem::HandlePackageSaved(const FString& InPackageFilename, UPackage* InPackage, FObjectPostSaveContext InObjectSaveContext)
+{
+	if (InObjectSaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	ScanPackage(InPackage);
+}
+
+void UGBATestsAttributeReferenceSubsystem::HandleAssetRemoved(const FAssetData& InAssetData)
+{
+	RemovePackageEntry(InAssetData.PackageName);
+}
+
+void UGBATestsAttributeReferenceSubsystem::HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	// Referencers of the renamed asset are re-scanned on their next save (or when resolving candidates)
+	RemovePackageEntry(FName(*FPackageName::ObjectPathToPackageName(InOldObjectPath)));
+}
@@ -0,0 +1,275 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeRenamePipeline.h"
+
+#include "BlueprintCompilationManager.h"
+#include "Editor.h"
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsAttributeReferenceSubsystem.h"
+#include "GBATestsLog.h"
+#include "Async/ParallelFor.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace UE::GBATests::Private
+{
+	/** Whether the character ends an attribute name within exported text */
+	static bool IsNameTerminator(const FStringView InText, const int32 InIndex)
+	{
+		if (InIndex >= InText.Len())
+		{
+			return true;
+		}
+
+		const TCHAR Char = InText[InIndex];
+		return Char == TEXT('"') || Char == TEXT(',') || Char == TEXT(')') || Char == TEXT('\'');
+	}
+
+	/** Whether InText at InIndex is InName followed by a terminator */
+	static bool MatchesName(const FStringView InText, const int32 InIndex, const FStringView InName)
+	{
+		return InText.Mid(InIndex, InName.Len()).Equals(InName, ESearchCase::CaseSensitive) && IsNameTerminator(InText, InIndex + InName.Len());
+	}
+}
+
+FString FGBATestsAttributeRenameResult::ToString() const
+{
+	return FString::Printf(
+		TEXT("%d blueprints, %d pins | patch %.3f s | compile %.3f s | gc %.3f s | total %.3f s"),
+		NumBlueprints,
+		NumPatchedPins,
+		PatchSeconds,
+		CompileSeconds,
+		GarbageCollectSeconds,
+		GetTotalSeconds()
+	);
+}
+
+FGBATestsAttributeRenamePipeline::FGBATestsAttributeRenamePipeline(UBlueprint* InAttributeSetBlueprint, const FName& InOldName, const FName& InNewName)
+	: AttributeSetBlueprint(InAttributeSetBlueprint),
+	  OldName(InOldName),
+	  NewName(InNewName)
+{
+	check(AttributeSetBlueprint);
+	OwnerPackage = AttributeSetBlueprint->GetOutermost()->GetFName();
+}
+
+void FGBATestsAttributeRenamePipeline::CollectDependents()
+{
+	UGBATestsAttributeReferenceSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UGBATestsAttributeReferenceSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		GBA_TESTS_LOG(Warning, TEXT("FGBATestsAttributeRenamePipeline::CollectDependents - Reference subsystem unavailable"))
+		return;
+	}
+
+	const TArray<FName> Referencers = Subsystem->ResolveReferencingPackages(FGBATestsAttributeKey(OwnerPackage, OldName));
+
+	TArray<UBlueprint*> Blueprints;
+	for (const FName& Referencer : Referencers)
+	{
+		const UPackage* Package = LoadPackage(nullptr, *Referencer.ToString(), LOAD_None);
+		if (!Package)
+		{
+			continue;
+		}
+
+		ForEachObjectWithPackage(Package, [&Blueprints](UObject* Object)
+		{
+			if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+			{
+				Blueprints.Add(Blueprint);
+			}
+			return true;
+		}, false);
+	}
+
+	AddDependents(Blueprints);
+}
+
+void FGBATestsAttributeRenamePipeline::AddDependents(const TConstArrayView<UBlueprint*> InBlueprints)
+{
+	for (UBlueprint* Blueprint : InBlueprints)
+	{
+		if (Blueprint && Blueprint != AttributeSetBlueprint)
+		{
+			Dependents.AddUnique(Blueprint);
+		}
+	}
+}
+
+FGBATestsAttributeRenameResult FGBATestsAttributeRenamePipeline::Run(const EGBATestsAttributeRenameCompileMode InCompileMode)
+{
+	check(IsInGameThread());
+
+	FGBATestsAttributeRenameResult Result;
+	Result.NumBlueprints = Dependents.Num() + 1;
+
+	double StartTime = FPlatformTime::Seconds();
+
+	// Only a skeleton recompile of the attribute set, its full compile happens along with the dependents
+	FBlueprintEditorUtils::RenameMemberVariable(AttributeSetBlueprint, OldName, NewName);
+	Result.NumPatchedPins = PatchPins();
+	Result.PatchSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	if (InCompileMode == EGBATestsAttributeRenameCompileMode::Batched)
+	{
+		CompileBatched();
+	}
+	else
+	{
+		CompilePerAsset();
+	}
+	Result.CompileSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	if (InCompileMode == EGBATestsAttributeRenameCompileMode::Batched)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	Result.GarbageCollectSeconds = FPlatformTime::Seconds() - StartTime;
+
+	GBA_TESTS_LOG(Display, TEXT("FGBATestsAttributeRenamePipeline::Run - %s -> %s: %s"), *OldName.ToString(), *NewName.ToString(), *Result.ToString())
+	return Result;
+}
+
+bool FGBATestsAttributeRenamePipeline::PatchDefaultValue(const FStringView InDefaultValue, const FStringView InOldName, const FStringView InNewName, FString& OutDefaultValue)
+{
+	using namespace UE::GBATests::Private;
+
+	static constexpr FStringView AttributeNameKey = TEXTVIEW("AttributeName=");
+
+	OutDefaultValue.Reset(InDefaultValue.Len() + 2 * FMath::Max(0, InNewName.Len() - InOldName.Len()));
+
+	bool bPatched = false;
+	int32 Index = 0;
+	while (Index < InDefaultValue.Len())
+	{
+		// Field path: ...GBA_Bar_C:OldName
+		if (InDefaultValue[Index] == TEXT(':') && MatchesName(InDefaultValue, Index + 1, InOldName))
+		{
+			OutDefaultValue.AppendChar(TEXT(':'));
+			OutDefaultValue.Append(InNewName);
+			Index += 1 + InOldName.Len();
+			bPatched = true;
+			continue;
+		}
+
+		// AttributeName="OldName" (or unquoted)
+		if (InDefaultValue.Mid(Index, AttributeNameKey.Len()).Equals(AttributeNameKey, ESearchCase::IgnoreCase))
+		{
+			OutDefaultValue.Append(InDefaultValue.Mid(Index, AttributeNameKey.Len()));
+			Index += AttributeNameKey.Len();
+
+			if (Index < InDefaultValue.Len() && InDefaultValue[Index] == TEXT('"'))
+			{
+				OutDefaultValue.AppendChar(TEXT('"'));
+				++Index;
+			}
+
+			if (MatchesName(InDefaultValue, Index, InOldName))
+			{
+				OutDefaultValue.Append(InNewName);
+				Index += InOldName.Len();
+				bPatched = true;
+			}
+
+			continue;
+		}
+
+		OutDefaultValue.AppendChar(InDefaultValue[Index]);
+		++Index;
+	}
+
+	return bPatched;
+}
+
+void FGBATestsAttributeRenamePipeline::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(AttributeSetBlueprint);
+	Collector.AddReferencedObjects(Dependents);
+}
+
+FString FGBATestsAttributeRenamePipeline::GetReferencerName() const
+{
+	return TEXT("FGBATestsAttributeRenamePipeline");
+}
+
+int32 FGBATestsAttributeRenamePipeline::PatchPins() const
+{
+	TArray<const UBlueprint*> Blueprints;
+	Blueprints.Reserve(Dependents.Num() + 1);
+	Blueprints.Add(AttributeSetBlueprint);
+	Blueprints.Append(Dependents);
+
+	TArray<FGBATestsAttributePinReference> References;
+	FGBATestsAttributePinParser::ScanBlueprints(Blueprints, References);
+
+	// New default values are computed in parallel, as this only reads pin strings
+	TArray<FString> NewDefaultValues;
+	NewDefaultValues.SetNum(References.Num());
+
+	const FString OldNameString = OldName.ToString();
+	const FString NewNameString = NewName.ToString();
+	ParallelFor(References.Num(), [this, &References, &NewDefaultValues, &OldNameString, &NewNameString](const int32 Index)
+	{
+		const FGBATestsAttributePinReference& Reference = References[Index];
+		if (!Reference.View.AttributeName.Equals(OldNameString, ESearchCase::CaseSensitive)
+			|| UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(FString(Reference.View.PackageName)) != OwnerPackage)
+		{
+			return;
+		}
+
+		FString NewDefaultValue;
+		if (PatchDefaultValue(Reference.Pin->DefaultValue, OldNameString, NewNameString, NewDefaultValue))
+		{
+			NewDefaultValues[Index] = MoveTemp(NewDefaultValue);
+		}
+	});
+
+	// Pins and nodes are UObject owned, applying is game thread only
+	int32 NumPatchedPins = 0;
+	for (int32 Index = 0; Index < References.Num(); ++Index)
+	{
+		if (NewDefaultValues[Index].IsEmpty())
+		{
+			continue;
+		}
+
+		const FGBATestsAttributePinReference& Reference = References[Index];
+		UEdGraphNode* Node = const_cast<UEdGraphNode*>(Reference.Node);
+		UEdGraphPin* Pin = const_cast<UEdGraphPin*>(Reference.Pin);
+
+		Node->Modify();
+		Pin->DefaultValue = MoveTemp(NewDefaultValues[Index]);
+		++NumPatchedPins;
+	}
+
+	return NumPatchedPins;
+}
+
+void FGBATestsAttributeRenamePipeline::CompileBatched() const
+{
+	// Attribute set first, the compilation manager then sorts the queue by dependency and reinstances once
+	FBlueprintCompilationManager::QueueForCompilation(AttributeSetBlueprint);
+	for (UBlueprint* Blueprint : Dependents)
+	{
+		FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+	}
+
+	FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+}
+
+void FGBATestsAttributeRenamePipeline::CompilePerAsset() const
+{
+	FKismetEditorUtilities::CompileBlueprint(AttributeSetBlueprint);
+	for (UBlueprint* Blueprint : Dependents)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	}
+}
@@ -2,16 +2,46 @@
 
 #include "GBATestsEditorModule.h"
 
+#include "Editor.h"
+#include "GBAEditorSettings.h"
+#include "GBATestsAttributeFilter.h"
+#include "GBATestsAttributeIndex.h"
+
 #define LOCTEXT_NAMESPACE "FGBATestsEditorModule"
 
 void FGBATestsEditorModule::StartupModule()
 {
-    
+    // Compiled attribute filters are keyed on the filter list, drop them whenever the settings are edited
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGBATestsEditorModule::HandleObjectPropertyChanged);
+
+    // Attribute picker index lists Blueprint attribute sets, rebuild it whenever one may have changed
+    PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddLambda([this]()
+    {
+        if (GEditor)
+        {
+            BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FGBATestsAttributeIndex::Invalidate);
+        }
+    });
 }
 
 void FGBATestsEditorModule::ShutdownModule()
 {
-    
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    FGBATestsAttributeFilter::ResetCache();
+}
+
+void FGBATestsEditorModule::HandleObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+{
+    if (InObject && InObject->IsA<UGBAEditorSettings>())
+    {
+        FGBATestsAttributeFilter::ResetCache();
+    }
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,131 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeAudit.h"
+#include "Algo/Count.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeAuditSpec, "BlueprintAttributes.Editor.GBATestsAttributeAudit", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static FGBATestsAttributeAuditEntry MakeEntry(const EGBATestsAttributeAuditSource InSource, const TCHAR* InOwner, const TCHAR* InAttributeName)
+	{
+		FGBATestsAttributeAuditEntry Entry;
+		Entry.Source = InSource;
+		Entry.Owner = InOwner;
+		Entry.AttributeName = InAttributeName;
+		return Entry;
+	}
+
+	int32 CountEntries(const FGBATestsAttributeAudit& InAudit, const FName& InPackage, const EGBATestsAttributeAuditSource InSource) const
+	{
+		return Algo::CountIf(InAudit.GetEntries(), [&InPackage, InSource](const FGBATestsAttributeAuditEntry& Entry)
+		{
+			return Entry.Package == InPackage && Entry.Source == InSource;
+		});
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeAuditSpec)
+
+void FGBATestsAttributeAuditSpec::Define()
+{
+	Describe(TEXT("FGBATestsAttributeAudit::Validate()"), [this]()
+	{
+		It(TEXT("should flag references that do not resolve to a catalogued attribute"), [this]()
+		{
+			FGBATestsAttributeAuditCatalogue Catalogue;
+			Catalogue.AddAttribute(TEXT("/Game/GBA_Stats"), TEXT("GBA_Stats"), TEXT("Health"));
+
+			TArray<FGBATestsAttributeAuditEntry> Entries = {
+				MakeEntry(EGBATestsAttributeAuditSource::K2Pin, TEXT("/Game/GBA_Stats"), TEXT("Health")),
+				MakeEntry(EGBATestsAttributeAuditSource::K2Pin, TEXT("/Game/GBA_Stats"), TEXT("Renamed")),
+				MakeEntry(EGBATestsAttributeAuditSource::Property, TEXT(""), TEXT("Health")),
+				MakeEntry(EGBATestsAttributeAuditSource::DataTableRow, TEXT("GBA_Stats"), TEXT("Health")),
+				MakeEntry(EGBATestsAttributeAuditSource::DataTableRow, TEXT("GBA_Unknown"), TEXT("Health")),
+			};
+
+			FGBATestsAttributeAudit::Validate(Catalogue, Entries);
+
+			TestFalse(TEXT("Valid K2 pin"), Entries[0].bDangling);
+			TestTrue(TEXT("Renamed attribute K2 pin"), Entries[1].bDangling);
+			TestTrue(TEXT("Unresolved property"), Entries[2].bDangling);
+			TestFalse(TEXT("Valid DataTable row"), Entries[3].bDangling);
+			TestTrue(TEXT("Unknown attribute set DataTable row"), Entries[4].bDangling);
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeAudit::Run()"), [this]()
+	{
+		It(TEXT("should find fixture references"), [this]()
+		{
+			FGBATestsAttributeAudit::FOptions Options;
+			Options.Paths = { TEXT("/BlueprintAttributesTests/Fixtures") };
+
+			FGBATestsAttributeAudit Audit;
+			Audit.GatherCandidates(Options);
+			AddInfo(FString::Printf(TEXT("Candidates: %d"), Audit.GetCandidates().Num()));
+
+			TestTrue(TEXT("DT_Test_Stats is a candidate"), Audit.GetCandidates().Contains(FName(TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats"))));
+			TestTrue(TEXT("GBA_Reff_Test is a candidate"), Audit.GetCandidates().Contains(FName(TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test"))));
+
+			Audit.Run(Options);
+			for (const FGBATestsAttributeAuditEntry& Entry : Audit.GetEntries())
+			{
+				if (Entry.bDangling)
+				{
+					AddInfo(FString::Printf(TEXT("Dangling %s: %s %s.%s"), FGBATestsAttributeAudit::LexToString(Entry.Source), *Entry.Location, *Entry.Owner, *Entry.AttributeName));
+				}
+			}
+
+			TestTrue(TEXT("DT_Test_Stats rows"), CountEntries(Audit, TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats"), EGBATestsAttributeAuditSource::DataTableRow) > 0);
+			TestTrue(TEXT("GBA_Reff_Test K2 pins"), CountEntries(Audit, TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test"), EGBATestsAttributeAuditSource::K2Pin) > 0);
+			AddInfo(FString::Printf(TEXT("References: %d, dangling: %d"), Audit.GetEntries().Num(), Audit.GetNumDangling()));
+		});
+
+		It(TEXT("should unload the packages it loaded"), [this]()
+		{
+			const TCHAR* DataTablePackage = TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec/DT_Test_Stats");
+			if (FindPackage(nullptr, DataTablePackage))
+			{
+				AddInfo(TEXT("DT_Test_Stats was loaded before the audit, skipping"));
+				return;
+			}
+
+			FGBATestsAttributeAudit::FOptions Options;
+			Options.Paths = { TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec") };
+
+			FGBATestsAttributeAudit Audit;
+			Audit.GatherCandidates(Options);
+			Audit.Run(Options);
+
+			TestTrue(TEXT("DT_Test_Stats rows"), CountEntries(Audit, FName(DataTablePackage), EGBATestsAttributeAuditSource::DataTableRow) > 0);
+			TestNull(TEXT("DT_Test_Stats unloaded"), FindPackage(nullptr, DataTablePackage));
+		});
+
+		It(TEXT("should leave packages it didn't request loaded"), [this]()
+		{
+			const TCHAR* OtherPackage = TEXT("/BlueprintAttributesTests/Fixtures/BP_Attributes_Test_Character");
+			if (FindPackage(nullptr, OtherPackage))
+			{
+				AddInfo(TEXT("BP_Attributes_Test_Character was loaded before the audit, skipping"));
+				return;
+			}
+
+			FGBATestsAttributeAudit::FOptions Options;
+			Options.Paths = { TEXT("/BlueprintAttributesTests/Fixtures/GBAAttributeSetBlueprintBase_Spec") };
+
+			FGBATestsAttributeAudit Audit;
+			Audit.GatherCandidates(Options);
+
+			// Started by someone else before the audit, completed by the audit's own flushes
+			LoadPackageAsync(OtherPackage);
+			Audit.Run(Options);
+
+			TestNotNull(TEXT("BP_Attributes_Test_Character still loaded"), FindPackage(nullptr, OtherPackage));
+		});
+	});
+}
@@ -0,0 +1,150 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBAEditorSettings.h"
+#include "GBATestsAttributeFilter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeFilterSpec, "BlueprintAttributes.Editor.GBATestsAttributeFilter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Checks the trie and UGBAEditorSettings::IsAttributeFiltered() agree for the filter list and attribute */
+	void TestMatchesEditorSettings(const TArray<FString>& InFilters, const FString& InAttributeName)
+	{
+		const bool bExpected = UGBAEditorSettings::IsAttributeFiltered(InFilters, InAttributeName);
+		const bool bActual = FGBATestsAttributeFilter::IsAttributeFiltered(InFilters, InAttributeName);
+		TestTrue(
+			FString::Printf(TEXT("%s with filters [%s] (expected %s)"), *InAttributeName, *FString::Join(InFilters, TEXT(", ")), bExpected ? TEXT("filtered") : TEXT("not filtered")),
+			bExpected == bActual
+		);
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeFilterSpec)
+
+void FGBATestsAttributeFilterSpec::Define()
+{
+	AfterEach([this]()
+	{
+		FGBATestsAttributeFilter::ResetCache();
+	});
+
+	Describe(TEXT("FGBATestsAttributeFilter::IsAttributeFiltered()"), [this]()
+	{
+		It(TEXT("should match UGBAEditorSettings::IsAttributeFiltered() on the settings spec cases"), [this]()
+		{
+			TestMatchesEditorSettings({TEXT("AbilitySystemComponent.OutgoingDuration"), TEXT("Foo")}, TEXT("AbilitySystemComponent.OutgoingDuration"));
+			TestMatchesEditorSettings({TEXT("Foo")}, TEXT("AbilitySystemComponent.OutgoingDuration"));
+			TestMatchesEditorSettings({TEXT("AbilitySysteaaamComponent.OutgoingDuration"), TEXT("Foo")}, TEXT("AbilitySystemComponent.OutgoingDuration"));
+			TestMatchesEditorSettings({TEXT("ExampleSet")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("ExampleSet.SomeAttribute")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("ExampleSet.Some")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({}, TEXT("ExampleSet.SomeAttribute"));
+		});
+
+		It(TEXT("should match UGBAEditorSettings::IsAttributeFiltered() on edge cases"), [this]()
+		{
+			TestMatchesEditorSettings({TEXT("")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("exampleset.some")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("ExampleSet.SomeAttributeAndMore")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("Example"), TEXT("ExampleSet.SomeAttribute")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("ExampleSet.Other")}, TEXT("ExampleSet.SomeAttribute"));
+			TestMatchesEditorSettings({TEXT("ExampleSet")}, TEXT(""));
+		});
+
+		It(TEXT("should match UGBAEditorSettings::IsAttributeFiltered() on generated filters"), [this]()
+		{
+			TArray<FString> Filters;
+			TArray<FString> AttributeNames;
+			for (int32 SetIndex = 0; SetIndex < 20; ++SetIndex)
+			{
+				for (int32 AttributeIndex = 0; AttributeIndex < 10; ++AttributeIndex)
+				{
+					AttributeNames.Add(FString::Printf(TEXT("GBA_Set_%d.Attribute_%d"), SetIndex, AttributeIndex));
+				}
+
+				// Mix of whole set, prefix and exact attribute filters
+				if (SetIndex % 3 == 0)
+				{
+					Filters.Add(FString::Printf(TEXT("GBA_Set_%d."), SetIndex));
+				}
+				else if (SetIndex % 3 == 1)
+				{
+					Filters.Add(FString::Printf(TEXT("GBA_Set_%d.Attribute_"), SetIndex));
+				}
+				else
+				{
+					Filters.Add(FString::Printf(TEXT("GBA_Set_%d.Attribute_%d"), SetIndex, SetIndex % 10));
+				}
+			}
+
+			for (const FString& AttributeName : AttributeNames)
+			{
+				TestMatchesEditorSettings(Filters, AttributeName);
+			}
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeFilter::FilterAttributes()"), [this]()
+	{
+		It(TEXT("should remove filtered attributes and keep order"), [this]()
+		{
+			TArray<FString> AttributeNames = {
+				TEXT("ExampleSet.Health"),
+				TEXT("AbilitySystemComponent.OutgoingDuration"),
+				TEXT("ExampleSet.Mana"),
+				TEXT("OtherSet.Health"),
+			};
+
+			FGBATestsAttributeFilter::FilterAttributes({TEXT("AbilitySystemComponent"), TEXT("ExampleSet.M")}, AttributeNames);
+
+			TestEqual(TEXT("Remaining attributes"), AttributeNames.Num(), 2);
+			if (AttributeNames.Num() == 2)
+			{
+				TestEqual(TEXT("First remaining"), AttributeNames[0], TEXT("ExampleSet.Health"));
+				TestEqual(TEXT("Second remaining"), AttributeNames[1], TEXT("OtherSet.Health"));
+			}
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeFilter::GetTrie()"), [this]()
+	{
+		It(TEXT("should reuse the compiled trie until the filter list changes"), [this]()
+		{
+			const TArray<FString> Filters = {TEXT("ExampleSet"), TEXT("OtherSet.Health")};
+
+			const TSharedRef<const FGBATestsAttributeFilterTrie> First = FGBATestsAttributeFilter::GetTrie(Filters);
+			const TSharedRef<const FGBATestsAttributeFilterTrie> Second = FGBATestsAttributeFilter::GetTrie(Filters);
+			TestTrue(TEXT("Same filters return the cached trie"), First == Second);
+
+			const TSharedRef<const FGBATestsAttributeFilterTrie> Third = FGBATestsAttributeFilter::GetTrie({TEXT("ExampleSet")});
+			TestTrue(TEXT("Different filters rebuild the trie"), First != Third);
+
+			FGBATestsAttributeFilter::ResetCache();
+			const TSharedRef<const FGBATestsAttributeFilterTrie> Fourth = FGBATestsAttributeFilter::GetTrie({TEXT("ExampleSet")});
+			TestTrue(TEXT("ResetCache drops the cached trie"), Third != Fourth);
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeFilter::FHandle"), [this]()
+	{
+		It(TEXT("should match UGBAEditorSettings::IsAttributeFiltered() and pick up edits on cache reset"), [this]()
+		{
+			TArray<FString> Filters = {TEXT("ExampleSet.M"), TEXT("AbilitySystemComponent")};
+			FGBATestsAttributeFilter::FHandle Handle(Filters);
+
+			TestTrue(TEXT("Filtered"), Handle.IsFiltered(TEXT("ExampleSet.MaxHealth")) == UGBAEditorSettings::IsAttributeFiltered(Filters, TEXT("ExampleSet.MaxHealth")));
+			TestTrue(TEXT("Not filtered"), Handle.IsFiltered(TEXT("ExampleSet.Health")) == UGBAEditorSettings::IsAttributeFiltered(Filters, TEXT("ExampleSet.Health")));
+
+			// Same as a settings edit, which resets the cache
+			Filters.Add(TEXT("ExampleSet.H"));
+			FGBATestsAttributeFilter::ResetCache();
+			TestTrue(TEXT("Filtered after edit"), Handle.IsFiltered(TEXT("ExampleSet.Health")));
+
+			Filters.Reset();
+			TestFalse(TEXT("Empty filters"), Handle.IsFiltered(TEXT("ExampleSet.Health")));
+		});
+	});
+}
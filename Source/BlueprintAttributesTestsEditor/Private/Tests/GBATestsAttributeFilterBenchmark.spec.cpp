@@ -0,0 +1,137 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBAEditorSettings.h"
+#include "GBATestsAttributeFilter.h"
+#include "GBATestsBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeFilterBenchmarkSpec, "BlueprintAttributes.Perf.Editor.GBATestsAttributeFilter", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	static constexpr int32 NumSets = 500;
+	static constexpr int32 NumAttributesPerSet = 10;
+	static constexpr int32 NumFilters = 300;
+	static constexpr int32 NumWarmupPasses = 2;
+	static constexpr int32 NumPasses = 10;
+
+	TArray<FString> Filters;
+	TArray<FString> AttributeNames;
+
+	/** Picker sized list (5k attributes), with a few hundred filters that mostly miss */
+	void Generate()
+	{
+		AttributeNames.Reset(NumSets * NumAttributesPerSet);
+		for (int32 SetIndex = 0; SetIndex < NumSets; ++SetIndex)
+		{
+			for (int32 AttributeIndex = 0; AttributeIndex < NumAttributesPerSet; ++AttributeIndex)
+			{
+				AttributeNames.Add(FString::Printf(TEXT("GBA_Generated_%d.Attribute_%d"), SetIndex, AttributeIndex));
+			}
+		}
+
+		Filters.Reset(NumFilters);
+		for (int32 FilterIndex = 0; FilterIndex < NumFilters; ++FilterIndex)
+		{
+			Filters.Add(FilterIndex % 10 == 0
+				? FString::Printf(TEXT("GBA_Generated_%d."), FilterIndex)
+				: FString::Printf(TEXT("GBA_Filtered_%d.Attribute"), FilterIndex)
+			);
+		}
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeFilterBenchmarkSpec)
+
+void FGBATestsAttributeFilterBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Generate();
+		FGBATestsAttributeFilter::ResetCache();
+	});
+
+	It(TEXT("filters a 5k attributes picker list faster than UGBAEditorSettings::IsAttributeFiltered()"), [this]()
+	{
+		int32 NumKeptLegacy = 0;
+		const FGBATestsBenchmarkStats LegacyStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, AttributeNames.Num(), [this, &NumKeptLegacy]()
+		{
+			NumKeptLegacy = 0;
+			for (const FString& AttributeName : AttributeNames)
+			{
+				NumKeptLegacy += UGBAEditorSettings::IsAttributeFiltered(Filters, AttributeName) ? 0 : 1;
+			}
+		});
+
+		int32 NumKeptTrie = 0;
+		const FGBATestsBenchmarkStats TrieStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, AttributeNames.Num(), [this, &NumKeptTrie]()
+		{
+			TArray<FString> Remaining = AttributeNames;
+			FGBATestsAttributeFilter::FilterAttributes(Filters, Remaining);
+			NumKeptTrie = Remaining.Num();
+		});
+
+		AddInfo(FString::Printf(TEXT("UGBAEditorSettings::IsAttributeFiltered: %s"), *LegacyStats.ToString()));
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributeFilter::FilterAttributes: %s"), *TrieStats.ToString()));
+		AddInfo(FString::Printf(TEXT("Median speedup: %.2fx"), TrieStats.Median > 0.0 ? LegacyStats.Median / TrieStats.Median : 0.0));
+		AddInfo(FString::Printf(TEXT("Trie nodes: %d"), FGBATestsAttributeFilter::GetTrie(Filters)->GetNumNodes()));
+
+		TestEqual(TEXT("Both filter the same attributes"), NumKeptTrie, NumKeptLegacy);
+		TestTrue(TEXT("Trie median is not slower"), TrieStats.Median <= LegacyStats.Median);
+	});
+
+	It(TEXT("filters one attribute at a time with IsAttributeFiltered(), end to end"), [this]()
+	{
+		int32 NumKeptLegacy = 0;
+		const FGBATestsBenchmarkStats LegacyStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, AttributeNames.Num(), [this, &NumKeptLegacy]()
+		{
+			NumKeptLegacy = 0;
+			for (const FString& AttributeName : AttributeNames)
+			{
+				NumKeptLegacy += UGBAEditorSettings::IsAttributeFiltered(Filters, AttributeName) ? 0 : 1;
+			}
+		});
+
+		// Compares the filter list against the cached one on each call
+		int32 NumKeptDropIn = 0;
+		const FGBATestsBenchmarkStats DropInStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, AttributeNames.Num(), [this, &NumKeptDropIn]()
+		{
+			NumKeptDropIn = 0;
+			for (const FString& AttributeName : AttributeNames)
+			{
+				NumKeptDropIn += FGBATestsAttributeFilter::IsAttributeFiltered(Filters, AttributeName) ? 0 : 1;
+			}
+		});
+
+		FGBATestsAttributeFilter::FHandle Handle(Filters);
+		int32 NumKeptHandle = 0;
+		const FGBATestsBenchmarkStats HandleStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, AttributeNames.Num(), [this, &Handle, &NumKeptHandle]()
+		{
+			NumKeptHandle = 0;
+			for (const FString& AttributeName : AttributeNames)
+			{
+				NumKeptHandle += Handle.IsFiltered(AttributeName) ? 0 : 1;
+			}
+		});
+
+		AddInfo(FString::Printf(TEXT("UGBAEditorSettings::IsAttributeFiltered: %s"), *LegacyStats.ToString()));
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributeFilter::IsAttributeFiltered: %s"), *DropInStats.ToString()));
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributeFilter::FHandle::IsFiltered: %s"), *HandleStats.ToString()));
+		AddInfo(FString::Printf(TEXT("Median speedup (drop-in / handle): %.2fx / %.2fx"),
+			DropInStats.Median > 0.0 ? LegacyStats.Median / DropInStats.Median : 0.0,
+			HandleStats.Median > 0.0 ? LegacyStats.Median / HandleStats.Median : 0.0
+		));
+
+		TestEqual(TEXT("Drop-in filters the same attributes"), NumKeptDropIn, NumKeptLegacy);
+		TestEqual(TEXT("Handle filters the same attributes"), NumKeptHandle, NumKeptLegacy);
+		TestTrue(TEXT("Handle median is not slower"), HandleStats.Median <= LegacyStats.Median);
+	});
+
+	AfterEach([this]()
+	{
+		Filters.Empty();
+		AttributeNames.Empty();
+		FGBATestsAttributeFilter::ResetCache();
+	});
+}
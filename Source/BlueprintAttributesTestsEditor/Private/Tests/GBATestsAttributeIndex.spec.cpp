@@ -0,0 +1,121 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeIndex.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeIndexSpec, "BlueprintAttributes.Editor.GBATestsAttributeIndex", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static FGBATestsAttributeIndexSource MakeSource(const TCHAR* InSetName, const TCHAR* InAttributeName)
+	{
+		FGBATestsAttributeIndexSource Source;
+		Source.SetName = InSetName;
+		Source.AttributeName = InAttributeName;
+		return Source;
+	}
+
+	TArray<FString> GetDisplayNames(const TArray<FGBATestsAttributeIndexEntryPtr>& InEntries) const
+	{
+		TArray<FString> Result;
+		for (const FGBATestsAttributeIndexEntryPtr& Entry : InEntries)
+		{
+			Result.Add(Entry->DisplayName);
+		}
+		return Result;
+	}
+
+	TSharedPtr<const FGBATestsAttributeIndex> Index;
+
+END_DEFINE_SPEC(FGBATestsAttributeIndexSpec)
+
+void FGBATestsAttributeIndexSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TArray<FGBATestsAttributeIndexSource> Sources = {
+			MakeSource(TEXT("GBA_Stats"), TEXT("Health")),
+			MakeSource(TEXT("GBA_Stats"), TEXT("MaxHealth")),
+			MakeSource(TEXT("GBA_Stats"), TEXT("Mana")),
+			MakeSource(TEXT("GBA_Combat"), TEXT("Damage")),
+			MakeSource(TEXT("AbilitySystemComponent"), TEXT("OutgoingDuration")),
+		};
+
+		Index = FGBATestsAttributeIndex::Build(MoveTemp(Sources), {TEXT("AbilitySystemComponent")});
+	});
+
+	Describe(TEXT("FGBATestsAttributeIndex::Build()"), [this]()
+	{
+		It(TEXT("should format, filter and sort entries"), [this]()
+		{
+			const TArray<FString> DisplayNames = GetDisplayNames(Index->GetEntries());
+			TestEqual(TEXT("Filtered entries"), DisplayNames.Num(), 4);
+			if (DisplayNames.Num() == 4)
+			{
+				TestEqual(TEXT("Sorted first"), DisplayNames[0], TEXT("GBA_Combat.Damage"));
+				TestEqual(TEXT("Sorted last"), DisplayNames[3], TEXT("GBA_Stats.MaxHealth"));
+			}
+
+			for (const FGBATestsAttributeIndexEntryPtr& Entry : Index->GetEntries())
+			{
+				TestEqual(TEXT("SearchText is lowercase DisplayName"), Entry->SearchText, Entry->DisplayName.ToLower());
+			}
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeIndex::Search()"), [this]()
+	{
+		It(TEXT("should return every entry for an empty query"), [this]()
+		{
+			TArray<FGBATestsAttributeIndexEntryPtr> Results;
+			FGBATestsAttributeIndex::Search(TEXT(""), Index->GetEntries(), Results);
+			TestEqual(TEXT("All entries"), Results.Num(), Index->GetEntries().Num());
+		});
+
+		It(TEXT("should match case insensitive substrings, earliest match first"), [this]()
+		{
+			TArray<FGBATestsAttributeIndexEntryPtr> Results;
+			FGBATestsAttributeIndex::Search(TEXT("HEALTH"), Index->GetEntries(), Results);
+
+			const TArray<FString> DisplayNames = GetDisplayNames(Results);
+			TestEqual(TEXT("Matches"), DisplayNames.Num(), 2);
+			if (DisplayNames.Num() == 2)
+			{
+				TestEqual(TEXT("Earliest match first"), DisplayNames[0], TEXT("GBA_Stats.Health"));
+				TestEqual(TEXT("Later match second"), DisplayNames[1], TEXT("GBA_Stats.MaxHealth"));
+			}
+		});
+
+		It(TEXT("should rank fuzzy matches after substring matches"), [this]()
+		{
+			TestTrue(TEXT("Fuzzy match"), FGBATestsAttributeIndex::ScoreMatch(TEXT("mxh"), TEXT("gba_stats.maxhealth")) != INDEX_NONE);
+			TestEqual(TEXT("Out of order is not a match"), FGBATestsAttributeIndex::ScoreMatch(TEXT("hxm"), TEXT("gba_stats.maxhealth")), INDEX_NONE);
+			TestTrue(
+				TEXT("Substring ranks above fuzzy"),
+				FGBATestsAttributeIndex::ScoreMatch(TEXT("max"), TEXT("gba_stats.maxhealth")) < FGBATestsAttributeIndex::ScoreMatch(TEXT("mxh"), TEXT("gba_stats.maxhealth"))
+			);
+		});
+
+		It(TEXT("should give the same results when narrowing previous results"), [this]()
+		{
+			TArray<FGBATestsAttributeIndexEntryPtr> Previous;
+			FGBATestsAttributeIndex::Search(TEXT("gba_s"), Index->GetEntries(), Previous);
+
+			TArray<FGBATestsAttributeIndexEntryPtr> Narrowed;
+			FGBATestsAttributeIndex::Search(TEXT("gba_stats.ma"), Previous, Narrowed);
+
+			TArray<FGBATestsAttributeIndexEntryPtr> Full;
+			FGBATestsAttributeIndex::Search(TEXT("gba_stats.ma"), Index->GetEntries(), Full);
+
+			TestTrue(TEXT("Same results"), GetDisplayNames(Narrowed) == GetDisplayNames(Full));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		Index.Reset();
+	});
+}
@@ -0,0 +1,150 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeIndex.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeExit.h"
+#include "Widgets/SGBATestsAttributePicker.h"
+#include "Widgets/SWindow.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributePickerBenchmarkSpec, "BlueprintAttributes.Perf.Editor.SGBATestsAttributePicker", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	static constexpr int32 NumSets = 500;
+	static constexpr int32 NumAttributesPerSet = 20;
+	static constexpr double TimeoutSeconds = 10.0;
+
+	/** Rows a WindowHeight tall list can show, with room to spare: more generated rows means rows aren't virtualized */
+	static constexpr int32 MaxVisibleRows = 100;
+	static constexpr float WindowHeight = 600.f;
+
+	TArray<FGBATestsAttributeIndexSource> Sources;
+
+	/** 10k synthetic attributes */
+	void GenerateSources()
+	{
+		Sources.Reset(NumSets * NumAttributesPerSet);
+		for (int32 SetIndex = 0; SetIndex < NumSets; ++SetIndex)
+		{
+			for (int32 AttributeIndex = 0; AttributeIndex < NumAttributesPerSet; ++AttributeIndex)
+			{
+				FGBATestsAttributeIndexSource& Source = Sources.AddDefaulted_GetRef();
+				Source.SetName = FString::Printf(TEXT("GBA_Generated_%d"), SetIndex);
+				Source.AttributeName = FString::Printf(TEXT("Attribute_%d"), AttributeIndex);
+			}
+		}
+	}
+
+	/**
+	 * Runs game thread tasks (where the index ready callback lands) and ticks Slate (which lays out and paints windows,
+	 * generating list rows) until InPredicate is true, or timeout
+	 */
+	bool PumpGameThreadUntil(const TFunctionRef<bool()> InPredicate) const
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		while (!InPredicate())
+		{
+			if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+			{
+				return false;
+			}
+
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FSlateApplication::Get().Tick();
+			FPlatformProcess::SleepNoStats(0.f);
+		}
+
+		return true;
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributePickerBenchmarkSpec)
+
+void FGBATestsAttributePickerBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		GenerateSources();
+	});
+
+	It(TEXT("measures time to first row with 10k synthetic attributes"), [this]()
+	{
+		if (!FSlateApplication::IsInitialized())
+		{
+			AddWarning(TEXT("Slate is not initialized, skipping"));
+			return;
+		}
+
+		// Synchronous baseline: what opening the picker costs the UI thread when the list is built in place
+		const double SyncStartTime = FPlatformTime::Seconds();
+		TArray<FGBATestsAttributeIndexSource> SyncSources = Sources;
+		const TSharedRef<const FGBATestsAttributeIndex> SyncIndex = FGBATestsAttributeIndex::Build(MoveTemp(SyncSources), {});
+		const double SyncBuildMs = (FPlatformTime::Seconds() - SyncStartTime) * 1000.0;
+
+		// Opened in a window, as the editor would, so that rows are generated by Slate layout and paint
+		const double OpenStartTime = FPlatformTime::Seconds();
+		const TSharedRef<SGBATestsAttributePicker> Picker = SNew(SGBATestsAttributePicker).Sources(Sources);
+		const TSharedRef<SWindow> Window = SNew(SWindow)
+			.Title(FText::FromString(TEXT("SGBATestsAttributePicker")))
+			.ClientSize(FVector2D(400.f, WindowHeight))
+			.SupportsMaximize(false)
+			.SupportsMinimize(false)
+			[
+				Picker
+			];
+		FSlateApplication::Get().AddWindow(Window);
+		const double ConstructMs = (FPlatformTime::Seconds() - OpenStartTime) * 1000.0;
+
+		ON_SCOPE_EXIT
+		{
+			FSlateApplication::Get().DestroyWindowImmediately(Window);
+		};
+
+		TestFalse(TEXT("Picker is populated asynchronously"), Picker->IsPopulated());
+
+		const bool bPopulated = PumpGameThreadUntil([&Picker]() { return Picker->IsPopulated(); });
+		const double IndexReadyMs = (FPlatformTime::Seconds() - OpenStartTime) * 1000.0;
+
+		const bool bFirstRow = bPopulated && PumpGameThreadUntil([&Picker]() { return Picker->GetNumGeneratedRows() > 0; });
+		const double FirstRowMs = (FPlatformTime::Seconds() - OpenStartTime) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("Synchronous build: %.2f ms"), SyncBuildMs));
+		AddInfo(FString::Printf(TEXT("Picker construct and window open (UI thread): %.2f ms"), ConstructMs));
+		AddInfo(FString::Printf(TEXT("Time to index ready: %.2f ms"), IndexReadyMs));
+
+		if (!TestTrue(TEXT("Picker populated before timeout"), bPopulated))
+		{
+			return;
+		}
+
+		TestEqual(TEXT("Every synthetic attribute is listed"), Picker->GetItems().Num(), SyncIndex->GetEntries().Num());
+
+		if (!bFirstRow)
+		{
+			AddWarning(TEXT("No row generated before timeout (window not painted, eg. -nullrhi?), time to first row not measured"));
+		}
+		else
+		{
+			AddInfo(FString::Printf(TEXT("Time to first row: %.2f ms, %d rows generated"), FirstRowMs, Picker->GetNumGeneratedRows()));
+			TestTrue(TEXT("Only visible rows are generated"), Picker->GetNumGeneratedRows() <= MaxVisibleRows);
+		}
+
+		// Incremental search over the precomputed index
+		const double SearchStartTime = FPlatformTime::Seconds();
+		Picker->SetSearchText(FText::FromString(TEXT("gba_generated_4")));
+		Picker->SetSearchText(FText::FromString(TEXT("gba_generated_42")));
+		Picker->SetSearchText(FText::FromString(TEXT("gba_generated_42.attribute_1")));
+		const double SearchMs = (FPlatformTime::Seconds() - SearchStartTime) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("Incremental search (3 keystrokes): %.2f ms, %d results"), SearchMs, Picker->GetItems().Num()));
+		TestTrue(TEXT("Search narrows down results"), Picker->GetItems().Num() > 0 && Picker->GetItems().Num() < SyncIndex->GetEntries().Num());
+	});
+
+	AfterEach([this]()
+	{
+		Sources.Empty();
+	});
+}
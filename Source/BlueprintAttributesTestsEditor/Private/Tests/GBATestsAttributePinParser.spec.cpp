@@ -0,0 +1,181 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "AttributeSet.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Engine/Blueprint.h"
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsAttributeReferenceSubsystem.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Subsystems/GBAEditorSubsystem.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributePinParserSpec, "BlueprintAttributes.Editor.GBATestsAttributePinParser", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+	const FString FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test.GBA_Reff_Test_C");
+	const FName FixtureAttributeName = TEXT("Ref_01");
+
+	/** Parses InDefaultValue with both parsers, and checks they agree */
+	void TestMatchesEditorSubsystem(const FString& InDefaultValue)
+	{
+		FString ExpectedPackageName;
+		FString ExpectedAttributeName;
+		UGBAEditorSubsystem::ParseAttributeFromDefaultValue(InDefaultValue, ExpectedPackageName, ExpectedAttributeName);
+
+		FGBATestsAttributePinView View;
+		FGBATestsAttributePinParser::Parse(InDefaultValue, View);
+
+		AddInfo(FString::Printf(TEXT("%s -> %s / %s"), *InDefaultValue, *FString(View.PackageName), *FString(View.AttributeName)));
+		TestTrue(FString::Printf(TEXT("AttributeName matches for %s"), *InDefaultValue), View.AttributeName.Equals(ExpectedAttributeName));
+
+		// Package names are compared once normalized, as both parsers may keep a different flavor of the owner path
+		if (!ExpectedAttributeName.IsEmpty())
+		{
+			const FName ExpectedPackage = UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(ExpectedPackageName);
+			const FName ActualPackage = UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(FString(View.PackageName));
+			TestTrue(FString::Printf(TEXT("PackageName matches for %s"), *InDefaultValue), ExpectedPackage == ActualPackage);
+		}
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributePinParserSpec)
+
+void FGBATestsAttributePinParserSpec::Define()
+{
+	Describe(TEXT("FGBATestsAttributePinParser::Parse()"), [this]()
+	{
+		It(TEXT("parses a quoted field path"), [this]()
+		{
+			FGBATestsAttributePinView View;
+			const bool bParsed = FGBATestsAttributePinParser::Parse(
+				TEXT("(Attribute=\"/Game/Foo/GBA_Bar.GBA_Bar_C:Health\",AttributeName=\"Health\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")"),
+				View
+			);
+
+			TestTrue(TEXT("Parsed"), bParsed);
+			TestTrue(TEXT("PackageName"), View.PackageName.Equals(TEXT("/Game/Foo/GBA_Bar.GBA_Bar_C")));
+			TestTrue(TEXT("AttributeName"), View.AttributeName.Equals(TEXT("Health")));
+		});
+
+		It(TEXT("parses an unquoted field path"), [this]()
+		{
+			FGBATestsAttributePinView View;
+			const bool bParsed = FGBATestsAttributePinParser::Parse(TEXT("(Attribute=/Game/Foo/GBA_Bar.GBA_Bar_C:Mana,AttributeName=\"Mana\")"), View);
+
+			TestTrue(TEXT("Parsed"), bParsed);
+			TestTrue(TEXT("PackageName"), View.PackageName.Equals(TEXT("/Game/Foo/GBA_Bar.GBA_Bar_C")));
+			TestTrue(TEXT("AttributeName"), View.AttributeName.Equals(TEXT("Mana")));
+		});
+
+		It(TEXT("falls back to AttributeName and AttributeOwner without a field path"), [this]()
+		{
+			FGBATestsAttributePinView View;
+			const bool bParsed = FGBATestsAttributePinParser::Parse(
+				TEXT("(Attribute=None,AttributeName=\"Stamina\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")"),
+				View
+			);
+
+			TestTrue(TEXT("Parsed"), bParsed);
+			TestTrue(TEXT("PackageName"), View.PackageName.Equals(TEXT("/Game/Foo/GBA_Bar.GBA_Bar_C")));
+			TestTrue(TEXT("AttributeName"), View.AttributeName.Equals(TEXT("Stamina")));
+		});
+
+		It(TEXT("returns false for empty or invalid values"), [this]()
+		{
+			FGBATestsAttributePinView View;
+			TestFalse(TEXT("Empty string"), FGBATestsAttributePinParser::Parse(TEXT(""), View));
+			TestFalse(TEXT("Empty struct"), FGBATestsAttributePinParser::Parse(TEXT("()"), View));
+			TestFalse(TEXT("None attribute"), FGBATestsAttributePinParser::Parse(TEXT("(Attribute=None,AttributeName=\"\",AttributeOwner=None)"), View));
+			TestFalse(TEXT("Garbage"), FGBATestsAttributePinParser::Parse(TEXT("not an attribute"), View));
+		});
+
+		It(TEXT("matches UGBAEditorSubsystem::ParseAttributeFromDefaultValue() on exported fixture attributes"), [this]()
+		{
+			const UClass* FixtureClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			if (!FixtureClass)
+			{
+				AddError(FString::Printf(TEXT("Unable to load fixture class from %s"), *FixtureAttributeSetLoadPath));
+				return;
+			}
+
+			FProperty* Property = FindFProperty<FProperty>(FixtureClass, FixtureAttributeName);
+			if (!Property)
+			{
+				AddError(FString::Printf(TEXT("Unable to find %s in %s"), *FixtureAttributeName.ToString(), *FixtureClass->GetName()));
+				return;
+			}
+
+			const FGameplayAttribute Attribute(Property);
+			const FGameplayAttribute DefaultAttribute;
+
+			FString DefaultValue;
+			FGameplayAttribute::StaticStruct()->ExportText(DefaultValue, &Attribute, &DefaultAttribute, nullptr, PPF_None, nullptr);
+
+			FGBATestsAttributePinView View;
+			TestTrue(TEXT("Parsed"), FGBATestsAttributePinParser::Parse(DefaultValue, View));
+			TestTrue(TEXT("AttributeName"), View.AttributeName.Equals(FixtureAttributeName.ToString()));
+
+			TestMatchesEditorSubsystem(DefaultValue);
+		});
+
+		It(TEXT("matches UGBAEditorSubsystem::ParseAttributeFromDefaultValue() on hand written values"), [this]()
+		{
+			TestMatchesEditorSubsystem(TEXT("(Attribute=\"/Game/Foo/GBA_Bar.GBA_Bar_C:Health\",AttributeName=\"Health\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")"));
+			TestMatchesEditorSubsystem(TEXT("(Attribute=/Game/Foo/GBA_Bar.GBA_Bar_C:Mana,AttributeName=\"Mana\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")"));
+			TestMatchesEditorSubsystem(TEXT(""));
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributePinParser::ScanBlueprints()"), [this]()
+	{
+		It(TEXT("finds K2 pins referencing the fixture attribute"), [this]()
+		{
+			const UClass* FixtureClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			const UBlueprint* Blueprint = FixtureClass ? UBlueprint::GetBlueprintFromClass(FixtureClass) : nullptr;
+			if (!Blueprint)
+			{
+				AddError(FString::Printf(TEXT("Unable to load Blueprint from %s"), *FixtureAttributeSetLoadPath));
+				return;
+			}
+
+			TArray<FGBATestsAttributePinReference> References;
+			FGBATestsAttributePinParser::ScanBlueprints({ Blueprint }, References);
+			AddInfo(FString::Printf(TEXT("References: %d"), References.Num()));
+
+			const int32 NumFixtureReferences = References.FilterByPredicate([this](const FGBATestsAttributePinReference& Reference)
+			{
+				return Reference.View.AttributeName.Equals(FixtureAttributeName.ToString());
+			}).Num();
+
+			TestTrue(TEXT("Fixture graph references Ref_01"), NumFixtureReferences > 0);
+
+			for (const FGBATestsAttributePinReference& Reference : References)
+			{
+				TestTrue(TEXT("Reference points back to the scanned Blueprint"), Reference.Blueprint == Blueprint);
+				TestTrue(TEXT("Reference pin is an attribute pin"), FGBATestsAttributePinParser::IsAttributePin(Reference.Pin));
+			}
+		});
+
+		It(TEXT("matches UGBAEditorSubsystem::ParseAttributeFromDefaultValue() on every fixture graph pin"), [this]()
+		{
+			const UClass* FixtureClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			const UBlueprint* Blueprint = FixtureClass ? UBlueprint::GetBlueprintFromClass(FixtureClass) : nullptr;
+			if (!Blueprint)
+			{
+				AddError(FString::Printf(TEXT("Unable to load Blueprint from %s"), *FixtureAttributeSetLoadPath));
+				return;
+			}
+
+			// Same pins as the GBAEditorSubsystem rename spec checks, compared on both set package and attribute name
+			TArray<FGBATestsAttributePinReference> References;
+			FGBATestsAttributePinParser::ScanBlueprints({ Blueprint }, References);
+			TestTrue(TEXT("Fixture graph has attribute pins"), References.Num() > 0);
+
+			for (const FGBATestsAttributePinReference& Reference : References)
+			{
+				TestMatchesEditorSubsystem(Reference.Pin->GetDefaultAsString());
+			}
+		});
+	});
+}
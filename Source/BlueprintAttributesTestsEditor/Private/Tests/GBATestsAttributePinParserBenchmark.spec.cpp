@@ -0,0 +1,106 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Subsystems/GBAEditorSubsystem.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributePinParserBenchmarkSpec, "BlueprintAttributes.Perf.Editor.GBATestsAttributePinParser", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	static constexpr int32 NumDefaultValues = 100000;
+	static constexpr int32 NumWarmupPasses = 2;
+	static constexpr int32 NumPasses = 10;
+
+	TArray<FString> DefaultValues;
+
+	/** Mimics pin defaults spread over many attribute sets, with the shape of FGameplayAttribute exported text */
+	void GenerateDefaultValues()
+	{
+		DefaultValues.Reset(NumDefaultValues);
+		for (int32 Index = 0; Index < NumDefaultValues; ++Index)
+		{
+			const int32 SetIndex = Index / 32;
+			DefaultValues.Add(FString::Printf(
+				TEXT("(Attribute=\"/Game/Generated/GBA_Generated_%d.GBA_Generated_%d_C:Attribute_%d\",AttributeName=\"Attribute_%d\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Generated/GBA_Generated_%d.GBA_Generated_%d_C'\")"),
+				SetIndex,
+				SetIndex,
+				Index,
+				Index,
+				SetIndex,
+				SetIndex
+			));
+		}
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributePinParserBenchmarkSpec)
+
+void FGBATestsAttributePinParserBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		GenerateDefaultValues();
+	});
+
+	It(TEXT("parses 100k pin default values faster than UGBAEditorSubsystem::ParseAttributeFromDefaultValue()"), [this]()
+	{
+		int32 NumParsed = 0;
+		const FGBATestsBenchmarkStats ViewStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, DefaultValues.Num(), [this, &NumParsed]()
+		{
+			NumParsed = 0;
+			FGBATestsAttributePinView View;
+			for (const FString& DefaultValue : DefaultValues)
+			{
+				NumParsed += FGBATestsAttributePinParser::Parse(DefaultValue, View) ? 1 : 0;
+			}
+		});
+
+		const FGBATestsBenchmarkStats LegacyStats = FGBATestsBenchmark::Run(NumWarmupPasses, NumPasses, DefaultValues.Num(), [this]()
+		{
+			FString PackageName;
+			FString AttributeName;
+			for (const FString& DefaultValue : DefaultValues)
+			{
+				UGBAEditorSubsystem::ParseAttributeFromDefaultValue(DefaultValue, PackageName, AttributeName);
+			}
+		});
+
+		AddInfo(FString::Printf(TEXT("FGBATestsAttributePinParser::Parse: %s"), *ViewStats.ToString()));
+		AddInfo(FString::Printf(TEXT("UGBAEditorSubsystem::ParseAttributeFromDefaultValue: %s"), *LegacyStats.ToString()));
+		AddInfo(FString::Printf(TEXT("Median speedup: %.2fx"), ViewStats.Median > 0.0 ? LegacyStats.Median / ViewStats.Median : 0.0));
+
+		TestEqual(TEXT("Every generated value is parsed"), NumParsed, DefaultValues.Num());
+		TestTrue(TEXT("View parser median is not slower"), ViewStats.Median <= LegacyStats.Median);
+	});
+
+	It(TEXT("stays correct on the generated values"), [this]()
+	{
+		FGBATestsAttributePinView View;
+		FString PackageName;
+		FString AttributeName;
+
+		int32 NumMismatches = 0;
+		for (const FString& DefaultValue : DefaultValues)
+		{
+			FGBATestsAttributePinParser::Parse(DefaultValue, View);
+			UGBAEditorSubsystem::ParseAttributeFromDefaultValue(DefaultValue, PackageName, AttributeName);
+			if (!View.AttributeName.Equals(AttributeName))
+			{
+				if (NumMismatches++ < 10)
+				{
+					AddError(FString::Printf(TEXT("Mismatch for %s: %s != %s"), *DefaultValue, *FString(View.AttributeName), *AttributeName));
+				}
+			}
+		}
+
+		TestEqual(TEXT("No mismatches"), NumMismatches, 0);
+	});
+
+	AfterEach([this]()
+	{
+		DefaultValues.Empty();
+	});
+}
@@ -0,0 +1,112 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "Editor.h"
+#include "GBATestsAttributeReferenceSubsystem.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeReferenceSubsystemSpec, "BlueprintAttributes.Editor.GBATestsAttributeReferenceSubsystem", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+	const FString FixturePackageName = TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test");
+	const FName FixtureAttributeName = TEXT("Ref_01");
+
+	UGBATestsAttributeReferenceSubsystem* Subsystem = nullptr;
+
+	int32 CountReferences(const TArray<FGBATestsAttributeReference>& InReferences, const FName& InReferencer) const
+	{
+		return InReferences.FilterByPredicate([&InReferencer](const FGBATestsAttributeReference& Reference)
+		{
+			return Reference.ReferencerPackage == InReferencer;
+		}).Num();
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeReferenceSubsystemSpec)
+
+void FGBATestsAttributeReferenceSubsystemSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Subsystem = GEditor ? GEditor->GetEditorSubsystem<UGBATestsAttributeReferenceSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			AddError(TEXT("Unable to get UGBATestsAttributeReferenceSubsystem"));
+		}
+	});
+
+	Describe(TEXT("UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage()"), [this]()
+	{
+		It(TEXT("returns package name from object paths and exported class paths"), [this]()
+		{
+			TestTrue(TEXT("Object path"), UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(TEXT("/Game/Foo/GBA_Bar.GBA_Bar_C")) == FName(TEXT("/Game/Foo/GBA_Bar")));
+
+			TestTrue(TEXT("Exported class path"), UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(TEXT("\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\"")) == FName(TEXT("/Game/Foo/GBA_Bar")));
+
+			TestTrue(TEXT("Package name"), UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(TEXT("/Game/Foo/GBA_Bar")) == FName(TEXT("/Game/Foo/GBA_Bar")));
+
+			TestTrue(TEXT("Empty path"), UGBATestsAttributeReferenceSubsystem::NormalizeOwnerPackage(TEXT("")).IsNone());
+		});
+	});
+
+	Describe(TEXT("UGBATestsAttributeReferenceSubsystem::ScanPackage()"), [this]()
+	{
+		It(TEXT("indexes K2 pins referencing the fixture attribute"), [this]()
+		{
+			const UPackage* Package = LoadPackage(nullptr, *FixturePackageName, LOAD_None);
+			if (!Package)
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s"), *FixturePackageName));
+				return;
+			}
+
+			Subsystem->ScanPackage(Package);
+			TestTrue(TEXT("Fixture package is indexed"), Subsystem->IsPackageIndexed(Package->GetFName()));
+
+			TArray<FGBATestsAttributeReference> References;
+			Subsystem->GetReferences(FGBATestsAttributeKey(Package->GetFName(), FixtureAttributeName), References);
+			for (const FGBATestsAttributeReference& Reference : References)
+			{
+				AddInfo(FString::Printf(TEXT("\t %s: %s"), *Reference.ReferencerPackage.ToString(), *Reference.Location));
+			}
+
+			const int32 NumReferences = CountReferences(References, Package->GetFName());
+			TestTrue(TEXT("Fixture graph references Ref_01"), NumReferences > 0);
+
+			// Re-scanning (as done on save) replaces entries rather than appending
+			Subsystem->ScanPackage(Package);
+
+			References.Reset();
+			Subsystem->GetReferences(FGBATestsAttributeKey(Package->GetFName(), FixtureAttributeName), References);
+			TestEqual(TEXT("Same number of references after re-scan"), CountReferences(References, Package->GetFName()), NumReferences);
+		});
+	});
+
+	Describe(TEXT("UGBATestsAttributeReferenceSubsystem::ResolveReferencingPackages()"), [this]()
+	{
+		It(TEXT("returns the true referencers and leaves no unresolved candidates"), [this]()
+		{
+			const FGBATestsAttributeKey Key(FName(*FixturePackageName), FixtureAttributeName);
+
+			const TArray<FName> Candidates = Subsystem->GetUnresolvedCandidates(Key.OwnerPackage);
+			AddInfo(FString::Printf(TEXT("Unresolved candidates: %d"), Candidates.Num()));
+
+			const TArray<FName> Referencers = Subsystem->ResolveReferencingPackages(Key);
+			for (const FName& Referencer : Referencers)
+			{
+				AddInfo(FString::Printf(TEXT("\t Referencer: %s"), *Referencer.ToString()));
+			}
+
+			TestTrue(TEXT("Fixture package references its own attribute"), Referencers.Contains(Key.OwnerPackage));
+			TestTrue(TEXT("No unresolved candidates left"), Subsystem->GetUnresolvedCandidates(Key.OwnerPackage).IsEmpty());
+		});
+
+		It(TEXT("returns nothing for unknown attributes"), [this]()
+		{
+			const FGBATestsAttributeKey Key(FName(*FixturePackageName), TEXT("GBA_Unknown_Attribute"));
+			TestTrue(TEXT("No referencers"), Subsystem->ResolveReferencingPackages(Key).IsEmpty());
+		});
+	});
+}
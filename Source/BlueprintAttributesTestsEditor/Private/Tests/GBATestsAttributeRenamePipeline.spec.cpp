@@ -0,0 +1,130 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributePinParser.h"
+#include "GBATestsAttributeRenamePipeline.h"
+#include "GBATestsGeneratedBlueprints.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeRenamePipelineSpec, "BlueprintAttributes.Editor.GBATestsAttributeRenamePipeline", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+	const FString FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test.GBA_Reff_Test_C");
+	static constexpr int32 NumGeneratedBlueprints = 3;
+
+	const FName OldName = TEXT("Ref_01");
+	const FName NewName = TEXT("Renamed_Ref_01");
+
+	TWeakObjectPtr<UBlueprint> AttributeSetBlueprint;
+	TArray<UBlueprint*> GeneratedBlueprints;
+
+	/** Checks every generated Blueprint pin now references InAttributeName, and compiled fine */
+	void TestGeneratedBlueprints(const FName& InAttributeName)
+	{
+		for (const UBlueprint* Blueprint : GeneratedBlueprints)
+		{
+			const FString DefaultValue = GBATestsGeneratedBlueprints::GetAttributePinDefaultValue(Blueprint);
+
+			FGBATestsAttributePinView View;
+			FGBATestsAttributePinParser::Parse(DefaultValue, View);
+
+			TestTrue(FString::Printf(TEXT("%s pin references %s (%s)"), *Blueprint->GetName(), *InAttributeName.ToString(), *DefaultValue), View.AttributeName.Equals(InAttributeName.ToString()));
+			TestTrue(FString::Printf(TEXT("%s compiled without error"), *Blueprint->GetName()), Blueprint->Status != BS_Error);
+		}
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeRenamePipelineSpec)
+
+void FGBATestsAttributeRenamePipelineSpec::Define()
+{
+	Describe(TEXT("FGBATestsAttributeRenamePipeline::PatchDefaultValue()"), [this]()
+	{
+		It(TEXT("should patch both the field path and AttributeName"), [this]()
+		{
+			FString Patched;
+			const bool bPatched = FGBATestsAttributeRenamePipeline::PatchDefaultValue(
+				TEXT("(Attribute=\"/Game/Foo/GBA_Bar.GBA_Bar_C:Health\",AttributeName=\"Health\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")"),
+				TEXT("Health"),
+				TEXT("Vitality"),
+				Patched
+			);
+
+			TestTrue(TEXT("Patched"), bPatched);
+			TestEqual(
+				TEXT("Patched value"),
+				Patched,
+				TEXT("(Attribute=\"/Game/Foo/GBA_Bar.GBA_Bar_C:Vitality\",AttributeName=\"Vitality\",AttributeOwner=\"/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'\")")
+			);
+		});
+
+		It(TEXT("should leave attributes sharing a prefix untouched"), [this]()
+		{
+			FString Patched;
+			const FString DefaultValue = TEXT("(Attribute=\"/Game/Foo/GBA_Bar.GBA_Bar_C:MaxHealth\",AttributeName=\"MaxHealth\")");
+			TestFalse(TEXT("Not patched"), FGBATestsAttributeRenamePipeline::PatchDefaultValue(DefaultValue, TEXT("Max"), TEXT("Min"), Patched));
+			TestEqual(TEXT("Unchanged value"), Patched, DefaultValue);
+
+			TestFalse(TEXT("Suffix not patched"), FGBATestsAttributeRenamePipeline::PatchDefaultValue(DefaultValue, TEXT("Health"), TEXT("Vitality"), Patched));
+			TestEqual(TEXT("Unchanged value"), Patched, DefaultValue);
+		});
+	});
+
+	Describe(TEXT("FGBATestsAttributeRenamePipeline::Run()"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			const UClass* FixtureClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+			FProperty* Property = FixtureClass ? FindFProperty<FProperty>(FixtureClass, OldName) : nullptr;
+			if (!Property)
+			{
+				AddError(FString::Printf(TEXT("Unable to load %s from %s"), *OldName.ToString(), *FixtureAttributeSetLoadPath));
+				return;
+			}
+
+			AttributeSetBlueprint = UBlueprint::GetBlueprintFromClass(FixtureClass);
+
+			const FGameplayAttribute Attribute(Property);
+			for (int32 Index = 0; Index < NumGeneratedBlueprints; ++Index)
+			{
+				GeneratedBlueprints.Add(GBATestsGeneratedBlueprints::CreateAttributeReferencer(FString::Printf(TEXT("BP_GBATests_RenamePipeline_%d"), Index), Attribute));
+			}
+		});
+
+		It(TEXT("should patch and recompile every dependent in one batch"), [this]()
+		{
+			if (!AttributeSetBlueprint.IsValid())
+			{
+				AddError(TEXT("Invalid attribute set Blueprint"));
+				return;
+			}
+
+			FGBATestsAttributeRenamePipeline Pipeline(AttributeSetBlueprint.Get(), OldName, NewName);
+			Pipeline.AddDependents(GeneratedBlueprints);
+
+			const FGBATestsAttributeRenameResult Result = Pipeline.Run(EGBATestsAttributeRenameCompileMode::Batched);
+			AddInfo(Result.ToString());
+
+			TestTrue(TEXT("Every generated pin patched"), Result.NumPatchedPins >= NumGeneratedBlueprints);
+			TestTrue(TEXT("Attribute set compiled without error"), AttributeSetBlueprint->Status != BS_Error);
+			TestGeneratedBlueprints(NewName);
+		});
+
+		AfterEach([this]()
+		{
+			if (AttributeSetBlueprint.IsValid() && !FindFProperty<FProperty>(AttributeSetBlueprint->GeneratedClass, OldName))
+			{
+				AddInfo(FString::Printf(TEXT("Restore %s BP to original state"), *AttributeSetBlueprint->GetName()));
+
+				FGBATestsAttributeRenamePipeline Pipeline(AttributeSetBlueprint.Get(), NewName, OldName);
+				Pipeline.AddDependents(GeneratedBlueprints);
+				Pipeline.Run(EGBATestsAttributeRenameCompileMode::Batched);
+			}
+
+			GBATestsGeneratedBlueprints::Destroy(GeneratedBlueprints);
+			GeneratedBlueprints.Reset();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		});
+	});
+}
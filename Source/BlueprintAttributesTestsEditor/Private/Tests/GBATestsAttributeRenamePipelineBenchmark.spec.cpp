@@ -0,0 +1,137 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestsAttributeRenamePipeline.h"
+#include "GBATestsGeneratedBlueprints.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "GBATestsFlags.h"
+#endif
+
+BEGIN_DEFINE_SPEC(FGBATestsAttributeRenamePipelineBenchmarkSpec, "BlueprintAttributes.Perf.Editor.GBATestsAttributeRenamePipeline", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	const FString FixtureAttributeSetLoadPath = TEXT("/BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test.GBA_Reff_Test_C");
+	static constexpr int32 NumGeneratedBlueprints = 200;
+
+	const FName OldName = TEXT("Ref_01");
+	const FName NewName = TEXT("Renamed_Ref_01");
+
+	/** Timed runs per strategy, after a discarded warm-up run each */
+	static constexpr int32 NumIterations = 4;
+
+	TWeakObjectPtr<UBlueprint> AttributeSetBlueprint;
+	TArray<UBlueprint*> GeneratedBlueprints;
+
+	/**
+	 * Renames OldName to NewName with InCompileMode, then renames it back (untimed) so that every run of either strategy
+	 * starts from the same fixture, in the same rename direction
+	 */
+	FGBATestsAttributeRenameResult RunRename(const EGBATestsAttributeRenameCompileMode InCompileMode)
+	{
+		FGBATestsAttributeRenamePipeline Pipeline(AttributeSetBlueprint.Get(), OldName, NewName);
+		Pipeline.AddDependents(GeneratedBlueprints);
+		const FGBATestsAttributeRenameResult Result = Pipeline.Run(InCompileMode);
+
+		FGBATestsAttributeRenamePipeline RestorePipeline(AttributeSetBlueprint.Get(), NewName, OldName);
+		RestorePipeline.AddDependents(GeneratedBlueprints);
+		RestorePipeline.Run(EGBATestsAttributeRenameCompileMode::Batched);
+
+		return Result;
+	}
+
+	static double GetMedianSeconds(const TArray<FGBATestsAttributeRenameResult>& InResults)
+	{
+		TArray<double> Seconds;
+		for (const FGBATestsAttributeRenameResult& Result : InResults)
+		{
+			Seconds.Add(Result.GetTotalSeconds());
+		}
+
+		if (Seconds.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		Seconds.Sort();
+		return Seconds[Seconds.Num() / 2];
+	}
+
+END_DEFINE_SPEC(FGBATestsAttributeRenamePipelineBenchmarkSpec)
+
+void FGBATestsAttributeRenamePipelineBenchmarkSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		const UClass* FixtureClass = StaticLoadClass(UAttributeSet::StaticClass(), nullptr, *FixtureAttributeSetLoadPath);
+		FProperty* Property = FixtureClass ? FindFProperty<FProperty>(FixtureClass, OldName) : nullptr;
+		if (!Property)
+		{
+			AddError(FString::Printf(TEXT("Unable to load %s from %s"), *OldName.ToString(), *FixtureAttributeSetLoadPath));
+			return;
+		}
+
+		AttributeSetBlueprint = UBlueprint::GetBlueprintFromClass(FixtureClass);
+
+		const FGameplayAttribute Attribute(Property);
+		for (int32 Index = 0; Index < NumGeneratedBlueprints; ++Index)
+		{
+			GeneratedBlueprints.Add(GBATestsGeneratedBlueprints::CreateAttributeReferencer(FString::Printf(TEXT("BP_GBATests_RenameBenchmark_%d"), Index), Attribute));
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+
+	It(TEXT("renames an attribute referenced by 200 Blueprints, batched vs per asset, in the same direction"), [this]()
+	{
+		if (!AttributeSetBlueprint.IsValid())
+		{
+			AddError(TEXT("Invalid attribute set Blueprint"));
+			return;
+		}
+
+		// Warm-up, discarded: first compiles of the generated Blueprints and first reinstancing are paid by neither strategy
+		RunRename(EGBATestsAttributeRenameCompileMode::Batched);
+		RunRename(EGBATestsAttributeRenameCompileMode::PerAsset);
+
+		// Strategies alternate which one runs first, so that neither always follows the other
+		TArray<FGBATestsAttributeRenameResult> BatchedResults;
+		TArray<FGBATestsAttributeRenameResult> PerAssetResults;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			if (Iteration % 2 == 0)
+			{
+				BatchedResults.Add(RunRename(EGBATestsAttributeRenameCompileMode::Batched));
+				PerAssetResults.Add(RunRename(EGBATestsAttributeRenameCompileMode::PerAsset));
+			}
+			else
+			{
+				PerAssetResults.Add(RunRename(EGBATestsAttributeRenameCompileMode::PerAsset));
+				BatchedResults.Add(RunRename(EGBATestsAttributeRenameCompileMode::Batched));
+			}
+		}
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			AddInfo(FString::Printf(TEXT("Batched #%d: %s"), Iteration, *BatchedResults[Iteration].ToString()));
+			AddInfo(FString::Printf(TEXT("Per asset #%d: %s"), Iteration, *PerAssetResults[Iteration].ToString()));
+		}
+
+		const double BatchedMedian = GetMedianSeconds(BatchedResults);
+		const double PerAssetMedian = GetMedianSeconds(PerAssetResults);
+		AddInfo(FString::Printf(TEXT("Median total: batched %.3f s, per asset %.3f s"), BatchedMedian, PerAssetMedian));
+		AddInfo(FString::Printf(TEXT("Speedup: %.2fx"), BatchedMedian > 0.0 ? PerAssetMedian / BatchedMedian : 0.0));
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			TestEqual(FString::Printf(TEXT("Both runs patch the same pins (iteration %d)"), Iteration), BatchedResults[Iteration].NumPatchedPins, PerAssetResults[Iteration].NumPatchedPins);
+		}
+		TestTrue(TEXT("Every generated Blueprint is patched"), BatchedResults[0].NumPatchedPins >= NumGeneratedBlueprints);
+	});
+
+	AfterEach([this]()
+	{
+		GBATestsGeneratedBlueprints::Destroy(GeneratedBlueprints);
+		GeneratedBlueprints.Reset();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	});
+}
@@ -0,0 +1,119 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AttributeSet.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "UObject/Package.h"
+
+/** Transient Blueprints used by editor specs that need many assets referencing an attribute */
+namespace GBATestsGeneratedBlueprints
+{
+	/** Returns the attribute exported the way K2 pins store it */
+	inline FString ExportAttribute(const FGameplayAttribute& InAttribute)
+	{
+		const FGameplayAttribute DefaultAttribute;
+
+		FString DefaultValue;
+		FGameplayAttribute::StaticStruct()->ExportText(DefaultValue, &InAttribute, &DefaultAttribute, nullptr, PPF_None, nullptr);
+		return DefaultValue;
+	}
+
+	/** Creates an actor Blueprint whose event graph calls GetFloatAttribute() with InAttribute as pin default value */
+	inline UBlueprint* CreateAttributeReferencer(const FString& InName, const FGameplayAttribute& InAttribute)
+	{
+		UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/GBATests/%s"), *InName));
+		Package->SetFlags(RF_Transient);
+
+		UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+			AActor::StaticClass(),
+			Package,
+			FName(*InName),
+			BPTYPE_Normal,
+			UBlueprint::StaticClass(),
+			UBlueprintGeneratedClass::StaticClass()
+		);
+
+		UEdGraph* Graph = Blueprint ? FBlueprintEditorUtils::FindEventGraph(Blueprint) : nullptr;
+		if (!Graph)
+		{
+			return Blueprint;
+		}
+
+		UK2Node_CallFunction* Node = NewObject<UK2Node_CallFunction>(Graph);
+		Node->FunctionReference.SetExternalMember(
+			GET_FUNCTION_NAME_CHECKED(UAbilitySystemBlueprintLibrary, GetFloatAttribute),
+			UAbilitySystemBlueprintLibrary::StaticClass()
+		);
+
+		Graph->AddNode(Node, false, false);
+		Node->CreateNewGuid();
+		Node->PostPlacedNewNode();
+		Node->AllocateDefaultPins();
+
+		if (UEdGraphPin* Pin = Node->FindPin(TEXT("Attribute"), EGPD_Input))
+		{
+			Pin->DefaultValue = ExportAttribute(InAttribute);
+		}
+
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		return Blueprint;
+	}
+
+	/** Returns the first FGameplayAttribute pin default value found in the Blueprint graphs */
+	inline FString GetAttributePinDefaultValue(const UBlueprint* InBlueprint)
+	{
+		TArray<UEdGraph*> Graphs;
+		InBlueprint->GetAllGraphs(Graphs);
+
+		for (const UEdGraph* Graph : Graphs)
+		{
+			TArray<UK2Node_CallFunction*> Nodes;
+			Graph->GetNodesOfClass(Nodes);
+
+			for (const UK2Node_CallFunction* Node : Nodes)
+			{
+				for (const UEdGraphPin* Pin : Node->Pins)
+				{
+					if (Pin->Direction == EGPD_Input
+						&& Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Struct
+						&& Pin->PinType.PinSubCategoryObject == FGameplayAttribute::StaticStruct())
+					{
+						return Pin->DefaultValue;
+					}
+				}
+			}
+		}
+
+		return FString();
+	}
+
+	/** Marks generated Blueprints (and their classes) for destruction on next GC */
+	inline void Destroy(const TArray<UBlueprint*>& InBlueprints)
+	{
+		for (UBlueprint* Blueprint : InBlueprints)
+		{
+			if (!Blueprint)
+			{
+				continue;
+			}
+
+			if (UClass* GeneratedClass = Blueprint->GeneratedClass)
+			{
+				GeneratedClass->ClearFlags(RF_Public | RF_Standalone);
+				GeneratedClass->MarkAsGarbage();
+			}
+
+			Blueprint->ClearFlags(RF_Public | RF_Standalone);
+			Blueprint->MarkAsGarbage();
+			Blueprint->GetOutermost()->MarkAsGarbage();
+		}
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#include "Widgets/SGBATestsAttributePicker.h"
+
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "SGBATestsAttributePicker"
+
+void SGBATestsAttributePicker::Construct(const FArguments& InArgs)
+{
+	OnAttributePicked = InArgs._OnAttributePicked;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SAssignNew(SearchBox, SSearchBox)
+			.OnTextChanged(this, &SGBATestsAttributePicker::HandleSearchTextChanged)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(STextBlock)
+			.Text(LOCTEXT("Loading", "Loading attributes..."))
+			.Visibility_Lambda([this]()
+			{
+				return IsPopulated() ? EVisibility::Collapsed : EVisibility::Visible;
+			})
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(ListView, SListView<FGBATestsAttributeIndexEntryPtr>)
+			.ListItemsSource(&Items)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SGBATestsAttributePicker::HandleGenerateRow)
+			.OnSelectionChanged(this, &SGBATestsAttributePicker::HandleSelectionChanged)
+		]
+	];
+
+	const FGBATestsAttributeIndex::FOnIndexReady OnIndexReady = FGBATestsAttributeIndex::FOnIndexReady::CreateSP(this, &SGBATestsAttributePicker::HandleIndexReady);
+	if (InArgs._Sources.IsEmpty())
+	{
+		FGBATestsAttributeIndex::RequestCached(InArgs._FilterList, OnIndexReady);
+	}
+	else
+	{
+		TArray<FGBATestsAttributeIndexSource> Sources = InArgs._Sources;
+		FGBATestsAttributeIndex::BuildAsync(MoveTemp(Sources), InArgs._FilterList, OnIndexReady);
+	}
+}
+
+void SGBATestsAttributePicker::SetSearchText(const FText& InSearchText)
+{
+	if (SearchBox.IsValid())
+	{
+		SearchBox->SetText(InSearchText);
+	}
+
+	HandleSearchTextChanged(InSearchText);
+}
+
+void SGBATestsAttributePicker::HandleIndexReady(const TSharedRef<const FGBATestsAttributeIndex> InIndex)
+{
+	Index = InIndex;
+
+	LastQuery.Reset();
+	RefreshItems(SearchText.ToString());
+}
+
+void SGBATestsAttributePicker::HandleSearchTextChanged(const FText& InSearchText)
+{
+	SearchText = InSearchText;
+	if (IsPopulated())
+	{
+		RefreshItems(SearchText.ToString());
+	}
+}
+
+TSharedRef<ITableRow> SGBATestsAttributePicker::HandleGenerateRow(const FGBATestsAttributeIndexEntryPtr InItem, const TSharedRef<STableViewBase>& InOwnerTable)
+{
+	++NumGeneratedRows;
+
+	return SNew(STableRow<FGBATestsAttributeIndexEntryPtr>, InOwnerTable)
+	[
+		SNew(STextBlock)
+		.Text(FText::FromString(InItem->DisplayName))
+		.HighlightText_Lambda([this]() { return SearchText; })
+	];
+}
+
+void SGBATestsAttributePicker::HandleSelectionChanged(const FGBATestsAttributeIndexEntryPtr InItem, const ESelectInfo::Type InSelectInfo)
+{
+	if (InItem.IsValid() && InSelectInfo != ESelectInfo::Direct)
+	{
+		OnAttributePicked.ExecuteIfBound(InItem->Attribute);
+	}
+}
+
+void SGBATestsAttributePicker::RefreshItems(const FString& InQuery)
+{
+	check(Index.IsValid());
+
+	const FString Query = InQuery.TrimStartAndEnd();
+
+	// A longer query can only match a subset of the previous results
+	const bool bNarrowing = !LastQuery.IsEmpty() && Query.StartsWith(LastQuery);
+	TArray<FGBATestsAttributeIndexEntryPtr> Candidates = bNarrowing ? MoveTemp(Items) : TArray<FGBATestsAttributeIndexEntryPtr>();
+	FGBATestsAttributeIndex::Search(Query, bNarrowing ? Candidates : Index->GetEntries(), Items);
+	LastQuery = Query;
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
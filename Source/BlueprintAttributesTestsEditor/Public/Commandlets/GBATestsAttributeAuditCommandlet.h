@@ -0,0 +1,28 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GBATestsAttributeAuditCommandlet.generated.h"
+
+/**
+ * Lists every attribute reference (K2 pins, GE modifiers, execution captures, attribute init DataTable rows) and
+ * flags dangling ones. See FGBATestsAttributeAudit.
+ *
+ * Usage:
+ *
+ *     UnrealEditor-Cmd.exe <Project> -run=GBATestsAttributeAudit [-Paths=/Game+/MyPlugin] [-Report=<File>] [-DanglingOnly] [-BatchSize=64]
+ *
+ * Returns 1 if any dangling reference is found.
+ */
+UCLASS()
+class UGBATestsAttributeAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGBATestsAttributeAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
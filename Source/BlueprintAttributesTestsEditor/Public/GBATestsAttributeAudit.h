@@ -0,0 +1,147 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class UBlueprint;
+class UDataTable;
+class UPackage;
+
+/** Where an audited attribute reference is stored */
+enum class EGBATestsAttributeAuditSource : uint8
+{
+	/** Default value of a FGameplayAttribute input pin on a K2 Node */
+	K2Pin,
+
+	/** FGameplayAttribute property value (GE modifiers, execution captures, ...) */
+	Property,
+
+	/** FAttributeMetaData DataTable row (SetName.AttributeName) */
+	DataTableRow,
+};
+
+/** A single audited attribute reference */
+struct FGBATestsAttributeAuditEntry
+{
+	EGBATestsAttributeAuditSource Source = EGBATestsAttributeAuditSource::K2Pin;
+
+	/** Package storing the reference */
+	FName Package;
+
+	/** Human readable location within the package */
+	FString Location;
+
+	/** Owning attribute set package (K2 pins, properties) or attribute set name (DataTable rows) */
+	FString Owner;
+
+	FString AttributeName;
+
+	/** Raw text, only kept for K2 pins until parsed */
+	FString RawValue;
+
+	/** Reference does not resolve to a valid attribute */
+	bool bDangling = false;
+};
+
+/** Valid attributes, keyed both by attribute set package and attribute set name */
+struct BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeAuditCatalogue
+{
+	void AddAttribute(const FName& InPackage, const FString& InSetName, const FString& InAttributeName);
+
+	/** Adds every valid attribute (FGBAUtils::IsValidProperty()) of the attribute set class */
+	void AddAttributeSet(const UClass* InClass);
+
+	/** Adds every valid attribute of every loaded attribute set class */
+	void AddLoadedAttributeSets();
+
+	bool HasSetName(const FString& InSetName) const { return AttributesBySetName.Contains(InSetName); }
+
+	bool IsValidForPackage(const FName& InPackage, const FString& InAttributeName) const;
+	bool IsValidForSetName(const FString& InSetName, const FString& InAttributeName) const;
+
+	int32 Num() const { return NumAttributes; }
+
+private:
+	TMap<FName, TSet<FString>> AttributesByPackage;
+	TMap<FString, TSet<FString>> AttributesBySetName;
+	int32 NumAttributes = 0;
+};
+
+/**
+ * Lists every attribute reference of a project, and flags dangling ones (eg. after a rename).
+ *
+ * Candidates are narrowed down from the asset registry alone: attribute set packages and their referencers,
+ * gameplay effect and calculation Blueprints, and FAttributeMetaData DataTables. Only those are loaded, in
+ * async batches, and every package a batch requested is unloaded before the next one to keep memory bounded (packages
+ * loaded before the audit, or by anyone else meanwhile, are left alone). Gathering
+ * references out of loaded objects is game thread work, parsing and validation run in parallel.
+ *
+ * DataTable rows name their attribute set rather than depend on it: sets they name that no candidate loaded (eg.
+ * outside the audited paths) are resolved from the asset registry before rows are validated.
+ */
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeAudit
+{
+public:
+	struct FOptions
+	{
+		/** Content paths to audit */
+		TArray<FName> Paths = { TEXT("/Game") };
+
+		/** Number of packages loaded per batch */
+		int32 BatchSize = 64;
+	};
+
+	/** Finds candidate packages from the asset registry, without loading anything */
+	void GatherCandidates(const FOptions& InOptions);
+
+	/** Loads candidates, gathers and validates their references */
+	void Run(const FOptions& InOptions);
+
+	/** Validates entries against the catalogue (in parallel, entries are independent) */
+	static void Validate(const FGBATestsAttributeAuditCatalogue& InCatalogue, TArray<FGBATestsAttributeAuditEntry>& InOutEntries);
+
+	/** Parses K2 pin raw values (in parallel) into Owner / AttributeName */
+	static void ParsePinEntries(TArray<FGBATestsAttributeAuditEntry>& InOutEntries);
+
+	/** Gathers references of a loaded object (game thread) */
+	static void GatherObjectEntries(const UObject* InObject, TArray<FGBATestsAttributeAuditEntry>& OutEntries);
+
+	/** Gathers FAttributeMetaData rows of a DataTable (rows are named SetName.AttributeName) */
+	static void GatherDataTableEntries(const UDataTable* InDataTable, TArray<FGBATestsAttributeAuditEntry>& OutEntries);
+
+	/** Writes a compact CSV report (Status,Source,Package,Location,Owner,Attribute) */
+	bool WriteReport(const FString& InFilename, bool bInDanglingOnly) const;
+
+	const TArray<FName>& GetCandidates() const { return Candidates; }
+	const TArray<FGBATestsAttributeAuditEntry>& GetEntries() const { return Entries; }
+	int32 GetNumDangling() const;
+
+	static FString GetDefaultReportFilename();
+	static const TCHAR* LexToString(EGBATestsAttributeAuditSource InSource);
+
+private:
+	/** Loads the attribute sets named by DataTable rows the catalogue doesn't know about yet */
+	void ResolveDataTableOwners();
+
+	/** Requests InPackageName, recorded in LoadedPackages once loaded unless it already was before Run() */
+	void RequestPackage(const FString& InPackageName);
+
+	/** Lets packages the audit requested go on next GC */
+	void ReleaseLoadedPackages();
+
+	TArray<FName> Candidates;
+
+	/** Packages loaded when Run() started */
+	TSet<FName> PreloadedPackages;
+
+	/** Packages loaded by the audit's own requests, not released yet */
+	TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+
+	/** Every attribute set class of the project, by attribute set name (see FGBAUtils::GetAttributeClassName()) */
+	TMap<FString, FTopLevelAssetPath> AttributeSetClassPaths;
+
+	TArray<FGBATestsAttributeAuditEntry> Entries;
+	FGBATestsAttributeAuditCatalogue Catalogue;
+};
@@ -0,0 +1,88 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Case insensitive prefix trie compiled from an attribute filter list.
+ *
+ * Same semantics as UGBAEditorSettings::IsAttributeFiltered(): an attribute is filtered when any non empty filter is
+ * a prefix of its name (eg. "ExampleSet.Some" filters "ExampleSet.SomeAttribute"). Matching costs a single walk
+ * over the attribute name, regardless of the number of filters.
+ */
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeFilterTrie
+{
+public:
+	explicit FGBATestsAttributeFilterTrie(const TArray<FString>& InFilters);
+
+	bool IsFiltered(FStringView InAttributeName) const;
+
+	int32 GetNumNodes() const { return Nodes.Num(); }
+
+private:
+	/** Children are stored as a linked list of siblings, fan-out is low past the first few characters */
+	struct FNode
+	{
+		int32 FirstChild = INDEX_NONE;
+		int32 NextSibling = INDEX_NONE;
+		TCHAR Char = 0;
+		bool bTerminal = false;
+	};
+
+	/** Nodes[0] is the root */
+	TArray<FNode> Nodes;
+
+	int32 FindChild(int32 InNodeIndex, TCHAR InChar) const;
+	int32 FindOrAddChild(int32 InNodeIndex, TCHAR InChar);
+};
+
+/**
+ * Cached entry point for attribute filtering.
+ *
+ * The trie for a given filter list is compiled once and reused until the list changes (or the editor settings are
+ * edited, see FGBATestsEditorModule). Safe to call from any thread.
+ *
+ * GetTrie() and IsAttributeFiltered() compare the list against the cached one on every call, which costs as much as
+ * the filters are long: callers filtering names one at a time against a long lived list (eg. the editor settings
+ * one) should keep an FHandle instead, which only checks the cache generation.
+ */
+struct BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeFilter
+{
+	/** Trie of a filter list held by the caller, recompiled when the cache is reset (settings edited) */
+	class BLUEPRINTATTRIBUTESTESTSEDITOR_API FHandle
+	{
+	public:
+		/** InFilters is referenced, not copied, and must outlive the handle (eg. the editor settings list) */
+		explicit FHandle(const TArray<FString>& InFilters);
+
+		bool IsFiltered(FStringView InAttributeName);
+
+	private:
+		const TArray<FString>& Filters;
+		TSharedPtr<const FGBATestsAttributeFilterTrie> Trie;
+		uint32 Generation = 0;
+	};
+
+	/** Returns the compiled trie for the filter list, building it if the list differs from the cached one */
+	static TSharedRef<const FGBATestsAttributeFilterTrie> GetTrie(const TArray<FString>& InFilters);
+
+	/** Drop-in for UGBAEditorSettings::IsAttributeFiltered() */
+	static bool IsAttributeFiltered(const TArray<FString>& InFilters, const FString& InAttributeName);
+
+	/** Removes every filtered attribute name from the list, in one pass and with a single cache lookup */
+	static void FilterAttributes(const TArray<FString>& InFilters, TArray<FString>& InOutAttributeNames);
+
+	/** Drops the cached trie, and invalidates every FHandle */
+	static void ResetCache();
+
+	/** Incremented by ResetCache() */
+	static uint32 GetGeneration();
+
+private:
+	static FRWLock CacheLock;
+	static TArray<FString> CachedFilters;
+	static TSharedPtr<const FGBATestsAttributeFilterTrie> CachedTrie;
+	static std::atomic<uint32> Generation;
+};
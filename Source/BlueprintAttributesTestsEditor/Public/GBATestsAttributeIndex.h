@@ -0,0 +1,98 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+
+/** Raw attribute as gathered on the game thread, before any formatting */
+struct FGBATestsAttributeIndexSource
+{
+	FGameplayAttribute Attribute;
+
+	/** Owning attribute set name, without trailing _C */
+	FString SetName;
+
+	FString AttributeName;
+};
+
+/** Picker ready attribute, with its display and search strings precomputed */
+struct FGBATestsAttributeIndexEntry
+{
+	FGameplayAttribute Attribute;
+
+	/** SetName.AttributeName, as displayed in the picker and matched against filters */
+	FString DisplayName;
+
+	/** Lowercase DisplayName, used by incremental search */
+	FString SearchText;
+};
+
+using FGBATestsAttributeIndexEntryPtr = TSharedPtr<const FGBATestsAttributeIndexEntry>;
+
+/**
+ * Attribute list backing the attribute picker.
+ *
+ * Enumerating attribute sets has to happen on the game thread, but it only gathers properties. Formatting,
+ * filtering, sorting and search strings are computed on a background task, and the result is cached until
+ * invalidated (Blueprint compiled, filters changed).
+ */
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeIndex
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnIndexReady, TSharedRef<const FGBATestsAttributeIndex>);
+
+	/** Gathers every attribute of every attribute set (game thread only) */
+	static void GatherSources(TArray<FGBATestsAttributeIndexSource>& OutSources);
+
+	/** Builds an index synchronously, on the calling thread */
+	static TSharedRef<const FGBATestsAttributeIndex> Build(TArray<FGBATestsAttributeIndexSource>&& InSources, const TArray<FString>& InFilters);
+
+	/**
+	 * Builds an index on a background task. InOnReady is executed on the game thread, unless the index was
+	 * invalidated in the meantime (the stale result is then dropped).
+	 */
+	static void BuildAsync(TArray<FGBATestsAttributeIndexSource>&& InSources, const TArray<FString>& InFilters, FOnIndexReady InOnReady);
+
+	/**
+	 * Returns the cached index through InOnReady, right away if it is up to date for the filter list, otherwise
+	 * once rebuilt in the background from all attribute sets.
+	 */
+	static void RequestCached(const TArray<FString>& InFilters, FOnIndexReady InOnReady);
+
+	/** Returns the cached index if any, without requesting a build */
+	static TSharedPtr<const FGBATestsAttributeIndex> GetCached();
+
+	/** Drops the cached index and discards in-flight builds (pending requests are served by a new build) */
+	static void Invalidate();
+
+	const TArray<FGBATestsAttributeIndexEntryPtr>& GetEntries() const { return Entries; }
+
+	/**
+	 * Returns entries matching the query, best matches first. Substring matches rank above fuzzy (in order
+	 * subsequence) matches, earlier and tighter matches rank above later ones.
+	 *
+	 * InCandidates allows incremental search: when the query extends the previous one, only the previous
+	 * results need to be searched.
+	 */
+	static void Search(FStringView InQuery, const TArray<FGBATestsAttributeIndexEntryPtr>& InCandidates, TArray<FGBATestsAttributeIndexEntryPtr>& OutResults);
+
+	/** Returns the match score of an already lowercase query within SearchText, or INDEX_NONE if not matching (lower is better) */
+	static int32 ScoreMatch(FStringView InLowerQuery, FStringView InSearchText);
+
+private:
+	TArray<FGBATestsAttributeIndexEntryPtr> Entries;
+
+	static TSharedPtr<const FGBATestsAttributeIndex> CachedIndex;
+	static TArray<FString> CachedFilters;
+
+	/** Bumped on Invalidate(), builds started with an older generation are discarded */
+	static uint32 Generation;
+
+	/** Callbacks waiting for the in-flight cached build */
+	static TArray<FOnIndexReady> PendingRequests;
+	static bool bCachedBuildInFlight;
+
+	/** Gathers sources and builds the cached index for CachedFilters in the background */
+	static void StartCachedBuild();
+};
@@ -0,0 +1,66 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/** Views into a FGameplayAttribute pin default value. Only valid as long as the source string is alive and unchanged */
+struct FGBATestsAttributePinView
+{
+	/** Attribute set path owning the attribute (eg. /Game/Foo/GBA_Bar.GBA_Bar_C) */
+	FStringView PackageName;
+
+	FStringView AttributeName;
+};
+
+/** A FGameplayAttribute input pin found by the bulk scanner, along with its parsed default value */
+struct FGBATestsAttributePinReference
+{
+	const UBlueprint* Blueprint = nullptr;
+	const UEdGraphNode* Node = nullptr;
+	const UEdGraphPin* Pin = nullptr;
+
+	/** Views into Pin->DefaultValue */
+	FGBATestsAttributePinView View;
+};
+
+/**
+ * Allocation free counterpart of UGBAEditorSubsystem::ParseAttributeFromDefaultValue(), along with a bulk
+ * scanner for the attribute pins of a set of Blueprints.
+ */
+struct BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributePinParser
+{
+	/**
+	 * Parses an exported FGameplayAttribute, eg.
+	 *
+	 *     (Attribute="/Game/Foo/GBA_Bar.GBA_Bar_C:Health",AttributeName="Health",AttributeOwner="/Script/Engine.BlueprintGeneratedClass'/Game/Foo/GBA_Bar.GBA_Bar_C'")
+	 *
+	 * The Attribute field path is authoritative. AttributeName / AttributeOwner are used when the path is missing or None.
+	 *
+	 * @return true if an attribute name was found
+	 */
+	static bool Parse(FStringView InDefaultValue, FGBATestsAttributePinView& OutView);
+
+	/** Whether the pin is a FGameplayAttribute input pin */
+	static bool IsAttributePin(const UEdGraphPin* InPin);
+
+	/**
+	 * Gathers every FGameplayAttribute input pin within the Blueprints graphs, whatever the node type owning it
+	 * (function calls, macro instances, struct makes, custom K2 nodes, ...), and parses their default value.
+	 *
+	 * Graph traversal happens on the game thread (UObject access), parsing happens in parallel as it only reads
+	 * pin default strings. Pins with an empty or unparsable default value are not returned.
+	 */
+	static void ScanBlueprints(TConstArrayView<const UBlueprint*> InBlueprints, TArray<FGBATestsAttributePinReference>& OutReferences);
+
+private:
+	/** Reads the value of the next "Key=Value" pair, and moves InOutText past the trailing separator */
+	static FStringView ReadValue(FStringView& InOutText);
+
+	/** Strips an exported object reference wrapper (ClassName'Path') */
+	static FStringView StripObjectReference(FStringView InText);
+};
@@ -0,0 +1,175 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "UObject/ObjectSaveContext.h"
+#include "GBATestsAttributeReferenceSubsystem.generated.h"
+
+class UBlueprint;
+struct FAssetData;
+
+UENUM()
+enum class EGBATestsAttributeReferenceType : uint8
+{
+	/** Default value of a FGameplayAttribute input pin on a K2 Node */
+	K2Pin,
+
+	/** FGameplayAttribute property value (GE modifiers, execution captures, Blueprint variables, ...) */
+	Property,
+};
+
+/** A single place storing a FGameplayAttribute, as found when scanning a package */
+USTRUCT()
+struct FGBATestsAttributeReference
+{
+	GENERATED_BODY()
+
+	/** Package of the attribute set owning the attribute (eg. /BlueprintAttributesTests/Fixtures/GBAEditorSubsystem/GBA_Reff_Test) */
+	UPROPERTY()
+	FName OwnerPackage;
+
+	UPROPERTY()
+	FName AttributeName;
+
+	/** Package storing the reference */
+	UPROPERTY()
+	FName ReferencerPackage;
+
+	/** Human readable location within the referencer (Graph > Node > Pin, or property path) */
+	UPROPERTY()
+	FString Location;
+
+	UPROPERTY()
+	EGBATestsAttributeReferenceType Type = EGBATestsAttributeReferenceType::K2Pin;
+};
+
+/** Scan result of one package, along with the package file timestamp it was computed from */
+USTRUCT()
+struct FGBATestsAttributeReferencePackageEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Timestamp;
+
+	UPROPERTY()
+	TArray<FGBATestsAttributeReference> References;
+};
+
+/** Persisted form of the index (Saved/BlueprintAttributesTests/AttributeReferenceIndex.json) */
+USTRUCT()
+struct FGBATestsAttributeReferenceCache
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Version = 0;
+
+	UPROPERTY()
+	TMap<FName, FGBATestsAttributeReferencePackageEntry> Packages;
+};
+
+/** Attribute identity within the index: owning attribute set package + attribute name */
+struct FGBATestsAttributeKey
+{
+	FName OwnerPackage;
+	FName AttributeName;
+
+	FGBATestsAttributeKey() = default;
+
+	FGBATestsAttributeKey(const FName& InOwnerPackage, const FName& InAttributeName)
+		: OwnerPackage(InOwnerPackage),
+		  AttributeName(InAttributeName)
+	{
+	}
+
+	bool operator==(const FGBATestsAttributeKey& Other) const
+	{
+		return OwnerPackage == Other.OwnerPackage && AttributeName == Other.AttributeName;
+	}
+
+	friend uint32 GetTypeHash(const FGBATestsAttributeKey& InKey)
+	{
+		return HashCombine(GetTypeHash(InKey.OwnerPackage), GetTypeHash(InKey.AttributeName));
+	}
+};
+
+/**
+ * Reverse index from attribute to the packages (and pins / properties) referencing it.
+ *
+ * The asset registry narrows down candidates to the referencers of the attribute set package, without
+ * loading anything. Candidates are then scanned once and their results persisted along with the package
+ * timestamp, so that later queries (and later editor sessions) only ever load packages that changed.
+ *
+ * The index is kept up to date incrementally: every saved package is re-scanned, removed assets are dropped.
+ */
+UCLASS()
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API UGBATestsAttributeReferenceSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 CacheVersion = 1;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Returns the packages that truly reference the attribute.
+	 *
+	 * Candidates from the asset registry that are not indexed yet (or changed on disk since) are loaded
+	 * and scanned first, so that the result can be used to only load and patch true referencers on rename.
+	 */
+	TArray<FName> ResolveReferencingPackages(const FGBATestsAttributeKey& InKey);
+
+	/** Returns indexed references of the attribute, without resolving any candidate */
+	void GetReferences(const FGBATestsAttributeKey& InKey, TArray<FGBATestsAttributeReference>& OutReferences) const;
+
+	/** Returns referencers of the attribute set package (from the asset registry) that are not indexed or are outdated */
+	TArray<FName> GetUnresolvedCandidates(const FName& InOwnerPackage) const;
+
+	/** Scans a loaded package and replaces its entries in the index */
+	void ScanPackage(const UPackage* InPackage);
+
+	/** Whether the package has an up to date entry in the index */
+	bool IsPackageIndexed(const FName& InPackageName) const;
+
+	void SaveCache() const;
+	void LoadCache();
+
+	/** Drops every entry (in memory only, until next SaveCache) */
+	void ResetIndex();
+
+	static FString GetCacheFilename();
+
+	/** Collects references stored in K2 Node pin default values of the Blueprint */
+	static void CollectPinReferences(const UBlueprint* InBlueprint, TArray<FGBATestsAttributeReference>& OutReferences);
+
+	/** Collects references stored as FGameplayAttribute property values of the object (recursively) */
+	static void CollectPropertyReferences(const UObject* InObject, TArray<FGBATestsAttributeReference>& OutReferences);
+
+	/** Turns the PackageName output of ParseAttributeFromDefaultValue (object path, or exported class path) into a package name */
+	static FName NormalizeOwnerPackage(const FString& InOwnerPath);
+
+private:
+	FGBATestsAttributeReferenceCache Cache;
+
+	/** Derived from Cache, attribute -> referencing packages */
+	TMap<FGBATestsAttributeKey, TSet<FName>> ReferencersByAttribute;
+
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+
+	void SetPackageEntry(const FName& InPackageName, FGBATestsAttributeReferencePackageEntry&& InEntry);
+	void RemovePackageEntry(const FName& InPackageName);
+	void RebuildReverseMap();
+
+	static FString GetPackageTimestamp(const FName& InPackageName);
+
+	void HandlePackageSaved(const FString& InPackageFilename, UPackage* InPackage, FObjectPostSaveContext InObjectSaveContext);
+	void HandleAssetRemoved(const FAssetData& InAssetData);
+	void HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+};
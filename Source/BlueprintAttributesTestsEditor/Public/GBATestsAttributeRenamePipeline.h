@@ -0,0 +1,88 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UBlueprint;
+
+/** How dependent Blueprints are recompiled once their pins are patched */
+enum class EGBATestsAttributeRenameCompileMode : uint8
+{
+	/** Single compilation manager flush (one reinstancing pass), followed by a single GC */
+	Batched,
+
+	/** One FKismetEditorUtilities::CompileBlueprint() per Blueprint, the way the editor does on its own */
+	PerAsset,
+};
+
+/** Timings and counters of a rename run */
+struct FGBATestsAttributeRenameResult
+{
+	int32 NumBlueprints = 0;
+	int32 NumPatchedPins = 0;
+
+	double PatchSeconds = 0.0;
+	double CompileSeconds = 0.0;
+	double GarbageCollectSeconds = 0.0;
+
+	double GetTotalSeconds() const { return PatchSeconds + CompileSeconds + GarbageCollectSeconds; }
+
+	FString ToString() const;
+};
+
+/**
+ * Renames a Blueprint attribute set member and updates every dependent Blueprint in one go:
+ *
+ * - Dependents are collected up front (from the attribute reference index, or given explicitly)
+ * - Pins are scanned and their new default values computed in parallel (string work only), then applied on the
+ *   game thread
+ * - The attribute set and its dependents are queued and compiled in a single compilation manager flush, which
+ *   orders them by dependency and reinstances once, followed by a single garbage collection
+ */
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API FGBATestsAttributeRenamePipeline : public FGCObject
+{
+public:
+	FGBATestsAttributeRenamePipeline(UBlueprint* InAttributeSetBlueprint, const FName& InOldName, const FName& InNewName);
+
+	/** Adds Blueprints referencing the attribute according to UGBATestsAttributeReferenceSubsystem (loading them if needed) */
+	void CollectDependents();
+
+	/** Adds Blueprints to patch and recompile along with the attribute set */
+	void AddDependents(TConstArrayView<UBlueprint*> InBlueprints);
+
+	const TArray<TObjectPtr<UBlueprint>>& GetDependents() const { return Dependents; }
+
+	/** Renames the member variable, patches dependents pins and recompiles everything */
+	FGBATestsAttributeRenameResult Run(EGBATestsAttributeRenameCompileMode InCompileMode = EGBATestsAttributeRenameCompileMode::Batched);
+
+	/**
+	 * Rewrites an exported FGameplayAttribute so that it points to InNewName (both the field path and AttributeName).
+	 * Pure string work, safe to call from any thread.
+	 *
+	 * @return true if anything was replaced
+	 */
+	static bool PatchDefaultValue(FStringView InDefaultValue, FStringView InOldName, FStringView InNewName, FString& OutDefaultValue);
+
+	//~ Begin FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject
+
+private:
+	TObjectPtr<UBlueprint> AttributeSetBlueprint;
+	TArray<TObjectPtr<UBlueprint>> Dependents;
+
+	FName OldName;
+	FName NewName;
+
+	/** Package of the attribute set, as pin owners are normalized to */
+	FName OwnerPackage;
+
+	/** Patches dependents pins, returns the number of patched pins */
+	int32 PatchPins() const;
+
+	void CompileBatched() const;
+	void CompilePerAsset() const;
+};
@@ -10,4 +10,11 @@ class FGBATestsEditorModule : public IModuleInterface
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+
+    void HandleObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent);
 };
@@ -0,0 +1,73 @@
+// Copyright 2022-2026 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GBATestsAttributeIndex.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class ITableRow;
+class SSearchBox;
+class STableViewBase;
+
+DECLARE_DELEGATE_OneParam(FGBATestsOnAttributePicked, const FGameplayAttribute& /* Attribute */);
+
+/**
+ * FGameplayAttribute picker filled from FGBATestsAttributeIndex.
+ *
+ * Opening never enumerates attribute sets on the UI thread past gathering properties: the index is built on a
+ * background task (or reused from cache), rows are virtualized so that only visible ones are formatted, and
+ * search runs against the precomputed lowercase strings, narrowing previous results as the query grows.
+ */
+class BLUEPRINTATTRIBUTESTESTSEDITOR_API SGBATestsAttributePicker : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGBATestsAttributePicker)
+	{
+	}
+		/** Attribute filters, with the same semantics as UGBAEditorSettings::IsAttributeFiltered() */
+		SLATE_ARGUMENT(TArray<FString>, FilterList)
+
+		/** Optional attributes to pick from instead of every attribute set (bypasses the cached index) */
+		SLATE_ARGUMENT(TArray<FGBATestsAttributeIndexSource>, Sources)
+
+		SLATE_EVENT(FGBATestsOnAttributePicked, OnAttributePicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Whether the index is ready and the list populated */
+	bool IsPopulated() const { return Index.IsValid(); }
+
+	/** Items currently listed (after search) */
+	const TArray<FGBATestsAttributeIndexEntryPtr>& GetItems() const { return Items; }
+
+	/** Number of row widgets generated so far, which stays bound to the visible rows */
+	int32 GetNumGeneratedRows() const { return NumGeneratedRows; }
+
+	void SetSearchText(const FText& InSearchText);
+
+private:
+	TSharedPtr<const FGBATestsAttributeIndex> Index;
+
+	TArray<FGBATestsAttributeIndexEntryPtr> Items;
+
+	TSharedPtr<SListView<FGBATestsAttributeIndexEntryPtr>> ListView;
+	TSharedPtr<SSearchBox> SearchBox;
+
+	FGBATestsOnAttributePicked OnAttributePicked;
+
+	/** Query Items were last searched with, to only narrow them down when it grows */
+	FString LastQuery;
+	FText SearchText;
+
+	int32 NumGeneratedRows = 0;
+
+	void HandleIndexReady(TSharedRef<const FGBATestsAttributeIndex> InIndex);
+	void HandleSearchTextChanged(const FText& InSearchText);
+	TSharedRef<ITableRow> HandleGenerateRow(FGBATestsAttributeIndexEntryPtr InItem, const TSharedRef<STableViewBase>& InOwnerTable);
+	void HandleSelectionChanged(FGBATestsAttributeIndexEntryPtr InItem, ESelectInfo::Type InSelectInfo);
+
+	void RefreshItems(const FString& InQuery);
+};